@@ -0,0 +1,97 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <benchmark/benchmark.h>
+#include <Math/Type/Micellanous/DDynamicGrid2D.h>
+#include "XBenchmarkHelper.h"
+
+//!
+//! DDynamicGrid2D benchmarks. Each iteration visits all N x N cells of grid, where N is argument.
+//! `BM_GridData` is baseline of raw buffer access.
+//!
+
+namespace dy::math::bench
+{
+
+/// @brief Visit cells with row (DGridYIterator) and column (DGridXIterator) iterators.
+void BM_GridIterator(benchmark::State& state)
+{
+  const auto size = static_cast<TIndex>(state.range(0));
+  DDynamicGrid2D<TF32> grid{size, size, 1.0f};
+  for (auto _ : state)
+  {
+    TF32 sum = 0;
+    for (auto& row : grid)
+    {
+      for (const auto& value : row) { sum += value; }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+/// @brief Visit cells with `grid[y][x]` subscript.
+void BM_GridSubscript(benchmark::State& state)
+{
+  const auto size = static_cast<TIndex>(state.range(0));
+  DDynamicGrid2D<TF32> grid{size, size, 1.0f};
+  for (auto _ : state)
+  {
+    TF32 sum = 0;
+    for (TIndex y = 0; y < size; ++y)
+    {
+      for (TIndex x = 0; x < size; ++x) { sum += grid[y][x]; }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+/// @brief Visit cells with `Get(x, y)`.
+void BM_GridGet(benchmark::State& state)
+{
+  const auto size = static_cast<TIndex>(state.range(0));
+  DDynamicGrid2D<TF32> grid{size, size, 1.0f};
+  for (auto _ : state)
+  {
+    TF32 sum = 0;
+    for (TIndex y = 0; y < size; ++y)
+    {
+      for (TIndex x = 0; x < size; ++x) { sum += grid.Get(x, y); }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+/// @brief Visit cells with raw pointer of `Data()`.
+void BM_GridData(benchmark::State& state)
+{
+  const auto size = static_cast<TIndex>(state.range(0));
+  DDynamicGrid2D<TF32> grid{size, size, 1.0f};
+  for (auto _ : state)
+  {
+    TF32 sum = 0;
+    const auto* data = grid.Data();
+    for (TIndex i = 0, count = size * size; i < count; ++i) { sum += data[i]; }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+BENCHMARK(BM_GridIterator)->Arg(64)->Arg(512);
+BENCHMARK(BM_GridSubscript)->Arg(64)->Arg(512);
+BENCHMARK(BM_GridGet)->Arg(64)->Arg(512);
+BENCHMARK(BM_GridData)->Arg(64)->Arg(512);
+
+} /// ::dy::math::bench namespace
@@ -0,0 +1,277 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <benchmark/benchmark.h>
+#include <Math/Type/Math/DAffineMatrix4.h>
+#include <Math/Type/Math/DMatrix4.h>
+#include <Math/Type/Math/DQuat.h>
+#include <Math/Utility/XLinearMath.h>
+#include <Math/Utility/XTransformMath.h>
+#include "XBenchmarkHelper.h"
+
+//!
+//! DMatrix4 and DQuaternion benchmarks. Each iteration processes `kDataCount` items.
+//!
+
+namespace dy::math::bench
+{
+
+using DMat4 = DMatrix4<TF32, EMatMajor::Column>;
+using DMat4F64 = DMatrix4<TF64, EMatMajor::Column>;
+
+/// @brief Get `kDataCount` invertible affine matrices, rotation and translation.
+std::vector<DMat4> GetAffineMatrices()
+{
+  std::vector<DMat4> result;
+  for (TIndex i = 0; i < kDataCount; ++i)
+  {
+    const DQuaternion<TF32> rotation{GetRandomVector3(-180, 180)};
+    auto matrix = rotation.ToMatrix4<EMatMajor::Column>();
+    matrix[3] = DVector4<TF32>{GetRandomVector3(-100, 100), 1};
+    result.emplace_back(matrix);
+  }
+  return result;
+}
+
+/// @brief Get `kDataCount` affine matrices of `GetAffineMatrices` as TF64.
+std::vector<DMat4F64> GetAffineMatricesF64()
+{
+  std::vector<DMat4F64> result(kDataCount);
+  const auto matrices = GetAffineMatrices();
+  for (TIndex i = 0; i < kDataCount; ++i)
+  {
+    for (TIndex j = 0; j < 4; ++j) { result[i][j] = static_cast<DVector4<TF64>>(matrices[i][j]); }
+  }
+  return result;
+}
+
+std::vector<DQuaternion<TF32>> GetQuaternions()
+{
+  std::vector<DQuaternion<TF32>> result;
+  for (TIndex i = 0; i < kDataCount; ++i) { result.emplace_back(GetRandomVector3(-180, 180)); }
+  return result;
+}
+
+void BM_Matrix4Multiply(benchmark::State& state)
+{
+  const auto lhs = GetAffineMatrices();
+  const auto rhs = GetAffineMatrices();
+  std::vector<DMat4> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = lhs[i] * rhs[i]; }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_Matrix4MultiplyVector(benchmark::State& state)
+{
+  const auto matrices = GetAffineMatrices();
+  std::vector<DVector4<TF32>> values(kDataCount);
+  for (auto& value : values) { value = DVector4<TF32>{GetRandomVector3(-100, 100), 1}; }
+  std::vector<DVector4<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = matrices[i] * values[i]; }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_Matrix4Inverse(benchmark::State& state)
+{
+  const auto matrices = GetAffineMatrices();
+  std::vector<DMat4> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = matrices[i].Inverse(); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_Matrix4MultiplyF64(benchmark::State& state)
+{
+  const auto lhs = GetAffineMatricesF64();
+  const auto rhs = GetAffineMatricesF64();
+  std::vector<DMat4F64> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = lhs[i] * rhs[i]; }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_Matrix4MultiplyVectorF64(benchmark::State& state)
+{
+  const auto matrices = GetAffineMatricesF64();
+  std::vector<DVector4<TF64>> values(kDataCount);
+  for (auto& value : values) { value = static_cast<DVector4<TF64>>(DVector4<TF32>{GetRandomVector3(-100, 100), 1}); }
+  std::vector<DVector4<TF64>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = matrices[i] * values[i]; }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_Matrix4InverseF64(benchmark::State& state)
+{
+  const auto matrices = GetAffineMatricesF64();
+  std::vector<DMat4F64> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = matrices[i].Inverse(); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Same inversion of `BM_Matrix4Inverse` with affine fast path.
+void BM_Matrix4InverseAffine(benchmark::State& state)
+{
+  const auto matrices = GetAffineMatrices();
+  std::vector<DMat4> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = InverseAffine(matrices[i]); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_Matrix4Transpose(benchmark::State& state)
+{
+  const auto matrices = GetAffineMatrices();
+  std::vector<DMat4> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = matrices[i].Transpose(); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Transform `kDataCount` points by one matrix with bulk `TransformPoints`.
+void BM_Matrix4TransformPoints(benchmark::State& state)
+{
+  const auto matrix = GetAffineMatrices().front();
+  std::vector<DVector3<TF32>> points(kDataCount);
+  for (auto& point : points) { point = GetRandomVector3(-100, 100); }
+  std::vector<DVector3<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    TransformPoints(matrix, points.data(), kDataCount, result.data());
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_QuaternionMultiply(benchmark::State& state)
+{
+  const auto lhs = GetQuaternions();
+  const auto rhs = GetQuaternions();
+  std::vector<DQuaternion<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = lhs[i] * rhs[i]; }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_QuaternionInverse(benchmark::State& state)
+{
+  const auto values = GetQuaternions();
+  std::vector<DQuaternion<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = values[i].Inverse(); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_QuaternionToMatrix4(benchmark::State& state)
+{
+  const auto values = GetQuaternions();
+  std::vector<DMat4> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = values[i].ToMatrix4<EMatMajor::Column>(); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_QuaternionFromEuler(benchmark::State& state)
+{
+  std::vector<DVector3<TF32>> angles(kDataCount);
+  for (auto& angle : angles) { angle = GetRandomVector3(-180, 180); }
+  std::vector<DQuaternion<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = DQuaternion<TF32>{angles[i]}; }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_QuaternionSlerp(benchmark::State& state)
+{
+  const auto lhs = GetQuaternions();
+  const auto rhs = GetQuaternions();
+  std::vector<TF32> factors(kDataCount);
+  for (auto& factor : factors) { factor = GetRandom(0, 1); }
+  std::vector<DQuaternion<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = Slerp(lhs[i], rhs[i], factors[i]); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+BENCHMARK(BM_Matrix4Multiply);
+BENCHMARK(BM_Matrix4MultiplyVector);
+BENCHMARK(BM_Matrix4Inverse);
+BENCHMARK(BM_Matrix4MultiplyF64);
+BENCHMARK(BM_Matrix4MultiplyVectorF64);
+BENCHMARK(BM_Matrix4InverseF64);
+BENCHMARK(BM_Matrix4InverseAffine);
+BENCHMARK(BM_Matrix4Transpose);
+BENCHMARK(BM_Matrix4TransformPoints);
+BENCHMARK(BM_QuaternionMultiply);
+BENCHMARK(BM_QuaternionInverse);
+BENCHMARK(BM_QuaternionToMatrix4);
+BENCHMARK(BM_QuaternionFromEuler);
+BENCHMARK(BM_QuaternionSlerp);
+
+} /// ::dy::math::bench namespace
@@ -0,0 +1,376 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <Math/Type/Micellanous/DBlueNoiseTile.h>
+#include <Math/Utility/XLowDiscrepancy.h>
+#include <Math/Utility/XRandom.h>
+#include <Math/Utility/XSampling.h>
+#include "XBenchmarkHelper.h"
+
+//!
+//! XRandom benchmarks. Each iteration creates `kDataCount` random values.
+//!
+
+namespace dy::math::bench
+{
+
+void BM_RandomInteger(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    TI32 sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { sum ^= RandomUniformInteger<TI32>(0, 1000); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_RandomReal(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    TF32 sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { sum += RandomUniformReal<TF32>(0, 1); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// Each thread uses own engine, so items per second of all threads should grow with threads.
+void BM_RandomRealThreads(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    TF32 sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { sum += RandomUniformReal<TF32>(0, 1); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_RandomRealOwnedEngine(benchmark::State& state)
+{
+  DRandomEngine engine{static_cast<TU64>(state.thread_index())};
+  for (auto _ : state)
+  {
+    TF32 sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { sum += RandomUniformReal<TF32>(engine, 0, 1); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TEngine>
+void BM_RandomIntegerEngine(benchmark::State& state)
+{
+  TEngine engine{1};
+  for (auto _ : state)
+  {
+    TI32 sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { sum ^= RandomUniformInteger<TI32>(engine, 0, 1000); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TEngine>
+void BM_RandomRealEngine(benchmark::State& state)
+{
+  TEngine engine{1};
+  for (auto _ : state)
+  {
+    TF32 sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { sum += RandomUniformReal<TF32>(engine, 0, 1); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// `std` distributions with `std::mt19937`, which random functions used before.
+void BM_RandomRealStdDistribution(benchmark::State& state)
+{
+  std::mt19937 engine{1};
+  std::uniform_real_distribution<TF32> distribution{0, 1};
+  for (auto _ : state)
+  {
+    TF32 sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { sum += distribution(engine); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_RandomVector2Length(benchmark::State& state)
+{
+  std::vector<DVector2<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (auto& value : result) { value = RandomVector2Length<TF32>(1); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_RandomVector3Length(benchmark::State& state)
+{
+  std::vector<DVector3<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (auto& value : result) { value = RandomVector3Length<TF32>(1); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// Loop of `RandomUniformReal`, to compare with `FillUniform`.
+void BM_RandomRealLoop(benchmark::State& state)
+{
+  std::vector<TF32> result(state.range(0));
+  for (auto _ : state)
+  {
+    for (auto& value : result) { value = RandomUniformReal<TF32>(0, 1); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(TF32));
+}
+
+void BM_RandomFillUniform(benchmark::State& state)
+{
+  std::vector<TF32> result(state.range(0));
+  for (auto _ : state)
+  {
+    FillUniform(result.data(), result.size(), 0.0f, 1.0f);
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(TF32));
+}
+
+void BM_RandomFillNormal(benchmark::State& state)
+{
+  std::vector<TF32> result(state.range(0));
+  for (auto _ : state)
+  {
+    FillNormal(result.data(), result.size(), 0.0f, 1.0f);
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(TF32));
+}
+
+void BM_RandomFillOnSphere(benchmark::State& state)
+{
+  std::vector<DVector3<TF32>> result(state.range(0));
+  for (auto _ : state)
+  {
+    FillOnSphere(result.data(), result.size());
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(DVector3<TF32>));
+}
+
+void BM_RandomFillInDisk(benchmark::State& state)
+{
+  std::vector<DVector2<TF32>> result(state.range(0));
+  for (auto _ : state)
+  {
+    FillInDisk(result.data(), result.size());
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(DVector2<TF32>));
+}
+
+template <ERandomPolicy TPolicy>
+void BM_RandomVector3Range(benchmark::State& state)
+{
+  std::vector<DVector3<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (auto& value : result) { value = RandomVector3Range<TF32>(TPolicy, 1, 2); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Make 2D point of `index` from sequence.
+template <typename TFunction>
+void RunSequenceBenchmark(benchmark::State& state, TFunction&& function)
+{
+  std::vector<DVector2<TF32>> result(kDataCount);
+  TU32 offset = 0;
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = function(offset + static_cast<TU32>(i)); }
+    offset += kDataCount;
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SequenceSobol(benchmark::State& state)
+{
+  RunSequenceBenchmark(state, [](TU32 index) { return SobolVector2<TF32>(index); });
+}
+
+void BM_SequenceOwenSobol(benchmark::State& state)
+{
+  RunSequenceBenchmark(state, [](TU32 index) { return OwenSobolVector2<TF32>(index, 0, 1234); });
+}
+
+void BM_SequenceHalton(benchmark::State& state)
+{
+  RunSequenceBenchmark(state, [](TU32 index) { return HaltonVector2<TF32>(index, 4); });
+}
+
+void BM_SequenceR2(benchmark::State& state)
+{
+  RunSequenceBenchmark(state, [](TU32 index) { return RdVector2<TF32>(index); });
+}
+
+void BM_SequenceBlueNoise(benchmark::State& state)
+{
+  const DBlueNoiseTile tile{64};
+  RunSequenceBenchmark(state, [&tile](TU32 index) { return tile.GetVector2<TF32>(index, index >> 6, 1); });
+}
+
+void BM_BlueNoiseTileGenerate(benchmark::State& state)
+{
+  DBlueNoiseTile tile;
+  for (auto _ : state)
+  {
+    tile.Generate(state.range(0));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+/// @brief Uniform samples of two planes, for sampling benchmarks.
+struct DSamplePlanes final
+{
+  std::vector<TF32> mU0;
+  std::vector<TF32> mU1;
+
+  explicit DSamplePlanes(TIndex count) : mU0(count), mU1(count)
+  {
+    FillUniform(mU0.data(), count, 0.0f, 1.0f);
+    FillUniform(mU1.data(), count, 0.0f, 1.0f);
+  }
+};
+
+void BM_SampleCosineHemisphere(benchmark::State& state)
+{
+  const DSamplePlanes samples{kDataCount};
+  std::vector<DVector3<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) 
+    { 
+      result[i] = SampleCosineHemisphere(DVector2<TF32>{samples.mU0[i], samples.mU1[i]}); 
+    }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SampleCosineHemispheres(benchmark::State& state)
+{
+  const DSamplePlanes samples{kDataCount};
+  DVector3Stream<TF32> result{kDataCount};
+  for (auto _ : state)
+  {
+    SampleCosineHemispheres(samples.mU0.data(), samples.mU1.data(), kDataCount, result);
+    benchmark::DoNotOptimize(result.GetPlane(0));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SampleUniformSpheres(benchmark::State& state)
+{
+  const DSamplePlanes samples{kDataCount};
+  DVector3Stream<TF32> result{kDataCount};
+  for (auto _ : state)
+  {
+    SampleUniformSpheres(samples.mU0.data(), samples.mU1.data(), kDataCount, result);
+    benchmark::DoNotOptimize(result.GetPlane(0));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SampleUniformTriangles(benchmark::State& state)
+{
+  const DSamplePlanes samples{kDataCount};
+  DVector3Stream<TF32> result{kDataCount};
+  const DVector3<TF32> p0{0, 0, 0}, p1{1, 0, 0}, p2{0, 1, 0};
+  for (auto _ : state)
+  {
+    SampleUniformTriangles(samples.mU0.data(), samples.mU1.data(), kDataCount, p0, p1, p2, result);
+    benchmark::DoNotOptimize(result.GetPlane(0));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+BENCHMARK(BM_RandomInteger);
+BENCHMARK(BM_RandomReal);
+BENCHMARK(BM_RandomRealThreads)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_RandomRealOwnedEngine)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RandomIntegerEngine, std::mt19937);
+BENCHMARK_TEMPLATE(BM_RandomIntegerEngine, DSplitMix64);
+BENCHMARK_TEMPLATE(BM_RandomIntegerEngine, DPcg32);
+BENCHMARK_TEMPLATE(BM_RandomIntegerEngine, DXoshiro256StarStar);
+BENCHMARK_TEMPLATE(BM_RandomIntegerEngine, DPhilox4x32);
+BENCHMARK_TEMPLATE(BM_RandomRealEngine, std::mt19937);
+BENCHMARK_TEMPLATE(BM_RandomRealEngine, DSplitMix64);
+BENCHMARK_TEMPLATE(BM_RandomRealEngine, DPcg32);
+BENCHMARK_TEMPLATE(BM_RandomRealEngine, DXoshiro256StarStar);
+BENCHMARK_TEMPLATE(BM_RandomRealEngine, DPhilox4x32);
+BENCHMARK(BM_RandomRealStdDistribution);
+BENCHMARK(BM_RandomVector2Length);
+BENCHMARK(BM_RandomVector3Length);
+BENCHMARK(BM_RandomRealLoop)->Arg(kDataCount)->Arg(10'000'000);
+BENCHMARK(BM_RandomFillUniform)->Arg(kDataCount)->Arg(10'000'000);
+BENCHMARK(BM_RandomFillNormal)->Arg(kDataCount)->Arg(10'000'000);
+BENCHMARK(BM_RandomFillOnSphere)->Arg(kDataCount)->Arg(10'000'000);
+BENCHMARK(BM_RandomFillInDisk)->Arg(kDataCount)->Arg(10'000'000);
+BENCHMARK_TEMPLATE(BM_RandomVector3Range, ERandomPolicy::Uniform);
+BENCHMARK_TEMPLATE(BM_RandomVector3Range, ERandomPolicy::Discrete);
+BENCHMARK(BM_SampleCosineHemisphere);
+BENCHMARK(BM_SampleCosineHemispheres);
+BENCHMARK(BM_SampleUniformSpheres);
+BENCHMARK(BM_SampleUniformTriangles);
+BENCHMARK(BM_SequenceSobol);
+BENCHMARK(BM_SequenceOwenSobol);
+BENCHMARK(BM_SequenceHalton);
+BENCHMARK(BM_SequenceR2);
+BENCHMARK(BM_SequenceBlueNoise);
+BENCHMARK(BM_BlueNoiseTileGenerate)->Arg(32)->Arg(64)->Unit(benchmark::kMillisecond);
+
+} /// ::dy::math::bench namespace
@@ -0,0 +1,443 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <benchmark/benchmark.h>
+#include <Math/Type/Micellanous/DSdfBrickGrid.h>
+#include <Math/Type/Micellanous/DSdfScene.h>
+#include <Math/Type/Shape/DRayPacket.h>
+#include <Math/Utility/XSdfMath.h>
+#include <Math/Utility/XShapeMath.h>
+#include "XBenchmarkHelper.h"
+
+//!
+//! XShapeMath benchmarks. Each iteration tests `kDataCount` pairs of ray and shape.
+//! About half of rays hit shapes, so both of hit and miss paths are measured.
+//!
+
+namespace dy::math::bench
+{
+
+template <typename TShape> TShape GetRandomShape();
+
+template <> DBounds3D<TF32> GetRandomShape()
+{
+  const auto origin = GetRandomVector3(-10, 10);
+  return {origin - GetRandomVector3(1, 8), origin + GetRandomVector3(1, 8)};
+}
+template <> DSphere<TF32> GetRandomShape()
+{
+  return {GetRandomVector3(-10, 10), GetRandom(1, 8)};
+}
+template <> DBox<TF32> GetRandomShape()
+{
+  return {GetRandomVector3(-10, 10), GetRandomVector3(1, 8)};
+}
+template <> DPlane<TF32> GetRandomShape()
+{
+  return {GetRandomVector3(-1, 1).Normalize(), GetRandom(-10, 10)};
+}
+template <> DTorus<TF32> GetRandomShape()
+{
+  return {GetRandomVector3(-10, 10), GetRandom(4, 8), GetRandom(1, 3)};
+}
+template <> DCone<TF32> GetRandomShape()
+{
+  return {GetRandomVector3(-10, 10), GetRandom(2, 8), GetRandom(1, 8)};
+}
+template <> DCapsule<TF32> GetRandomShape()
+{
+  return {GetRandomVector3(-10, 10), GetRandom(2, 8), GetRandom(1, 4)};
+}
+
+/// @brief Input data of one shape benchmark.
+template <typename TShape>
+struct DShapeData final
+{
+  std::vector<DRay<TF32>> mRays = GetRandomRays(kDataCount, 50);
+  std::vector<TShape> mShapes;
+  std::vector<DQuaternion<TF32>> mRotations;
+
+  DShapeData()
+  {
+    for (TIndex i = 0; i < kDataCount; ++i)
+    {
+      this->mShapes.emplace_back(GetRandomShape<TShape>());
+      this->mRotations.emplace_back(GetRandomVector3(-180, 180));
+    }
+  }
+};
+
+template <typename TShape>
+void BM_ShapeIsRayIntersected(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { count += IsRayIntersected(data.mRays[i], data.mShapes[i]); }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TShape>
+void BM_ShapeIsRayIntersectedRotated(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i)
+    {
+      count += IsRayIntersected(data.mRays[i], data.mShapes[i], data.mRotations[i]);
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TShape>
+void BM_ShapeGetTValueSetOf(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { count += GetTValueSetOf(data.mRays[i], data.mShapes[i]).size(); }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Same to `BM_ShapeGetTValueSetOf`, with allocating `std::vector` result.
+template <typename TShape>
+void BM_ShapeGetTValuesOf(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { count += GetTValuesOf(data.mRays[i], data.mShapes[i]).size(); }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TShape>
+void BM_ShapeGetClosestTValueOf(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  for (auto _ : state)
+  {
+    TReal sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i)
+    {
+      sum += GetClosestTValueOf(data.mRays[i], data.mShapes[i]).value_or(TReal(0));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TShape>
+void BM_ShapeGetClosestTValueOfRotated(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  for (auto _ : state)
+  {
+    TReal sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i)
+    {
+      sum += GetClosestTValueOf(data.mRays[i], data.mShapes[i], data.mRotations[i]).value_or(TReal(0));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TShape>
+void BM_ShapeGetNormalOf(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { count += GetNormalOf(data.mRays[i], data.mShapes[i]).has_value(); }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TShape>
+void BM_ShapeGetSDFValueOf(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  for (auto _ : state)
+  {
+    TReal sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { sum += GetSDFValueOf(data.mRays[i].GetOrigin(), data.mShapes[i]); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TShape>
+void BM_ShapeGetDBounds3DOf(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  std::vector<DBounds3D<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = GetDBounds3DOf(data.mShapes[i]); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Closest 't' of `TLanes` rays at once. Items are rays, so it can be compared with scalar version.
+template <typename TShape, TIndex TLanes>
+void BM_ShapePacketGetClosestTValueOf(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  std::vector<DRayPacket<TF32, TLanes>> packets;
+  for (TIndex i = 0; i < kDataCount; i += TLanes) { packets.emplace_back(&data.mRays[i]); }
+
+  std::array<TReal, TLanes> tValues;
+  for (auto _ : state)
+  {
+    TU32 mask = 0;
+    for (TIndex i = 0; i < kDataCount; i += TLanes)
+    {
+      mask ^= GetClosestTValueOf(packets[i / TLanes], data.mShapes[i], tValues);
+      benchmark::DoNotOptimize(tValues);
+    }
+    benchmark::DoNotOptimize(mask);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Cull `kDataCount` volumes one by one with `IsVisible`. About half of volumes are visible.
+template <typename TShape>
+void BM_FrustumIsVisible(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  const auto frustum = GetPerspectiveFrustum(20);
+  for (auto _ : state)
+  {
+    TIndex visibleCount = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { visibleCount += frustum.IsVisible(data.mShapes[i]); }
+    benchmark::DoNotOptimize(visibleCount);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Same culling of `BM_FrustumIsVisible` with `GetVisibleMasksOf`, which tests planes with SIMD lanes.
+template <typename TShape>
+void BM_FrustumGetVisibleMasksOf(benchmark::State& state)
+{
+  const DShapeData<TShape> data;
+  const auto frustum = GetPerspectiveFrustum(20);
+  std::vector<TU32> masks(kDataCount / 32);
+  for (auto _ : state)
+  {
+    frustum.GetVisibleMasksOf(data.mShapes.data(), kDataCount, masks.data());
+    benchmark::DoNotOptimize(masks.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Get scene of `count` capsules and tori in [-20, 20), which are combined as balanced tree
+/// of union and smooth union nodes.
+inline DSdfScene<TF32> GetRandomSdfScene(TIndex count)
+{
+  DSdfScene<TF32> scene;
+  std::vector<DSdfScene<TF32>::TNodeId> ids;
+  for (TIndex i = 0; i < count; ++i)
+  {
+    const auto origin = GetRandomVector3(-20, 20);
+    if (i % 2 == 0) { ids.emplace_back(scene.AddShape(DCapsule<TF32>{origin, GetRandom(1, 4), GetRandom(0.3f, 1)})); }
+    else            { ids.emplace_back(scene.AddShape(DTorus<TF32>{origin, GetRandom(1, 3), GetRandom(0.1f, 0.5f)})); }
+  }
+
+  while (ids.size() > 1)
+  {
+    std::vector<DSdfScene<TF32>::TNodeId> parents;
+    for (TIndex i = 0; i + 1 < ids.size(); i += 2)
+    {
+      const auto operation = (i % 4 == 0) ? ESdfOperation::SmoothUnion : ESdfOperation::Union;
+      parents.emplace_back(scene.AddOperation(operation, ids[i], ids[i + 1], 0.5f));
+    }
+    if (ids.size() % 2 == 1) { parents.emplace_back(ids.back()); }
+    ids.swap(parents);
+  }
+  scene.SetRoot(ids.front());
+  return scene;
+}
+
+/// @brief SDF value of scene of `state.range(0)` shapes, from `kDataCount` points one by one.
+void BM_SdfSceneGetSDFValueOf(benchmark::State& state)
+{
+  const auto scene = GetRandomSdfScene(state.range(0));
+  std::vector<DVector3<TF32>> points;
+  for (TIndex i = 0; i < kDataCount; ++i) { points.emplace_back(GetRandomVector3(-25, 25)); }
+
+  std::vector<TReal> values(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { values[i] = scene.GetSDFValueOf(points[i]); }
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Same queries of `BM_SdfSceneGetSDFValueOf` with `GetSDFValuesOf`, which evaluates points with SIMD lanes.
+void BM_SdfSceneGetSDFValuesOf(benchmark::State& state)
+{
+  const auto scene = GetRandomSdfScene(state.range(0));
+  std::vector<DVector3<TF32>> inputs;
+  for (TIndex i = 0; i < kDataCount; ++i) { inputs.emplace_back(GetRandomVector3(-25, 25)); }
+  const DVector3Stream<TF32> points{inputs.data(), kDataCount};
+
+  std::vector<TReal> values(kDataCount);
+  for (auto _ : state)
+  {
+    scene.GetSDFValuesOf(points, values.data());
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Same queries of `BM_SdfSceneGetSDFValueOf` from scene baked into DSdfBrickGrid.
+/// Voxel size is 0.25 and band width is 0.5, so bricks are allocated only near the surface.
+void BM_SdfBrickGridGetSDFValueOf(benchmark::State& state)
+{
+  const auto scene = GetRandomSdfScene(state.range(0));
+  const DSdfBrickGrid<TF32> grid{scene, DBounds3D<TF32>{DVector3<TF32>{-25}, DVector3<TF32>{25}}, 0.25f, 0.5f};
+  std::vector<DVector3<TF32>> points;
+  for (TIndex i = 0; i < kDataCount; ++i) { points.emplace_back(GetRandomVector3(-25, 25)); }
+
+  std::vector<TReal> values(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { values[i] = grid.GetSDFValueOf(points[i]); }
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Sphere tracing of `kDataCount` rays in packets of 8 into scene of `state.range(0)` shapes,
+/// with over-relaxation factor `state.range(1) / 100`. Counter `steps` is average SDF evaluations per ray.
+void BM_SdfSceneSphereTrace(benchmark::State& state)
+{
+  const auto scene = GetRandomSdfScene(state.range(0));
+  const auto rays = GetRandomRays(kDataCount, 40);
+  std::vector<DRayPacket<TF32, 8>> packets;
+  for (TIndex i = 0; i < kDataCount; i += 8) { packets.emplace_back(&rays[i]); }
+
+  DSphereTraceOption option;
+  option.mRelaxation = TReal(state.range(1)) / TReal(100);
+  DSphereTraceResult<TF32, 8> result;
+  TIndex stepCount = 0;
+  for (auto _ : state)
+  {
+    stepCount = 0;
+    for (const auto& packet : packets)
+    {
+      SphereTrace(packet, scene, option, result);
+      for (const TU32 count : result.mStepCounts) { stepCount += count; }
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+  state.counters["steps"] = TF64(stepCount) / TF64(kDataCount);
+}
+
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersected, DBounds3D<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersected, DSphere<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersected, DBox<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersected, DPlane<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersected, DTorus<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersected, DCone<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersected, DCapsule<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersectedRotated, DBox<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersectedRotated, DTorus<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersectedRotated, DCone<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeIsRayIntersectedRotated, DCapsule<TF32>);
+
+BENCHMARK_TEMPLATE(BM_ShapeGetTValueSetOf, DBounds3D<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetTValueSetOf, DSphere<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetTValueSetOf, DBox<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetTValueSetOf, DPlane<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetTValueSetOf, DTorus<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetTValueSetOf, DCone<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetTValueSetOf, DCapsule<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetTValuesOf, DSphere<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetTValuesOf, DTorus<TF32>);
+
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOf, DBounds3D<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOf, DSphere<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOf, DBox<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOf, DPlane<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOf, DTorus<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOf, DCone<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOf, DCapsule<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOfRotated, DBox<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOfRotated, DTorus<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOfRotated, DCone<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetClosestTValueOfRotated, DCapsule<TF32>);
+
+BENCHMARK_TEMPLATE(BM_ShapeGetNormalOf, DSphere<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetNormalOf, DBox<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetNormalOf, DPlane<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetNormalOf, DTorus<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetNormalOf, DCone<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetNormalOf, DCapsule<TF32>);
+
+BENCHMARK_TEMPLATE(BM_ShapeGetSDFValueOf, DSphere<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetSDFValueOf, DBox<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetSDFValueOf, DPlane<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetSDFValueOf, DTorus<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetSDFValueOf, DCone<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetSDFValueOf, DCapsule<TF32>);
+
+BENCHMARK_TEMPLATE(BM_ShapeGetDBounds3DOf, DSphere<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetDBounds3DOf, DBox<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetDBounds3DOf, DTorus<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetDBounds3DOf, DCone<TF32>);
+BENCHMARK_TEMPLATE(BM_ShapeGetDBounds3DOf, DCapsule<TF32>);
+
+BENCHMARK_TEMPLATE(BM_ShapePacketGetClosestTValueOf, DBounds3D<TF32>, 4);
+BENCHMARK_TEMPLATE(BM_ShapePacketGetClosestTValueOf, DBounds3D<TF32>, 8);
+BENCHMARK_TEMPLATE(BM_ShapePacketGetClosestTValueOf, DSphere<TF32>, 4);
+BENCHMARK_TEMPLATE(BM_ShapePacketGetClosestTValueOf, DSphere<TF32>, 8);
+BENCHMARK_TEMPLATE(BM_ShapePacketGetClosestTValueOf, DBox<TF32>, 4);
+BENCHMARK_TEMPLATE(BM_ShapePacketGetClosestTValueOf, DBox<TF32>, 8);
+
+BENCHMARK_TEMPLATE(BM_FrustumIsVisible, DBounds3D<TF32>);
+BENCHMARK_TEMPLATE(BM_FrustumIsVisible, DSphere<TF32>);
+BENCHMARK_TEMPLATE(BM_FrustumIsVisible, DBox<TF32>);
+BENCHMARK_TEMPLATE(BM_FrustumGetVisibleMasksOf, DBounds3D<TF32>);
+BENCHMARK_TEMPLATE(BM_FrustumGetVisibleMasksOf, DSphere<TF32>);
+BENCHMARK_TEMPLATE(BM_FrustumGetVisibleMasksOf, DBox<TF32>);
+
+BENCHMARK(BM_SdfSceneGetSDFValueOf)->Arg(16)->Arg(256);
+BENCHMARK(BM_SdfSceneGetSDFValuesOf)->Arg(16)->Arg(256);
+BENCHMARK(BM_SdfBrickGridGetSDFValueOf)->Arg(16)->Arg(256);
+BENCHMARK(BM_SdfSceneSphereTrace)->Args({64, 100})->Args({64, 150});
+
+} /// ::dy::math::bench namespace
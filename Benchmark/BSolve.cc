@@ -0,0 +1,193 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <benchmark/benchmark.h>
+#include <Math/Utility/XMath.h>
+#include "XBenchmarkHelper.h"
+
+//!
+//! SolveQuadric, SolveCubic and SolveQuartic family benchmarks.
+//! Each iteration solves `kDataCount` equations, built from random roots so all root count cases appear.
+//!
+
+namespace dy::math::bench
+{
+
+/// @brief Coefficients of `kDataCount` equations in structure of arrays. `mC[0]` is constant term.
+struct DCoefficients final
+{
+  std::array<std::vector<TReal>, 5> mC;
+
+  explicit DCoefficients(TIndex degree)
+  {
+    for (auto& c : this->mC) { c.resize(kDataCount); }
+    for (TIndex i = 0; i < kDataCount; ++i)
+    {
+      // Multiply (x - r) terms of random roots, and add random offset to make complex roots.
+      std::array<TReal, 5> poly = {1, 0, 0, 0, 0};
+      for (TIndex d = 0; d < degree; ++d)
+      {
+        const TReal root = GetRandom(-10, 10);
+        for (TIndex k = d + 1; k > 0; --k) { poly[k] = poly[k - 1] - root * poly[k]; }
+        poly[0] = -root * poly[0];
+      }
+      poly[0] += GetRandom(-20, 20);
+      for (TIndex k = 0; k < 5; ++k) { this->mC[k][i] = poly[k]; }
+    }
+  }
+};
+
+void BM_SolveQuadricVector(benchmark::State& state)
+{
+  const DCoefficients c{2};
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { count += SolveQuadric(c.mC[2][i], c.mC[1][i], c.mC[0][i]).size(); }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SolveQuadricRootSet(benchmark::State& state)
+{
+  const DCoefficients c{2};
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i)
+    {
+      count += SolveQuadricRoots(c.mC[2][i], c.mC[1][i], c.mC[0][i]).size();
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SolveQuadricBatch(benchmark::State& state)
+{
+  const DCoefficients c{2};
+  std::vector<TU32> counts(kDataCount);
+  std::vector<TReal> roots(2 * kDataCount);
+  for (auto _ : state)
+  {
+    SolveQuadricBatch(kDataCount, c.mC[2].data(), c.mC[1].data(), c.mC[0].data(), counts.data(), roots.data());
+    benchmark::DoNotOptimize(roots.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SolveCubicVector(benchmark::State& state)
+{
+  const DCoefficients c{3};
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i)
+    {
+      count += SolveCubic(c.mC[3][i], c.mC[2][i], c.mC[1][i], c.mC[0][i]).size();
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SolveCubicRootSet(benchmark::State& state)
+{
+  const DCoefficients c{3};
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i)
+    {
+      count += SolveCubicRoots(c.mC[3][i], c.mC[2][i], c.mC[1][i], c.mC[0][i]).size();
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SolveCubicBatch(benchmark::State& state)
+{
+  const DCoefficients c{3};
+  std::vector<TU32> counts(kDataCount);
+  std::vector<TReal> roots(3 * kDataCount);
+  for (auto _ : state)
+  {
+    SolveCubicBatch(
+      kDataCount, c.mC[3].data(), c.mC[2].data(), c.mC[1].data(), c.mC[0].data(),
+      counts.data(), roots.data());
+    benchmark::DoNotOptimize(roots.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SolveQuarticVector(benchmark::State& state)
+{
+  const DCoefficients c{4};
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i)
+    {
+      count += SolveQuartic(c.mC[4][i], c.mC[3][i], c.mC[2][i], c.mC[1][i], c.mC[0][i]).size();
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SolveQuarticRootSet(benchmark::State& state)
+{
+  const DCoefficients c{4};
+  for (auto _ : state)
+  {
+    TIndex count = 0;
+    for (TIndex i = 0; i < kDataCount; ++i)
+    {
+      count += SolveQuarticRoots(c.mC[4][i], c.mC[3][i], c.mC[2][i], c.mC[1][i], c.mC[0][i]).size();
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_SolveQuarticBatch(benchmark::State& state)
+{
+  const DCoefficients c{4};
+  std::vector<TU32> counts(kDataCount);
+  std::vector<TReal> roots(4 * kDataCount);
+  for (auto _ : state)
+  {
+    SolveQuarticBatch(
+      kDataCount, c.mC[4].data(), c.mC[3].data(), c.mC[2].data(), c.mC[1].data(), c.mC[0].data(),
+      counts.data(), roots.data());
+    benchmark::DoNotOptimize(roots.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+BENCHMARK(BM_SolveQuadricVector);
+BENCHMARK(BM_SolveQuadricRootSet);
+BENCHMARK(BM_SolveQuadricBatch);
+BENCHMARK(BM_SolveCubicVector);
+BENCHMARK(BM_SolveCubicRootSet);
+BENCHMARK(BM_SolveCubicBatch);
+BENCHMARK(BM_SolveQuarticVector);
+BENCHMARK(BM_SolveQuarticRootSet);
+BENCHMARK(BM_SolveQuarticBatch);
+
+} /// ::dy::math::bench namespace
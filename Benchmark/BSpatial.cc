@@ -0,0 +1,232 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <benchmark/benchmark.h>
+#include <Math/Type/Micellanous/DBvh.h>
+#include <Math/Type/Micellanous/DDynamicBoundsTree.h>
+#include "XBenchmarkHelper.h"
+
+//!
+//! DBvh and DDynamicBoundsTree benchmarks. First argument is the number of shapes.
+//! Shapes are scattered in a cube whose volume grows with the number of shapes, so density is constant.
+//!
+
+namespace dy::math::bench
+{
+
+/// @brief Get extent of scene which has `count` shapes.
+TF32 GetSceneExtentOf(TIndex count)
+{
+  return TF32(4) * std::cbrt(TF32(count));
+}
+
+/// @brief Get `count` shapes of DBvh. Every 5 shapes have sphere, box, capsule, cone and torus.
+std::vector<DBvhShape<TF32>> GetBvhShapes(TIndex count)
+{
+  const auto extent = GetSceneExtentOf(count);
+  std::vector<DBvhShape<TF32>> result;
+  result.reserve(count);
+  for (TIndex i = 0; i < count; ++i)
+  {
+    const auto origin = GetRandomVector3(-extent, extent);
+    switch (i % 5)
+    {
+    case 0: result.emplace_back(DSphere<TF32>{origin, GetRandom(0.2f, 1)}); break;
+    case 1: result.emplace_back(DBox<TF32>{origin, GetRandomVector3(0.2f, 1)}); break;
+    case 2: result.emplace_back(DCapsule<TF32>{origin, GetRandom(0.5f, 2), GetRandom(0.2f, 0.5f)}); break;
+    case 3: result.emplace_back(DCone<TF32>{origin, GetRandom(0.5f, 2), GetRandom(0.2f, 1)}); break;
+    default: result.emplace_back(DTorus<TF32>{origin, GetRandom(0.5f, 1), GetRandom(0.1f, 0.3f)}); break;
+    }
+  }
+  return result;
+}
+
+/// @brief Build DBvh. Second argument is build method, third is the number of threads (0 is all threads).
+void BM_BvhBuild(benchmark::State& state)
+{
+  const auto shapes = GetBvhShapes(static_cast<TIndex>(state.range(0)));
+  DBvhBuildOption option;
+  option.mMethod      = static_cast<EBvhBuildMethod>(state.range(1));
+  option.mThreadCount = static_cast<TIndex>(state.range(2));
+
+  DBvh<TF32> bvh;
+  for (auto _ : state)
+  {
+    bvh.Build(shapes, option);
+    benchmark::DoNotOptimize(bvh.GetNodes().data());
+  }
+  state.SetItemsProcessed(state.iterations() * shapes.size());
+}
+
+/// @brief Set arguments of `BM_BvhBuild`. Threads are powers of 2 up to hardware threads, to show scaling of
+/// parallel build, and 0 (all threads of pool) is added as the last point.
+void SetBvhBuildArguments(benchmark::internal::Benchmark* benchmark)
+{
+  const auto hardwareThreads = std::max<int64_t>(std::thread::hardware_concurrency(), 1);
+  for (const int64_t shapes : {1 << 10, 1 << 14, 1 << 17})
+  {
+    for (const int64_t method : {0, 1})
+    {
+      for (int64_t threads = 1; threads <= hardwareThreads; threads *= 2) { benchmark->Args({shapes, method, threads}); }
+      benchmark->Args({shapes, method, 0});
+    }
+  }
+}
+
+/// @brief Closest hit of `kDataCount` rays with DBvh. Second argument is build method.
+void BM_BvhClosestHit(benchmark::State& state)
+{
+  const auto count  = static_cast<TIndex>(state.range(0));
+  const auto shapes = GetBvhShapes(count);
+  const auto rays   = GetRandomRays(kDataCount, GetSceneExtentOf(count));
+  DBvhBuildOption option;
+  option.mMethod = static_cast<EBvhBuildMethod>(state.range(1));
+  const DBvh<TF32> bvh{shapes, option};
+
+  for (auto _ : state)
+  {
+    TIndex hitCount = 0;
+    for (const auto& ray : rays) { hitCount += bvh.GetClosestHit(ray).has_value(); }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Same closest hit of `BM_BvhClosestHit` by testing all shapes, as baseline.
+void BM_LinearClosestHit(benchmark::State& state)
+{
+  const auto count  = static_cast<TIndex>(state.range(0));
+  const auto shapes = GetBvhShapes(count);
+  const auto rays   = GetRandomRays(kDataCount, GetSceneExtentOf(count));
+
+  for (auto _ : state)
+  {
+    TIndex hitCount = 0;
+    for (const auto& ray : rays)
+    {
+      auto closest = kMaxValueOf<TReal>;
+      for (const auto& shape : shapes)
+      {
+        const auto t = std::visit([&ray](const auto& item) { return GetClosestTValueOf(ray, item); }, shape);
+        if (t.has_value() == true && *t >= 0 && *t < closest) { closest = *t; }
+      }
+      hitCount += closest != kMaxValueOf<TReal>;
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Get visible shapes of DBvh with frustum which sees about a quarter of scene.
+void BM_BvhVisibleIndices(benchmark::State& state)
+{
+  const auto count  = static_cast<TIndex>(state.range(0));
+  const DBvh<TF32> bvh{GetBvhShapes(count)};
+  const auto frustum = GetPerspectiveFrustum(GetSceneExtentOf(count));
+
+  std::vector<TIndex> indices;
+  for (auto _ : state)
+  {
+    indices.clear();
+    bvh.GetVisibleIndices(frustum, indices);
+    benchmark::DoNotOptimize(indices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Same culling of `BM_BvhVisibleIndices` by testing bounds of all shapes, as baseline.
+void BM_LinearVisibleIndices(benchmark::State& state)
+{
+  const auto count  = static_cast<TIndex>(state.range(0));
+  const auto frustum = GetPerspectiveFrustum(GetSceneExtentOf(count));
+  std::vector<DBounds3D<TF32>> bounds;
+  for (const auto& shape : GetBvhShapes(count))
+  {
+    bounds.emplace_back(std::visit([](const auto& item) { return GetDBounds3DOf(item); }, shape));
+  }
+
+  std::vector<TIndex> indices;
+  for (auto _ : state)
+  {
+    indices.clear();
+    for (TIndex i = 0; i < count; ++i)
+    {
+      if (frustum.IsVisible(bounds[i]) == true) { indices.emplace_back(i); }
+    }
+    benchmark::DoNotOptimize(indices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Move all bounds of DDynamicBoundsTree a bit, and find overlapped pairs. (One frame of broadphase)
+void BM_DynamicTreeMoveAndPairs(benchmark::State& state)
+{
+  const auto count  = static_cast<TIndex>(state.range(0));
+  const auto extent = GetSceneExtentOf(count);
+
+  DDynamicBoundsTree<TF32> tree{0.2f};
+  std::vector<DDynamicBoundsTree<TF32>::THandle> handles;
+  std::vector<DVector3<TF32>> velocities;
+  for (TIndex i = 0; i < count; ++i)
+  {
+    const auto origin = GetRandomVector3(-extent, extent);
+    const auto length = GetRandomVector3(0.2f, 1);
+    handles.emplace_back(tree.Insert({origin - length, origin + length}));
+    velocities.emplace_back(GetRandomVector3(-0.05f, 0.05f));
+  }
+
+  std::vector<std::pair<DDynamicBoundsTree<TF32>::THandle, DDynamicBoundsTree<TF32>::THandle>> pairs;
+  TIndex frame = 0;
+  for (auto _ : state)
+  {
+    // Turn back every 64 frames, so shapes stay in the scene.
+    const TF32 direction = (frame++ / 64) % 2 == 0 ? 1.0f : -1.0f;
+    for (TIndex i = 0; i < count; ++i) { tree.MoveBy(handles[i], velocities[i] * direction); }
+
+    pairs.clear();
+    tree.GetOverlappedPairs(pairs);
+    benchmark::DoNotOptimize(pairs.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(BM_BvhBuild)
+  ->ArgNames({"shapes", "method", "threads"})
+  ->Apply(SetBvhBuildArguments)
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+BENCHMARK(BM_BvhClosestHit)
+  ->ArgNames({"shapes", "method"})
+  ->ArgsProduct({{1 << 10, 1 << 14, 1 << 17}, {0, 1}})
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_LinearClosestHit)
+  ->ArgNames({"shapes"})
+  ->Arg(1 << 10)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BvhVisibleIndices)
+  ->ArgNames({"shapes"})
+  ->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 17)
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_LinearVisibleIndices)
+  ->ArgNames({"shapes"})
+  ->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 17)
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DynamicTreeMoveAndPairs)
+  ->ArgNames({"shapes"})
+  ->Arg(1 << 10)->Arg(1 << 14)
+  ->Unit(benchmark::kMicrosecond);
+
+} /// ::dy::math::bench namespace
@@ -0,0 +1,110 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#ifdef MATH_ENABLE_UUID
+#include <unordered_map>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <Math/Type/Micellanous/DUuid.h>
+#include "XBenchmarkHelper.h"
+
+//!
+//! DUuid benchmarks. Built only when boost is found, because generation and parsing of DUuid use boost.
+//! First argument of map benchmarks is the number of keys.
+//!
+
+namespace dy::math::bench
+{
+
+/// @brief Get `count` new uuids.
+std::vector<DUuid> GetUuids(TIndex count)
+{
+  std::vector<DUuid> result;
+  result.reserve(count);
+  for (TIndex i = 0; i < count; ++i) { result.push_back(CreateUuid()); }
+  return result;
+}
+
+/// @brief Copy `kDataCount` uuids into other vector.
+void BM_UuidCopy(benchmark::State& state)
+{
+  const auto uuids = GetUuids(kDataCount);
+  std::vector<DUuid> copied = uuids;
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { copied[i] = uuids[i]; }
+    benchmark::DoNotOptimize(copied.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Hash `kDataCount` uuids.
+void BM_UuidHash(benchmark::State& state)
+{
+  const auto uuids = GetUuids(kDataCount);
+  for (auto _ : state)
+  {
+    std::size_t sum = 0;
+    for (const auto& uuid : uuids) { sum += std::hash<DUuid>{}(uuid); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Insert all keys into empty `std::unordered_map`.
+void BM_UuidMapInsert(benchmark::State& state)
+{
+  const auto uuids = GetUuids(static_cast<TIndex>(state.range(0)));
+  for (auto _ : state)
+  {
+    std::unordered_map<DUuid, TU32> map;
+    for (TIndex i = 0, size = uuids.size(); i < size; ++i) { map.emplace(uuids[i], TU32(i)); }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * uuids.size());
+}
+
+/// @brief Find `kDataCount` keys, which are half existing and half missing, in `std::unordered_map`.
+void BM_UuidMapFind(benchmark::State& state)
+{
+  const auto uuids = GetUuids(static_cast<TIndex>(state.range(0)));
+  std::unordered_map<DUuid, TU32> map;
+  for (TIndex i = 0, size = uuids.size(); i < size; ++i) { map.emplace(uuids[i], TU32(i)); }
+
+  auto queries = GetUuids(kDataCount);
+  for (TIndex i = 0; i < kDataCount; i += 2) { queries[i] = uuids[GetEngine()() % uuids.size()]; }
+
+  for (auto _ : state)
+  {
+    TU32 sum = 0;
+    for (const auto& query : queries)
+    {
+      if (const auto it = map.find(query); it != map.end()) { sum += it->second; }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+BENCHMARK(BM_UuidCopy);
+BENCHMARK(BM_UuidHash);
+BENCHMARK(BM_UuidMapInsert)
+  ->ArgNames({"keys"})
+  ->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_UuidMapFind)
+  ->ArgNames({"keys"})
+  ->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+
+} /// ::dy::math::bench namespace
+#endif /// MATH_ENABLE_UUID
@@ -0,0 +1,212 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <benchmark/benchmark.h>
+#include <Math/Type/Math/DVector3Stream.h>
+#include <Math/Type/Math/DVector4Stream.h>
+#include <Math/Utility/XLinearMath.h>
+#include <Math/Utility/XMath.h>
+#include <Math/Utility/XStreamMath.h>
+#include "XBenchmarkHelper.h"
+
+//!
+//! Vector benchmarks. Each iteration processes `kDataCount` vectors.
+//! DVector4<TF32> and DVector4<TI32> use SIMD in `DyMathBenchmarksSimd`.
+//!
+
+namespace dy::math::bench
+{
+
+template <typename TVector>
+std::vector<TVector> GetVectors();
+
+template <>
+std::vector<DVector3<TF32>> GetVectors()
+{
+  std::vector<DVector3<TF32>> result;
+  for (TIndex i = 0; i < kDataCount; ++i) { result.emplace_back(GetRandomVector3(-100, 100)); }
+  return result;
+}
+
+template <>
+std::vector<DVector4<TF32>> GetVectors()
+{
+  std::vector<DVector4<TF32>> result;
+  for (TIndex i = 0; i < kDataCount; ++i) { result.emplace_back(GetRandomVector4(-100, 100)); }
+  return result;
+}
+
+template <>
+std::vector<DVector4<TI32>> GetVectors()
+{
+  std::vector<DVector4<TI32>> result;
+  std::uniform_int_distribution<TI32> distribution{-100, 100};
+  for (TIndex i = 0; i < kDataCount; ++i)
+  {
+    auto& engine = GetEngine();
+    result.emplace_back(distribution(engine), distribution(engine), distribution(engine), distribution(engine));
+  }
+  return result;
+}
+
+template <typename TVector>
+void BM_VectorAdd(benchmark::State& state)
+{
+  const auto lhs = GetVectors<TVector>();
+  const auto rhs = GetVectors<TVector>();
+  std::vector<TVector> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = lhs[i] + rhs[i]; }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TVector>
+void BM_VectorMultiply(benchmark::State& state)
+{
+  const auto lhs = GetVectors<TVector>();
+  const auto rhs = GetVectors<TVector>();
+  std::vector<TVector> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = lhs[i] * rhs[i]; }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TVector>
+void BM_VectorDot(benchmark::State& state)
+{
+  const auto lhs = GetVectors<TVector>();
+  const auto rhs = GetVectors<TVector>();
+  for (auto _ : state)
+  {
+    TReal sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { sum += Dot(lhs[i], rhs[i]); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TVector>
+void BM_VectorNormalize(benchmark::State& state)
+{
+  const auto values = GetVectors<TVector>();
+  std::vector<TVector> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = values[i].Normalize(); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TVector>
+void BM_VectorLength(benchmark::State& state)
+{
+  const auto values = GetVectors<TVector>();
+  for (auto _ : state)
+  {
+    TReal sum = 0;
+    for (TIndex i = 0; i < kDataCount; ++i) { sum += values[i].GetLength(); }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+void BM_Vector3Cross(benchmark::State& state)
+{
+  const auto lhs = GetVectors<DVector3<TF32>>();
+  const auto rhs = GetVectors<DVector3<TF32>>();
+  std::vector<DVector3<TF32>> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = Cross(lhs[i], rhs[i]); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+template <typename TVector>
+void BM_VectorExtractMin(benchmark::State& state)
+{
+  const auto lhs = GetVectors<TVector>();
+  const auto rhs = GetVectors<TVector>();
+  std::vector<TVector> result(kDataCount);
+  for (auto _ : state)
+  {
+    for (TIndex i = 0; i < kDataCount; ++i) { result[i] = ExtractMin(lhs[i], rhs[i]); }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Same dot products of `BM_VectorDot<DVector3<TF32>>` with SoA stream.
+void BM_Vector3StreamDot(benchmark::State& state)
+{
+  const auto lhsValues = GetVectors<DVector3<TF32>>();
+  const auto rhsValues = GetVectors<DVector3<TF32>>();
+  const DVector3Stream<TF32> lhs{lhsValues.data(), kDataCount};
+  const DVector3Stream<TF32> rhs{rhsValues.data(), kDataCount};
+  std::vector<TF32> result(kDataCount);
+  for (auto _ : state)
+  {
+    Dot(lhs, rhs, result.data());
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+/// @brief Same normalization of `BM_VectorNormalize<DVector3<TF32>>` with SoA stream.
+void BM_Vector3StreamNormalize(benchmark::State& state)
+{
+  const auto inputs = GetVectors<DVector3<TF32>>();
+  const DVector3Stream<TF32> values{inputs.data(), kDataCount};
+  DVector3Stream<TF32> result;
+  for (auto _ : state)
+  {
+    Normalize(values, result);
+    benchmark::DoNotOptimize(result.GetPlane(0));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kDataCount);
+}
+
+BENCHMARK_TEMPLATE(BM_VectorAdd, DVector3<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorAdd, DVector4<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorAdd, DVector4<TI32>);
+BENCHMARK_TEMPLATE(BM_VectorMultiply, DVector3<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorMultiply, DVector4<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorMultiply, DVector4<TI32>);
+BENCHMARK_TEMPLATE(BM_VectorDot, DVector3<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorDot, DVector4<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorNormalize, DVector3<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorNormalize, DVector4<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorLength, DVector3<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorLength, DVector4<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorExtractMin, DVector3<TF32>);
+BENCHMARK_TEMPLATE(BM_VectorExtractMin, DVector4<TF32>);
+BENCHMARK(BM_Vector3Cross);
+BENCHMARK(BM_Vector3StreamDot);
+BENCHMARK(BM_Vector3StreamNormalize);
+
+} /// ::dy::math::bench namespace
@@ -0,0 +1,85 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <random>
+#include <vector>
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Type/Math/DVector3.h>
+#include <Math/Type/Math/DVector4.h>
+#include <Math/Type/Shape/DFrustum.h>
+#include <Math/Type/Shape/DRay.h>
+
+namespace dy::math::bench
+{
+
+/// @brief The number of elements of input data of each benchmark.
+/// Power of 2, so index can be wrapped with `kDataMask`.
+constexpr TIndex kDataCount = 1024;
+constexpr TIndex kDataMask  = kDataCount - 1;
+
+/// @brief Get random engine with fixed seed, so every run and every binary uses same inputs.
+inline std::mt19937& GetEngine() noexcept
+{
+  static std::mt19937 engine{20190101};
+  return engine;
+}
+
+/// @brief Get uniform random real value in [start, end).
+inline TF32 GetRandom(TF32 start, TF32 end)
+{
+  return std::uniform_real_distribution<TF32>{start, end}(GetEngine());
+}
+
+/// @brief Get random vector whose elements are in [start, end).
+inline DVector3<TF32> GetRandomVector3(TF32 start, TF32 end)
+{
+  return {GetRandom(start, end), GetRandom(start, end), GetRandom(start, end)};
+}
+
+/// @brief Get random vector whose elements are in [start, end).
+inline DVector4<TF32> GetRandomVector4(TF32 start, TF32 end)
+{
+  return {GetRandom(start, end), GetRandom(start, end), GetRandom(start, end), GetRandom(start, end)};
+}
+
+/// @brief Get `count` rays, whose origins are in [-extent, extent) and aim around origin.
+inline std::vector<DRay<TF32>> GetRandomRays(TIndex count, TF32 extent)
+{
+  std::vector<DRay<TF32>> result;
+  result.reserve(count);
+  for (TIndex i = 0; i < count; ++i)
+  {
+    const auto origin = GetRandomVector3(-extent, extent);
+    const auto target = GetRandomVector3(-extent * TF32(0.1), extent * TF32(0.1));
+    result.emplace_back(origin, target - origin);
+  }
+  return result;
+}
+
+/// @brief Get OpenGL perspective frustum of camera at origin looking -Z. (fov Y 60, aspect 16 : 9, near 0.1)
+inline DFrustum<TF32> GetPerspectiveFrustum(TF32 far)
+{
+  const TF32 near = 0.1f;
+  const TF32 y = 1.0f / std::tan(0.5236f);
+  const TF32 x = y * 9.0f / 16.0f;
+  return DFrustum<TF32>{DMatrix4<TF32, EMatMajor::Column>
+  {
+    x, 0, 0, 0,
+    0, y, 0, 0,
+    0, 0, -(far + near) / (far - near), -2 * far * near / (far - near),
+    0, 0, -1, 0
+  }};
+}
+
+} /// ::dy::math::bench namespace
@@ -0,0 +1,37 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <benchmark/benchmark.h>
+#include <Math/Common/XSimdDispatch.h>
+
+int main(int argc, char** argv)
+{
+  // Build configuration is written into "context" of JSON output,
+  // so results of scalar and SIMD binaries can be told apart when diffed.
+#if defined(MATH_ENABLE_SIMD_DISPATCH)
+  benchmark::AddCustomContext("dymath_simd", "DISPATCH");
+#elif defined(MATH_ENABLE_SIMD)
+  benchmark::AddCustomContext("dymath_simd", "ON");
+#else
+  benchmark::AddCustomContext("dymath_simd", "OFF");
+#endif
+  // Instruction set of SIMD kernels, which is selected in run-time with dispatch.
+  benchmark::AddCustomContext("dymath_isa", dy::math::GetNameOf(dy::math::GetSelectedSimdIsa()));
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv) == true) { return 1; }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,79 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <Math/Type/Math/DVector2.h>
+#include <Math/Type/Math/DVector3.h>
+#include <Math/Type/Math/DVector4.h>
+#include <Math/Type/Math/DMatrix2.h>
+#include <Math/Type/Math/DMatrix3.h>
+#include <Math/Type/Math/DMatrix4.h>
+#include <Math/Type/Math/DQuat.h>
+
+//!
+//! Compile-time checks of constexpr core. This file has no run-time code,
+//! and is built into each benchmark binary to check scalar, SIMD and dispatch builds.
+//!
+
+namespace dy::math::bench
+{
+
+static_assert(DVector2<TI32>{1, 2} + DVector2<TI32>{3} == DVector2<TI32>{4, 5});
+static_assert(DVector2<TF64>{1, 2} * 2.0 - DVector2<TF64>{1, 1} == DVector2<TF64>{1, 3});
+static_assert(DVector2<TF64>{4, 6} / DVector2<TF64>{2, 3} == DVector2<TF64>{2, 2});
+static_assert(DVector2<TI32>{1, 2}[1] == 2);
+
+static_assert(DVector3<TI32>{1, 2, 3} + DVector3<TI32>{1} == DVector3<TI32>{2, 3, 4});
+static_assert(DVector3<TF64>{1, 2, 3} * 2.0 - DVector3<TF64>::UnitX() == DVector3<TF64>{1, 4, 6});
+static_assert(DVector3<TF64>{DVector2<TF64>{1, 2}}[2] == 0.0);
+static_assert(static_cast<DVector3<TI32>>(DVector3<TF64>{1.5, 2.5, 3.5}) == DVector3<TI32>{1, 2, 3});
+
+// DVector4<TF32>, DVector4<TF64> and DVector4<TI32> may use SIMD functions, which are not constexpr.
+static_assert(DVector4<TI64>{1, 2, 3, 4} + DVector4<TI64>{1} == DVector4<TI64>{2, 3, 4, 5});
+static_assert(DVector4<TI64>{1, 2, 3, 4} * TI64(2) != DVector4<TI64>{2, 4, 6, 9});
+static_assert(DVector4<TI64>{DVector3<TI64>{1, 2, 3}, 1}.W == 1);
+static_assert(static_cast<DVector3<TI64>>(DVector4<TI64>{1, 2, 3, 4}) == DVector3<TI64>{1, 2, 3});
+
+static_assert(DMatrix2<TF64, EMatMajor::Column>::Identity().GetDeterminant() == 1.0);
+static_assert(DMatrix2<TF64, EMatMajor::Column>{1, 2, 3, 4}.GetDeterminant() == -2.0);
+static_assert(DMatrix2<TF64, EMatMajor::Row>{1, 2, 3, 4}.Transpose()[0] == DVector2<TF64>{1, 3});
+static_assert(
+  DMatrix2<TF64, EMatMajor::Column>{1, 2, 3, 4}.Inverse() * DMatrix2<TF64, EMatMajor::Column>{1, 2, 3, 4}
+  == DMatrix2<TF64, EMatMajor::Column>::Identity());
+
+static_assert(DMatrix3<TF64, EMatMajor::Column>::Identity().GetDeterminant() == 1.0);
+static_assert(DMatrix3<TF64, EMatMajor::Column>{2, 0, 0, 0, 3, 0, 1, 0, 4}.GetDeterminant() == 24.0);
+static_assert(
+  DMatrix3<TF64, EMatMajor::Column>{2, 0, 0, 0, 3, 0, 1, 0, 4} * DVector3<TF64>{1, 1, 1}
+  == DVector3<TF64>{2, 3, 5});
+static_assert(
+  DMatrix3<TF64, EMatMajor::Row>{2, 0, 0, 0, 3, 0, 1, 0, 4}.Transpose().ConvertToColumnMatrix()
+  == DMatrix3<TF64, EMatMajor::Column>{2, 0, 1, 0, 3, 0, 0, 0, 4});
+
+// DMatrix4 only supports real types, and both of DMatrix4<TF32> and DMatrix4<TF64> use SIMD functions,
+// which are not constexpr, with AVX2. So scalar functions checked here are not used by any type in that build.
+#if !defined(MATH_ENABLE_SIMD) || !defined(__AVX2__)
+static_assert(DMatrix4<TF64, EMatMajor::Column>::Identity().GetDeterminant() == 1.0);
+static_assert(DMatrix4<TF64, EMatMajor::Row>::Identity().Transpose() == DMatrix4<TF64, EMatMajor::Row>::Identity());
+static_assert(
+  DMatrix4<TF64, EMatMajor::Column>{2, 0, 0, 1, 0, 4, 0, 2, 0, 0, 8, 3, 0, 0, 0, 1}.GetDeterminant() == 64.0);
+static_assert(
+  DMatrix4<TF64, EMatMajor::Column>{2, 0, 0, 1, 0, 4, 0, 2, 0, 0, 8, 3, 0, 0, 0, 1}.Inverse()
+  * DMatrix4<TF64, EMatMajor::Column>{2, 0, 0, 1, 0, 4, 0, 2, 0, 0, 8, 3, 0, 0, 0, 1}
+  == DMatrix4<TF64, EMatMajor::Column>::Identity());
+static_assert(
+  DQuaternion<TF64>{}.ToMatrix4<EMatMajor::Row>() == DMatrix4<TF64, EMatMajor::Row>::Identity());
+#endif
+static_assert(
+  (DQuaternion<TF64>{} * DQuaternion<TF64>{0, 0.6, 0, 0.8}).Y() == 0.6);
+
+} /// ::dy::math::bench namespace
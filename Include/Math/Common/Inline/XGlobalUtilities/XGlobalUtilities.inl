@@ -16,7 +16,7 @@ namespace dy::math
 {
 
 template <typename TTargetType, typename TSourceType>
-TTargetType Cast(TSourceType iValue)
+constexpr TTargetType Cast(TSourceType iValue)
 {
   return static_cast<TTargetType>(iValue);
 }
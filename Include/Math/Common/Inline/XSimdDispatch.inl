@@ -0,0 +1,198 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <atomic>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace dy::math::details
+{
+
+/// @brief Instruction set that compile flags enable for SIMD kernels.
+constexpr ESimdIsa kCompiledSimdIsa =
+#if !defined(MATH_ENABLE_SIMD)
+  ESimdIsa::Scalar;
+#elif defined(__AVX512F__)
+  ESimdIsa::AVX512;
+#elif defined(__AVX2__)
+  ESimdIsa::AVX2;
+#elif defined(__AVX__)
+  ESimdIsa::AVX;
+#else
+  ESimdIsa::SSE41;
+#endif
+
+/// @brief Get storage of selected instruction set. Selected from CPUID at first call.
+inline std::atomic<ESimdIsa>& GetSelectedSimdIsaStorage() noexcept
+{
+  static std::atomic<ESimdIsa> isa{GetSupportedSimdIsa()};
+  return isa;
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+inline ESimdIsa GetSupportedSimdIsa() noexcept
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  // libgcc also checks XCR0, so AVX and AVX-512 are reported only when OS saves their registers.
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) { return ESimdIsa::AVX512; }
+  if (__builtin_cpu_supports("avx2"))    { return ESimdIsa::AVX2; }
+  if (__builtin_cpu_supports("avx"))     { return ESimdIsa::AVX; }
+  if (__builtin_cpu_supports("sse4.1"))  { return ESimdIsa::SSE41; }
+  if (__builtin_cpu_supports("sse2"))    { return ESimdIsa::SSE2; }
+  return ESimdIsa::Scalar;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  int info[4] = {};
+  __cpuid(info, 0);
+  const int maxLeaf = info[0];
+
+  __cpuid(info, 1);
+  const bool hasSse2  = (info[3] & (1 << 26)) != 0;
+  const bool hasSse41 = (info[2] & (1 << 19)) != 0;
+  const bool hasAvx   = (info[2] & (1 << 28)) != 0;
+  // OS must save YMM (and ZMM) registers on context switch, which is reported by XCR0.
+  const bool hasOsXsave = (info[2] & (1 << 27)) != 0;
+  const unsigned long long xcr0 = hasOsXsave == true ? _xgetbv(0) : 0;
+  const bool isYmmSaved = (xcr0 & 0x06) == 0x06;
+  const bool isZmmSaved = (xcr0 & 0xE6) == 0xE6;
+
+  int extended = 0;
+  if (maxLeaf >= 7) { __cpuidex(info, 7, 0); extended = info[1]; }
+  const bool hasAvx2   = (extended & (1 << 5)) != 0;
+  const bool hasAvx512 = (extended & (1 << 16)) != 0;
+
+  if (hasAvx && isYmmSaved)
+  {
+    if (hasAvx512 && isZmmSaved) { return ESimdIsa::AVX512; }
+    if (hasAvx2)                 { return ESimdIsa::AVX2; }
+    return ESimdIsa::AVX;
+  }
+  if (hasSse41) { return ESimdIsa::SSE41; }
+  if (hasSse2)  { return ESimdIsa::SSE2; }
+  return ESimdIsa::Scalar;
+#else
+  return ESimdIsa::Scalar;
+#endif
+}
+
+inline ESimdIsa GetSelectedSimdIsa() noexcept
+{
+#ifdef MATH_SIMD_DISPATCH
+  return details::GetSelectedSimdIsaStorage().load(std::memory_order_relaxed);
+#else
+  return details::kCompiledSimdIsa;
+#endif
+}
+
+inline ESimdIsa SetSimdIsaLimit(ESimdIsa isa) noexcept
+{
+#ifdef MATH_SIMD_DISPATCH
+  const auto supported = GetSupportedSimdIsa();
+  const auto selected  = isa < supported ? isa : supported;
+  details::GetSelectedSimdIsaStorage().store(selected, std::memory_order_relaxed);
+  return selected;
+#else
+  (void)isa;
+  return details::kCompiledSimdIsa;
+#endif
+}
+
+inline const char* GetNameOf(ESimdIsa isa) noexcept
+{
+  switch (isa)
+  {
+  case ESimdIsa::Scalar: return "Scalar";
+  case ESimdIsa::SSE2:   return "SSE2";
+  case ESimdIsa::SSE41:  return "SSE4.1";
+  case ESimdIsa::AVX:    return "AVX";
+  case ESimdIsa::AVX2:   return "AVX2";
+  case ESimdIsa::AVX512: return "AVX-512";
+  }
+  return "Unknown";
+}
+
+} /// ::dy::math namespace
+
+MATH_SIMD_KERNEL_REGION_BEGIN
+
+#ifdef MATH_SIMD_KERNELS
+namespace dy::math::details
+{
+
+/// @brief Check `TSimd` can split `TLanes` lanes. 0 means any lane count.
+template <typename TSimd, TIndex TLanes>
+constexpr bool kCanSplitLanesBy = TLanes == 0 || TLanes % TSimd::kLanes == 0;
+
+#ifdef MATH_SIMD_DISPATCH
+//! Each function is compiled with its target, and inlines `function` and kernels called by it.
+
+template <typename TFunction>
+MATH_SIMD_TARGET("avx512f") MATH_SIMD_FLATTEN void CallSimdOfAvx512(TFunction& function) { function(TSimdF32x16{}); }
+template <typename TFunction>
+MATH_SIMD_TARGET("avx2") MATH_SIMD_FLATTEN void CallSimdOfAvx2(TFunction& function) { function(TSimdF32x8{}); }
+template <typename TFunction>
+MATH_SIMD_TARGET("avx") MATH_SIMD_FLATTEN void CallSimdOfAvx(TFunction& function) { function(TSimdF32x8{}); }
+template <typename TFunction>
+MATH_SIMD_TARGET("sse4.1") MATH_SIMD_FLATTEN void CallSimdOfSse41(TFunction& function) { function(TSimdF32x4{}); }
+template <typename TFunction>
+MATH_SIMD_TARGET("sse2") MATH_SIMD_FLATTEN void CallSimdOfSse2(TFunction& function) { function(TSimdF32x4Sse2{}); }
+#endif /// MATH_SIMD_DISPATCH
+
+template <TIndex TLanes, typename TFunction>
+bool DispatchSimdF32(TFunction&& function)
+{
+#ifdef MATH_SIMD_DISPATCH
+  // Fall through to narrower instruction set when lane count does not fit.
+  switch (GetSelectedSimdIsa())
+  {
+  case ESimdIsa::AVX512:
+    if constexpr (kCanSplitLanesBy<TSimdF32x16, TLanes> == true) { CallSimdOfAvx512(function); return true; }
+    [[fallthrough]];
+  case ESimdIsa::AVX2:
+    if constexpr (kCanSplitLanesBy<TSimdF32x8, TLanes> == true) { CallSimdOfAvx2(function); return true; }
+    [[fallthrough]];
+  case ESimdIsa::AVX:
+    if constexpr (kCanSplitLanesBy<TSimdF32x8, TLanes> == true) { CallSimdOfAvx(function); return true; }
+    [[fallthrough]];
+  case ESimdIsa::SSE41:
+    CallSimdOfSse41(function);
+    return true;
+  case ESimdIsa::SSE2:
+    CallSimdOfSse2(function);
+    return true;
+  case ESimdIsa::Scalar:
+  default:
+    return false;
+  }
+#else
+#if defined(__AVX512F__)
+  if constexpr (kCanSplitLanesBy<TSimdF32x16, TLanes> == true) { function(TSimdF32x16{}); return true; }
+#endif
+#if defined(__AVX__)
+  if constexpr (kCanSplitLanesBy<TSimdF32x8, TLanes> == true) { function(TSimdF32x8{}); return true; }
+#endif
+  function(TSimdF32x4{});
+  return true;
+#endif
+}
+
+} /// ::dy::math::details namespace
+#endif /// MATH_SIMD_KERNELS
+
+MATH_SIMD_KERNEL_REGION_END
@@ -0,0 +1,363 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <Math/Common/TGlobalTypes.h>
+
+//!
+//! SIMD kernels of bulk functions (streams, ray packets, batch solvers) are compiled when
+//! `MATH_ENABLE_SIMD` is defined, with instruction sets of compile flags.
+//! When `MATH_ENABLE_SIMD_DISPATCH` is defined instead (or together), kernels are compiled
+//! for SSE2, SSE4.1, AVX, AVX2 and AVX-512 with function target attributes,
+//! and one of them is selected at run-time from CPUID. See XSimdDispatch.h.
+//!
+
+#if defined(MATH_ENABLE_SIMD_DISPATCH) \
+  && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+/// @macro MATH_SIMD_DISPATCH
+/// @brief Defined when run-time dispatch of SIMD kernels is available on this target.
+#define MATH_SIMD_DISPATCH
+#endif
+
+#if defined(MATH_ENABLE_SIMD) || defined(MATH_SIMD_DISPATCH)
+/// @macro MATH_SIMD_KERNELS
+/// @brief Defined when SIMD kernels of bulk functions are compiled.
+#define MATH_SIMD_KERNELS
+#endif
+
+#if defined(MATH_SIMD_DISPATCH) && (defined(__GNUC__) || defined(__clang__))
+/// @macro MATH_SIMD_TARGET
+/// @brief Compile function with given instruction set, regardless of compile flags.
+#define MATH_SIMD_TARGET(__MATarget__) __attribute__((target(__MATarget__)))
+/// @macro MATH_SIMD_INLINE
+/// @brief Force kernel function and lambda to be inlined into dispatched function of each instruction set.
+/// Kernel code has no target attribute, so it must not be called as out-of-line function
+/// (Passing `__m256` and `__m512` between functions of different target changes the ABI.)
+#define MATH_SIMD_INLINE __attribute__((always_inline))
+/// @macro MATH_SIMD_FLATTEN
+/// @brief Inline all calls of dispatched function, so kernels are compiled with its target.
+#define MATH_SIMD_FLATTEN __attribute__((flatten))
+#else
+#define MATH_SIMD_TARGET(__MATarget__)
+#define MATH_SIMD_INLINE
+#define MATH_SIMD_FLATTEN
+#endif
+
+#if defined(MATH_SIMD_DISPATCH) && defined(__GNUC__) && !defined(__clang__)
+/// @macro MATH_SIMD_KERNEL_REGION_BEGIN
+/// @brief Begin region of kernels, which is closed by `MATH_SIMD_KERNEL_REGION_END`.
+/// GCC warns that `__m256` and `__m512` arguments change the ABI without AVX, for each kernel instantiation.
+/// Kernels are always inlined into dispatched function of its target, so the warning is disabled in the region.
+/// Each file which defines or calls kernels is enclosed by the region, so the warning is not disabled for other code.
+/// (GCC reports some warnings of deferred instantiation at the location of user code,
+/// so CMake adds `-Wno-psabi` to targets which enable `MATH_ENABLE_SIMD_DISPATCH` with GCC.)
+#define MATH_SIMD_KERNEL_REGION_BEGIN \
+  _Pragma("GCC diagnostic push") \
+  _Pragma("GCC diagnostic ignored \"-Wpsabi\"")
+/// @macro MATH_SIMD_KERNEL_REGION_END
+/// @brief End region of kernels which is opened by `MATH_SIMD_KERNEL_REGION_BEGIN`.
+#define MATH_SIMD_KERNEL_REGION_END _Pragma("GCC diagnostic pop")
+#else
+#define MATH_SIMD_KERNEL_REGION_BEGIN
+#define MATH_SIMD_KERNEL_REGION_END
+#endif
+
+MATH_SIMD_KERNEL_REGION_BEGIN
+
+#include <cmath>
+
+namespace dy::math
+{
+
+/// @struct TSimdScalar
+/// @brief One-lane wrapper which has same interface of SIMD wrappers, with plain scalar operations.
+/// Kernels written for SIMD wrappers can be called with this for remained values or when SIMD is disabled,
+/// and give same result of each lane of SIMD version. Mask is `bool`.
+template <typename TType>
+struct TSimdScalar final
+{
+  using TValueType = TType;
+  using TReg  = TType;
+  using TMask = bool;
+  static constexpr TIndex kLanes = 1;
+
+  static TReg Load(const TType* iPtr) noexcept { return *iPtr; }
+  static TReg LoadU(const TType* iPtr) noexcept { return *iPtr; }
+  static void Store(TType* oPtr, TReg iValue) noexcept { *oPtr = iValue; }
+  static void StoreU(TType* oPtr, TReg iValue) noexcept { *oPtr = iValue; }
+  static TReg Set1(TType iValue) noexcept { return iValue; }
+
+  static TReg Add(TReg lhs, TReg rhs) noexcept { return lhs + rhs; }
+  static TReg Sub(TReg lhs, TReg rhs) noexcept { return lhs - rhs; }
+  static TReg Mul(TReg lhs, TReg rhs) noexcept { return lhs * rhs; }
+  static TReg Div(TReg lhs, TReg rhs) noexcept { return lhs / rhs; }
+  static TReg Sqrt(TReg value) noexcept { return std::sqrt(value); }
+  static TReg Neg(TReg value) noexcept { return -value; }
+  static TReg Abs(TReg value) noexcept { return std::abs(value); }
+  /// @brief Return `lhs < rhs ? lhs : rhs`, as SIMD wrappers.
+  static TReg Min(TReg lhs, TReg rhs) noexcept { return lhs < rhs ? lhs : rhs; }
+  /// @brief Return `lhs > rhs ? lhs : rhs`, as SIMD wrappers.
+  static TReg Max(TReg lhs, TReg rhs) noexcept { return lhs > rhs ? lhs : rhs; }
+
+  static TMask CmpLt(TReg lhs, TReg rhs) noexcept { return lhs < rhs; }
+  static TMask CmpLe(TReg lhs, TReg rhs) noexcept { return lhs <= rhs; }
+  static TMask CmpGt(TReg lhs, TReg rhs) noexcept { return lhs > rhs; }
+  static TMask CmpGe(TReg lhs, TReg rhs) noexcept { return lhs >= rhs; }
+  static TMask CmpNeq(TReg lhs, TReg rhs) noexcept { return lhs != rhs; }
+
+  static TMask And(TMask lhs, TMask rhs) noexcept { return lhs && rhs; }
+  static TMask Or(TMask lhs, TMask rhs) noexcept { return lhs || rhs; }
+  /// @brief Return `!lhs && rhs`, as SIMD wrappers.
+  static TMask AndNot(TMask lhs, TMask rhs) noexcept { return !lhs && rhs; }
+  static TReg Select(TMask iMask, TReg iTrue, TReg iFalse) noexcept { return iMask ? iTrue : iFalse; }
+  static TU32 MoveMask(TMask iMask) noexcept { return iMask ? 1 : 0; }
+};
+
+} /// ::dy::math namespace
+
+#ifdef MATH_SIMD_KERNELS
+#include <emmintrin.h>
+#include <smmintrin.h>
+#if defined(__AVX__) || defined(MATH_SIMD_DISPATCH)
+#include <immintrin.h>
+#endif
+
+namespace dy::math
+{
+
+/// @struct TSimdF32x4Sse2
+/// @brief Thin wrapper of 4-lane `TF32` SSE2 intrinsics, for writing lane-width independent kernels.
+///
+/// Comparison helpers return lane masks, and Min / Max keep the operand order of intrinsics,
+/// so `std::min(a, b)` must be written as `Min(b, a)` to get same result of scalar code.
+struct TSimdF32x4Sse2
+{
+  using TValueType = TF32;
+  using TReg  = __m128;
+  using TMask = __m128;
+  static constexpr TIndex kLanes = 4;
+
+  MATH_SIMD_TARGET("sse2") static TReg Load(const TF32* iPtr) noexcept { return _mm_load_ps(iPtr); }
+  MATH_SIMD_TARGET("sse2") static TReg LoadU(const TF32* iPtr) noexcept { return _mm_loadu_ps(iPtr); }
+  MATH_SIMD_TARGET("sse2") static void Store(TF32* oPtr, TReg iValue) noexcept { _mm_store_ps(oPtr, iValue); }
+  MATH_SIMD_TARGET("sse2") static void StoreU(TF32* oPtr, TReg iValue) noexcept { _mm_storeu_ps(oPtr, iValue); }
+  MATH_SIMD_TARGET("sse2") static TReg Set1(TF32 iValue) noexcept { return _mm_set1_ps(iValue); }
+
+  MATH_SIMD_TARGET("sse2") static TReg Add(TReg lhs, TReg rhs) noexcept { return _mm_add_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("sse2") static TReg Sub(TReg lhs, TReg rhs) noexcept { return _mm_sub_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("sse2") static TReg Mul(TReg lhs, TReg rhs) noexcept { return _mm_mul_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("sse2") static TReg Div(TReg lhs, TReg rhs) noexcept { return _mm_div_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("sse2") static TReg Sqrt(TReg value) noexcept { return _mm_sqrt_ps(value); }
+  /// @brief Flip sign bit, same to unary `-value`.
+  MATH_SIMD_TARGET("sse2") static TReg Neg(TReg value) noexcept { return _mm_xor_ps(value, _mm_set1_ps(-0.0f)); }
+  /// @brief Clear sign bit.
+  MATH_SIMD_TARGET("sse2") static TReg Abs(TReg value) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), value); }
+  /// @brief Return `lhs < rhs ? lhs : rhs` per lane.
+  MATH_SIMD_TARGET("sse2") static TReg Min(TReg lhs, TReg rhs) noexcept { return _mm_min_ps(lhs, rhs); }
+  /// @brief Return `lhs > rhs ? lhs : rhs` per lane.
+  MATH_SIMD_TARGET("sse2") static TReg Max(TReg lhs, TReg rhs) noexcept { return _mm_max_ps(lhs, rhs); }
+
+  MATH_SIMD_TARGET("sse2") static TMask CmpLt(TReg lhs, TReg rhs) noexcept { return _mm_cmplt_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("sse2") static TMask CmpLe(TReg lhs, TReg rhs) noexcept { return _mm_cmple_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("sse2") static TMask CmpGt(TReg lhs, TReg rhs) noexcept { return _mm_cmpgt_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("sse2") static TMask CmpGe(TReg lhs, TReg rhs) noexcept { return _mm_cmpge_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("sse2") static TMask CmpNeq(TReg lhs, TReg rhs) noexcept { return _mm_cmpneq_ps(lhs, rhs); }
+
+  MATH_SIMD_TARGET("sse2") static TMask And(TMask lhs, TMask rhs) noexcept { return _mm_and_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("sse2") static TMask Or(TMask lhs, TMask rhs) noexcept { return _mm_or_ps(lhs, rhs); }
+  /// @brief Return `(~lhs) & rhs` per lane.
+  MATH_SIMD_TARGET("sse2") static TMask AndNot(TMask lhs, TMask rhs) noexcept { return _mm_andnot_ps(lhs, rhs); }
+  /// @brief Select `iTrue` lane when mask lane is set, otherwise `iFalse` lane.
+  MATH_SIMD_TARGET("sse2") static TReg Select(TMask iMask, TReg iTrue, TReg iFalse) noexcept
+  {
+    return _mm_or_ps(_mm_and_ps(iMask, iTrue), _mm_andnot_ps(iMask, iFalse));
+  }
+  /// @brief Get bit mask of lanes, lane `i` is bit `i`.
+  MATH_SIMD_TARGET("sse2") static TU32 MoveMask(TMask iMask) noexcept { return static_cast<TU32>(_mm_movemask_ps(iMask)); }
+
+  /// @brief Regard lane bits as `TI32`, and convert it to `TF32` value.
+  MATH_SIMD_TARGET("sse2") static TReg ConvertBitsToF32(TReg value) noexcept { return _mm_cvtepi32_ps(_mm_castps_si128(value)); }
+  /// @brief Convert lane value to `TI32` (round to nearest), and store it as lane bits.
+  MATH_SIMD_TARGET("sse2") static TReg ConvertF32ToBits(TReg value) noexcept { return _mm_castsi128_ps(_mm_cvtps_epi32(value)); }
+};
+
+/// @struct TSimdF32x4
+/// @brief Thin wrapper of 4-lane `TF32` SSE4.1 intrinsics. Same interface as TSimdF32x4Sse2.
+/// Lanes are selected with `blendv`, which uses only sign bit of mask lanes.
+struct TSimdF32x4 final : public TSimdF32x4Sse2
+{
+  /// @brief Select `iTrue` lane when mask lane is set, otherwise `iFalse` lane.
+  MATH_SIMD_TARGET("sse4.1") static TReg Select(TMask iMask, TReg iTrue, TReg iFalse) noexcept
+  {
+    return _mm_blendv_ps(iFalse, iTrue, iMask);
+  }
+};
+
+#if defined(__AVX__) || defined(MATH_SIMD_DISPATCH)
+/// @struct TSimdF32x8
+/// @brief Thin wrapper of 8-lane `TF32` AVX intrinsics. Same interface as TSimdF32x4.
+struct TSimdF32x8 final
+{
+  using TValueType = TF32;
+  using TReg  = __m256;
+  using TMask = __m256;
+  static constexpr TIndex kLanes = 8;
+
+  MATH_SIMD_TARGET("avx") static TReg Load(const TF32* iPtr) noexcept { return _mm256_load_ps(iPtr); }
+  MATH_SIMD_TARGET("avx") static TReg LoadU(const TF32* iPtr) noexcept { return _mm256_loadu_ps(iPtr); }
+  MATH_SIMD_TARGET("avx") static void Store(TF32* oPtr, TReg iValue) noexcept { _mm256_store_ps(oPtr, iValue); }
+  MATH_SIMD_TARGET("avx") static void StoreU(TF32* oPtr, TReg iValue) noexcept { _mm256_storeu_ps(oPtr, iValue); }
+  MATH_SIMD_TARGET("avx") static TReg Set1(TF32 iValue) noexcept { return _mm256_set1_ps(iValue); }
+
+  MATH_SIMD_TARGET("avx") static TReg Add(TReg lhs, TReg rhs) noexcept { return _mm256_add_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("avx") static TReg Sub(TReg lhs, TReg rhs) noexcept { return _mm256_sub_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("avx") static TReg Mul(TReg lhs, TReg rhs) noexcept { return _mm256_mul_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("avx") static TReg Div(TReg lhs, TReg rhs) noexcept { return _mm256_div_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("avx") static TReg Sqrt(TReg value) noexcept { return _mm256_sqrt_ps(value); }
+  /// @brief Flip sign bit, same to unary `-value`.
+  MATH_SIMD_TARGET("avx") static TReg Neg(TReg value) noexcept { return _mm256_xor_ps(value, _mm256_set1_ps(-0.0f)); }
+  /// @brief Clear sign bit.
+  MATH_SIMD_TARGET("avx") static TReg Abs(TReg value) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value); }
+  /// @brief Return `lhs < rhs ? lhs : rhs` per lane.
+  MATH_SIMD_TARGET("avx") static TReg Min(TReg lhs, TReg rhs) noexcept { return _mm256_min_ps(lhs, rhs); }
+  /// @brief Return `lhs > rhs ? lhs : rhs` per lane.
+  MATH_SIMD_TARGET("avx") static TReg Max(TReg lhs, TReg rhs) noexcept { return _mm256_max_ps(lhs, rhs); }
+
+  MATH_SIMD_TARGET("avx") static TMask CmpLt(TReg lhs, TReg rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ); }
+  MATH_SIMD_TARGET("avx") static TMask CmpLe(TReg lhs, TReg rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ); }
+  MATH_SIMD_TARGET("avx") static TMask CmpGt(TReg lhs, TReg rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ); }
+  MATH_SIMD_TARGET("avx") static TMask CmpGe(TReg lhs, TReg rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_GE_OQ); }
+  MATH_SIMD_TARGET("avx") static TMask CmpNeq(TReg lhs, TReg rhs) noexcept { return _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_UQ); }
+
+  MATH_SIMD_TARGET("avx") static TMask And(TMask lhs, TMask rhs) noexcept { return _mm256_and_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("avx") static TMask Or(TMask lhs, TMask rhs) noexcept { return _mm256_or_ps(lhs, rhs); }
+  /// @brief Return `(~lhs) & rhs` per lane.
+  MATH_SIMD_TARGET("avx") static TMask AndNot(TMask lhs, TMask rhs) noexcept { return _mm256_andnot_ps(lhs, rhs); }
+  /// @brief Select `iTrue` lane when mask lane is set, otherwise `iFalse` lane.
+  MATH_SIMD_TARGET("avx") static TReg Select(TMask iMask, TReg iTrue, TReg iFalse) noexcept { return _mm256_blendv_ps(iFalse, iTrue, iMask); }
+  /// @brief Get bit mask of lanes, lane `i` is bit `i`.
+  MATH_SIMD_TARGET("avx") static TU32 MoveMask(TMask iMask) noexcept { return static_cast<TU32>(_mm256_movemask_ps(iMask)); }
+
+  /// @brief Regard lane bits as `TI32`, and convert it to `TF32` value.
+  MATH_SIMD_TARGET("avx") static TReg ConvertBitsToF32(TReg value) noexcept { return _mm256_cvtepi32_ps(_mm256_castps_si256(value)); }
+  /// @brief Convert lane value to `TI32` (round to nearest), and store it as lane bits.
+  MATH_SIMD_TARGET("avx") static TReg ConvertF32ToBits(TReg value) noexcept { return _mm256_castsi256_ps(_mm256_cvtps_epi32(value)); }
+};
+#endif /// defined(__AVX__) || defined(MATH_SIMD_DISPATCH)
+
+#if defined(__AVX512F__) || defined(MATH_SIMD_DISPATCH)
+/// @struct TSimdF32x16
+/// @brief Thin wrapper of 16-lane `TF32` AVX-512F intrinsics. Same interface as TSimdF32x4.
+///
+/// Masks are kept as registers of all-set or all-clear lanes (not `__mmask16`),
+/// so kernels can mix masks and values with `And` as other wrappers do.
+/// Stream planes and packets are 32-byte aligned, so `Load` and `Store` do not require 64-byte alignment.
+///
+/// Unmasked `sqrt`, `min`, `max`, `andnot` and conversions of GCC pass `_mm512_undefined_*()` as merge source,
+/// and `-Wmaybe-uninitialized` is reported when they are inlined into kernels.
+/// So zero-masking variants with all lanes are used instead, which are compiled into same instructions.
+struct TSimdF32x16 final
+{
+  using TValueType = TF32;
+  using TReg  = __m512;
+  using TMask = __m512;
+  static constexpr TIndex kLanes = 16;
+
+  MATH_SIMD_TARGET("avx512f") static TReg Load(const TF32* iPtr) noexcept { return _mm512_loadu_ps(iPtr); }
+  MATH_SIMD_TARGET("avx512f") static TReg LoadU(const TF32* iPtr) noexcept { return _mm512_loadu_ps(iPtr); }
+  MATH_SIMD_TARGET("avx512f") static void Store(TF32* oPtr, TReg iValue) noexcept { _mm512_storeu_ps(oPtr, iValue); }
+  MATH_SIMD_TARGET("avx512f") static void StoreU(TF32* oPtr, TReg iValue) noexcept { _mm512_storeu_ps(oPtr, iValue); }
+  MATH_SIMD_TARGET("avx512f") static TReg Set1(TF32 iValue) noexcept { return _mm512_set1_ps(iValue); }
+
+  MATH_SIMD_TARGET("avx512f") static TReg Add(TReg lhs, TReg rhs) noexcept { return _mm512_add_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("avx512f") static TReg Sub(TReg lhs, TReg rhs) noexcept { return _mm512_sub_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("avx512f") static TReg Mul(TReg lhs, TReg rhs) noexcept { return _mm512_mul_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("avx512f") static TReg Div(TReg lhs, TReg rhs) noexcept { return _mm512_div_ps(lhs, rhs); }
+  MATH_SIMD_TARGET("avx512f") static TReg Sqrt(TReg value) noexcept { return _mm512_maskz_sqrt_ps(kAllLanes, value); }
+  /// @brief Flip sign bit, same to unary `-value`.
+  MATH_SIMD_TARGET("avx512f") static TReg Neg(TReg value) noexcept { return Xor(value, _mm512_set1_ps(-0.0f)); }
+  /// @brief Clear sign bit.
+  MATH_SIMD_TARGET("avx512f") static TReg Abs(TReg value) noexcept { return AndNot(_mm512_set1_ps(-0.0f), value); }
+  /// @brief Return `lhs < rhs ? lhs : rhs` per lane.
+  MATH_SIMD_TARGET("avx512f") static TReg Min(TReg lhs, TReg rhs) noexcept { return _mm512_maskz_min_ps(kAllLanes, lhs, rhs); }
+  /// @brief Return `lhs > rhs ? lhs : rhs` per lane.
+  MATH_SIMD_TARGET("avx512f") static TReg Max(TReg lhs, TReg rhs) noexcept { return _mm512_maskz_max_ps(kAllLanes, lhs, rhs); }
+
+  MATH_SIMD_TARGET("avx512f") static TMask CmpLt(TReg lhs, TReg rhs) noexcept { return ToMask(_mm512_cmp_ps_mask(lhs, rhs, _CMP_LT_OQ)); }
+  MATH_SIMD_TARGET("avx512f") static TMask CmpLe(TReg lhs, TReg rhs) noexcept { return ToMask(_mm512_cmp_ps_mask(lhs, rhs, _CMP_LE_OQ)); }
+  MATH_SIMD_TARGET("avx512f") static TMask CmpGt(TReg lhs, TReg rhs) noexcept { return ToMask(_mm512_cmp_ps_mask(lhs, rhs, _CMP_GT_OQ)); }
+  MATH_SIMD_TARGET("avx512f") static TMask CmpGe(TReg lhs, TReg rhs) noexcept { return ToMask(_mm512_cmp_ps_mask(lhs, rhs, _CMP_GE_OQ)); }
+  MATH_SIMD_TARGET("avx512f") static TMask CmpNeq(TReg lhs, TReg rhs) noexcept { return ToMask(_mm512_cmp_ps_mask(lhs, rhs, _CMP_NEQ_UQ)); }
+
+  MATH_SIMD_TARGET("avx512f") static TMask And(TMask lhs, TMask rhs) noexcept
+  {
+    return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+  }
+  MATH_SIMD_TARGET("avx512f") static TMask Or(TMask lhs, TMask rhs) noexcept
+  {
+    return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+  }
+  /// @brief Return `(~lhs) & rhs` per lane.
+  MATH_SIMD_TARGET("avx512f") static TMask AndNot(TMask lhs, TMask rhs) noexcept
+  {
+    return _mm512_castsi512_ps(_mm512_maskz_andnot_epi32(kAllLanes, _mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+  }
+  /// @brief Select `iTrue` lane when sign bit of mask lane is set, otherwise `iFalse` lane. (Same to `blendv`)
+  MATH_SIMD_TARGET("avx512f") static TReg Select(TMask iMask, TReg iTrue, TReg iFalse) noexcept
+  {
+    return _mm512_mask_blend_ps(GetSignBitsOf(iMask), iFalse, iTrue);
+  }
+  /// @brief Get bit mask of lanes, lane `i` is bit `i`.
+  MATH_SIMD_TARGET("avx512f") static TU32 MoveMask(TMask iMask) noexcept { return static_cast<TU32>(GetSignBitsOf(iMask)); }
+
+  /// @brief Regard lane bits as `TI32`, and convert it to `TF32` value.
+  MATH_SIMD_TARGET("avx512f") static TReg ConvertBitsToF32(TReg value) noexcept { return _mm512_maskz_cvtepi32_ps(kAllLanes, _mm512_castps_si512(value)); }
+  /// @brief Convert lane value to `TI32` (round to nearest), and store it as lane bits.
+  MATH_SIMD_TARGET("avx512f") static TReg ConvertF32ToBits(TReg value) noexcept { return _mm512_castsi512_ps(_mm512_maskz_cvtps_epi32(kAllLanes, value)); }
+
+private:
+  static constexpr __mmask16 kAllLanes = 0xFFFF;
+
+  MATH_SIMD_TARGET("avx512f") static TReg Xor(TReg lhs, TReg rhs) noexcept
+  {
+    return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+  }
+  /// @brief Expand `__mmask16` to all-set or all-clear lanes.
+  MATH_SIMD_TARGET("avx512f") static TMask ToMask(__mmask16 iMask) noexcept
+  {
+    return _mm512_castsi512_ps(_mm512_maskz_set1_epi32(iMask, -1));
+  }
+  /// @brief Get sign bits of lanes as `__mmask16`.
+  MATH_SIMD_TARGET("avx512f") static __mmask16 GetSignBitsOf(TMask iMask) noexcept
+  {
+    return _mm512_cmplt_epi32_mask(_mm512_castps_si512(iMask), _mm512_setzero_si512());
+  }
+};
+#endif /// defined(__AVX512F__) || defined(MATH_SIMD_DISPATCH)
+
+#ifdef MATH_ENABLE_SIMD
+/// @brief The widest `TF32` SIMD wrapper that can be used by compiled target.
+using TSimdF32 =
+#if defined(__AVX512F__)
+  TSimdF32x16;
+#elif defined(__AVX__)
+  TSimdF32x8;
+#else
+  TSimdF32x4;
+#endif
+#endif /// MATH_ENABLE_SIMD
+
+} /// ::dy::math namespace
+#endif /// MATH_SIMD_KERNELS
+
+MATH_SIMD_KERNEL_REGION_END
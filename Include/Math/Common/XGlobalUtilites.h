@@ -18,7 +18,7 @@ namespace dy::math
 /// @brief Convert TSourceType value to TTargetType.
 /// This is wrapping function of static_cast<> for readability.
 template <typename TTargetType, typename TSourceType>
-TTargetType Cast(TSourceType iValue);
+constexpr TTargetType Cast(TSourceType iValue);
 
 } /// ::dy::math namespace
 #include <Math/Common/Inline/XGlobalUtilities/XGlobalUtilities.inl>
@@ -0,0 +1,66 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <Math/Common/TSimdTraits.h>
+
+namespace dy::math
+{
+
+/// @enum ESimdIsa
+/// @brief Instruction set of SIMD kernels. Later one includes all of previous ones.
+enum class ESimdIsa
+{
+  Scalar,
+  SSE2,
+  SSE41,
+  AVX,
+  AVX2,
+  AVX512,
+};
+
+/// @brief Get the widest instruction set that both CPU and OS support, by CPUID.
+/// Return `Scalar` when target is not x86.
+ESimdIsa GetSupportedSimdIsa() noexcept;
+
+/// @brief Get instruction set that SIMD kernels of bulk functions (streams, ray packets, batch solvers) use.
+/// With `MATH_ENABLE_SIMD_DISPATCH`, it is selected from `GetSupportedSimdIsa()` at first call.
+/// Otherwise it is fixed by compile flags, and `Scalar` when `MATH_ENABLE_SIMD` is not defined.
+ESimdIsa GetSelectedSimdIsa() noexcept;
+
+/// @brief Limit selected instruction set to `isa` (or narrower one that CPU supports),
+/// and return newly selected one. This is for comparing results and performance of each path,
+/// and only works with `MATH_ENABLE_SIMD_DISPATCH`.
+ESimdIsa SetSimdIsaLimit(ESimdIsa isa) noexcept;
+
+/// @brief Get name of instruction set, such as "AVX2".
+const char* GetNameOf(ESimdIsa isa) noexcept;
+
+} /// ::dy::math namespace
+
+#ifdef MATH_SIMD_KERNELS
+namespace dy::math::details
+{
+
+/// @brief Call `function(TSimd{})` once with `TF32` SIMD wrapper of selected instruction set, and return true.
+/// Return false without calling `function` when selected one is `Scalar`.
+/// When `TLanes` is not 0, only wrappers whose lane count divides `TLanes` are used.
+///
+/// With `MATH_ENABLE_SIMD_DISPATCH`, `function` is inlined into function that is compiled with
+/// the target of selected instruction set, so `function` and kernels called by it must be `MATH_SIMD_INLINE`.
+template <TIndex TLanes = 0, typename TFunction>
+bool DispatchSimdF32(TFunction&& function);
+
+} /// ::dy::math::details namespace
+#endif /// MATH_SIMD_KERNELS
+#include <Math/Common/Inline/XSimdDispatch.inl>
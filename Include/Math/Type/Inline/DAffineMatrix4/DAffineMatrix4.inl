@@ -0,0 +1,208 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+namespace dy::math
+{
+
+template <typename TType>
+DAffineMatrix4<TType>::DAffineMatrix4(
+  TValueType _00, TValueType _01, TValueType _02, TValueType _03,
+  TValueType _10, TValueType _11, TValueType _12, TValueType _13,
+  TValueType _20, TValueType _21, TValueType _22, TValueType _23)
+  : __mValues{
+    DVector4<TValueType>{_00, _01, _02, _03},
+    DVector4<TValueType>{_10, _11, _12, _13},
+    DVector4<TValueType>{_20, _21, _22, _23}}
+{ }
+
+template <typename TType>
+DAffineMatrix4<TType>::DAffineMatrix4(
+  const DVector4<TValueType>& _0,
+  const DVector4<TValueType>& _1,
+  const DVector4<TValueType>& _2)
+  : __mValues{_0, _1, _2}
+{ }
+
+template <typename TType>
+template <EMatMajor TMajor>
+DAffineMatrix4<TType>::DAffineMatrix4(
+  const DMatrix3<TValueType, TMajor>& linear,
+  const DVector3<TValueType>& translation)
+{
+  for (TIndex i = 0; i < 3; ++i)
+  {
+    if constexpr (TMajor == EMatMajor::Column)
+    {
+      this->__mValues[i] = {linear[0][i], linear[1][i], linear[2][i], translation[i]};
+    }
+    else
+    {
+      this->__mValues[i] = {linear[i][0], linear[i][1], linear[i][2], translation[i]};
+    }
+  }
+}
+
+template <typename TType>
+template <EMatMajor TMajor>
+DAffineMatrix4<TType>::DAffineMatrix4(const DMatrix4<TValueType, TMajor>& matrix)
+{
+  if constexpr (TMajor == EMatMajor::Column)
+  {
+    for (TIndex i = 0; i < 3; ++i)
+    {
+      this->__mValues[i] = {matrix[0][i], matrix[1][i], matrix[2][i], matrix[3][i]};
+    }
+  }
+  else
+  {
+    this->__mValues = {matrix[0], matrix[1], matrix[2]};
+  }
+}
+
+template <typename TType>
+DVector4<typename DAffineMatrix4<TType>::TValueType>&
+DAffineMatrix4<TType>::operator[](TIndex index) noexcept
+{
+  return this->__mValues[index];
+}
+
+template <typename TType>
+const DVector4<typename DAffineMatrix4<TType>::TValueType>&
+DAffineMatrix4<TType>::operator[](TIndex index) const noexcept
+{
+  return this->__mValues[index];
+}
+
+template <typename TType>
+DAffineMatrix4<TType> DAffineMatrix4<TType>::Inverse() const
+{
+  // Inverse of [A t] is [A^-1 -(A^-1 * t)].
+  // Columns of adjugate of A are cross products of rows of A.
+  const auto& m = *this;
+  const DVector3<TType> adj0
+  {
+    m[1][1] * m[2][2] - m[1][2] * m[2][1],
+    m[1][2] * m[2][0] - m[1][0] * m[2][2],
+    m[1][0] * m[2][1] - m[1][1] * m[2][0]
+  };
+  const DVector3<TType> adj1
+  {
+    m[2][1] * m[0][2] - m[2][2] * m[0][1],
+    m[2][2] * m[0][0] - m[2][0] * m[0][2],
+    m[2][0] * m[0][1] - m[2][1] * m[0][0]
+  };
+  const DVector3<TType> adj2
+  {
+    m[0][1] * m[1][2] - m[0][2] * m[1][1],
+    m[0][2] * m[1][0] - m[0][0] * m[1][2],
+    m[0][0] * m[1][1] - m[0][1] * m[1][0]
+  };
+  const TType det = m[0][0] * adj0[0] + m[0][1] * adj0[1] + m[0][2] * adj0[2];
+
+  DAffineMatrix4 result;
+  for (TIndex i = 0; i < 3; ++i)
+  {
+    const TType r0 = adj0[i] / det;
+    const TType r1 = adj1[i] / det;
+    const TType r2 = adj2[i] / det;
+    result[i] = {r0, r1, r2, -(r0 * m[0][3] + r1 * m[1][3] + r2 * m[2][3])};
+  }
+
+  return result;
+}
+
+template <typename TType>
+bool DAffineMatrix4<TType>::IsInvertible() const noexcept
+{
+  return this->GetDeterminant() != TType(0.0);
+}
+
+template <typename TType>
+TType DAffineMatrix4<TType>::GetDeterminant() const noexcept
+{
+  const auto& m = *this;
+  return
+    m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) +
+    m[0][1] * (m[1][2] * m[2][0] - m[1][0] * m[2][2]) +
+    m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+
+template <typename TType>
+DVector3<TType> DAffineMatrix4<TType>::GetTranslation() const noexcept
+{
+  return {(*this)[0][3], (*this)[1][3], (*this)[2][3]};
+}
+
+template <typename TType>
+DVector3<TType> DAffineMatrix4<TType>::TransformPoint(const DVector3<TValueType>& point) const noexcept
+{
+  const auto& m = *this;
+  return
+  {
+    m[0][0] * point.X + m[0][1] * point.Y + m[0][2] * point.Z + m[0][3],
+    m[1][0] * point.X + m[1][1] * point.Y + m[1][2] * point.Z + m[1][3],
+    m[2][0] * point.X + m[2][1] * point.Y + m[2][2] * point.Z + m[2][3],
+  };
+}
+
+template <typename TType>
+DVector3<TType> DAffineMatrix4<TType>::TransformDirection(const DVector3<TValueType>& direction) const noexcept
+{
+  const auto& m = *this;
+  return
+  {
+    m[0][0] * direction.X + m[0][1] * direction.Y + m[0][2] * direction.Z,
+    m[1][0] * direction.X + m[1][1] * direction.Y + m[1][2] * direction.Z,
+    m[2][0] * direction.X + m[2][1] * direction.Y + m[2][2] * direction.Z,
+  };
+}
+
+template <typename TType>
+template <EMatMajor TMajor>
+DMatrix4<TType, TMajor> DAffineMatrix4<TType>::ToMatrix4() const noexcept
+{
+  const auto& m = *this;
+  return
+  {
+    m[0][0], m[0][1], m[0][2], m[0][3],
+    m[1][0], m[1][1], m[1][2], m[1][3],
+    m[2][0], m[2][1], m[2][2], m[2][3],
+    TType(0), TType(0), TType(0), TType(1)
+  };
+}
+
+template <typename TType>
+DAffineMatrix4<TType> DAffineMatrix4<TType>::Identity() noexcept
+{
+  return
+  {
+    1, 0, 0, 0,
+    0, 1, 0, 0,
+    0, 0, 1, 0
+  };
+}
+
+template <typename TType, EMatMajor TMajor>
+DMatrix4<TType, TMajor> InverseAffine(const DMatrix4<TType, TMajor>& matrix)
+{
+  return DAffineMatrix4<TType>{matrix}.Inverse().template ToMatrix4<TMajor>();
+}
+
+template <typename TType, EMatMajor TMajor>
+DMatrix4<TType, TMajor> MultiplyAffine(const DMatrix4<TType, TMajor>& lhs, const DMatrix4<TType, TMajor>& rhs) noexcept
+{
+  return (DAffineMatrix4<TType>{lhs} * DAffineMatrix4<TType>{rhs}).template ToMatrix4<TMajor>();
+}
+
+} /// ::dy::math namespace
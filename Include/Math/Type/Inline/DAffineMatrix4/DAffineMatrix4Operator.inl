@@ -0,0 +1,70 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+namespace dy::math
+{
+
+/// [a b c d] * [v0] = new vector4.
+/// [e f g h]   [v1]
+/// [i j k l]   [v2]
+/// [0 0 0 1]   [v3]
+template <typename TType>
+DVector4<TType>
+operator*(const DAffineMatrix4<TType>& lhs, const DVector4<TType>& rhs) noexcept
+{
+  return
+  {
+    lhs[0][0] * rhs[0] + lhs[0][1] * rhs[1] + lhs[0][2] * rhs[2] + lhs[0][3] * rhs[3],
+    lhs[1][0] * rhs[0] + lhs[1][1] * rhs[1] + lhs[1][2] * rhs[2] + lhs[1][3] * rhs[3],
+    lhs[2][0] * rhs[0] + lhs[2][1] * rhs[1] + lhs[2][2] * rhs[2] + lhs[2][3] * rhs[3],
+    rhs[3]
+  };
+}
+
+/// Each row of result is rows of rhs combined by row of lhs,
+/// and last implicit row `(0, 0, 0, 1)` of rhs only adds translation of lhs.
+template <typename TType>
+DAffineMatrix4<TType>
+operator*(const DAffineMatrix4<TType>& lhs, const DAffineMatrix4<TType>& rhs) noexcept
+{
+  const auto GetRowOf = [&lhs, &rhs](TIndex i)
+  {
+    return lhs[i][0] * rhs[0] + lhs[i][1] * rhs[1] + lhs[i][2] * rhs[2]
+      + DVector4<TType>{TType(0), TType(0), TType(0), lhs[i][3]};
+  };
+
+  return { GetRowOf(0), GetRowOf(1), GetRowOf(2) };
+}
+
+template <typename TType>
+DAffineMatrix4<TType>&
+operator*=(DAffineMatrix4<TType>& lhs, const DAffineMatrix4<TType>& rhs) noexcept
+{
+  lhs = lhs * rhs;
+  return lhs;
+}
+
+template <typename TType>
+bool operator==(const DAffineMatrix4<TType>& lhs, const DAffineMatrix4<TType>& rhs) noexcept
+{
+  return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2];
+}
+
+template <typename TType>
+bool operator!=(const DAffineMatrix4<TType>& lhs, const DAffineMatrix4<TType>& rhs) noexcept
+{
+  return !(lhs == rhs);
+}
+
+} /// ::dy::math namespace
@@ -52,7 +52,7 @@ template <typename TLeft, typename TRight>
 DBounds3D<GetBiggerType<TLeft, TRight>>
 operator*(const DQuaternion<TLeft>& lhs, const DBounds3D<TRight>& rhs) noexcept
 {
-  return lhs.ToMatrix3<EMatMajor::Column>() * rhs;
+  return lhs.template ToMatrix3<EMatMajor::Column>() * rhs;
 }
    
 template <typename TLeft, typename TRight>
@@ -123,7 +123,7 @@ template <typename TType>
 TReal DBounds3D<TType>::GetSurfaceArea() const noexcept
 {
   const auto diagonal   = this->GetDiagonal();
-  const auto plane3Area = Dot(diagonal, diagonal);
+  const auto plane3Area = diagonal.X * diagonal.Y + diagonal.Y * diagonal.Z + diagonal.Z * diagonal.X;
 
   return static_cast<TReal>(plane3Area) * TReal(2);
 }
@@ -0,0 +1,667 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <utility>
+#include <Math/Type/Micellanous/DWorkStealingPool.h>
+#include <Math/Utility/XMath.h>
+#include <Math/Utility/XShapeMath.h>
+
+namespace dy::math::details
+{
+
+/// @struct DBvhBuildItem
+/// @brief Bounds and centroid of one shape, used while building DBvh.
+template <typename TType>
+struct DBvhBuildItem final
+{
+  DBounds3D<TType> mBounds;
+  DVector3<TType>  mCentroid;
+  TU32 mIndex = 0;
+  /// Morton code of centroid. Only used by LBVH.
+  TU32 mMortonCode = 0;
+};
+
+/// @brief Get empty (inverted) bounds, which is identity of `GetUnionOf`.
+template <typename TType>
+DBounds3D<TType> GetEmptyBounds3D() noexcept
+{
+  DBounds3D<TType> result;
+  result.__mMin = DVector3<TType>{kMaxValueOf<TType>};
+  result.__mMax = DVector3<TType>{kMinValueOf<TType>};
+  return result;
+}
+
+/// @brief Slab test of ray into bounds, with `invDirection` (1 / direction).
+/// Check ray interval [0, maxT] is overlapped with bounds.
+template <typename TType>
+bool IsRaySlabIntersected(
+  const DBounds3D<TType>& bounds,
+  const DVector3<TType>& origin,
+  const DVector3<TType>& invDirection,
+  TReal maxT) noexcept
+{
+  TReal tMin = 0;
+  TReal tMax = maxT;
+  for (TIndex axis = 0; axis < 3; ++axis)
+  {
+    const TReal t1 = TReal(bounds.__mMin[axis] - origin[axis]) * TReal(invDirection[axis]);
+    const TReal t2 = TReal(bounds.__mMax[axis] - origin[axis]) * TReal(invDirection[axis]);
+    tMin = std::max(tMin, std::min(t1, t2));
+    tMax = std::min(tMax, std::max(t1, t2));
+  }
+  return tMin <= tMax;
+}
+
+/// @brief Get 30-bit morton code of point, quantized in given bounds.
+template <typename TType>
+TU32 GetMortonCodeOf(const DVector3<TType>& point, const DBounds3D<TType>& bounds) noexcept
+{
+  TU32 values[3] = {};
+  for (TIndex axis = 0; axis < 3; ++axis)
+  {
+    const auto extent = TReal(bounds.__mMax[axis] - bounds.__mMin[axis]);
+    const auto ratio  = extent > TReal(0) ? TReal(point[axis] - bounds.__mMin[axis]) / extent : TReal(0);
+    values[axis] = static_cast<TU32>(std::clamp(ratio * TReal(1024), TReal(0), TReal(1023)));
+  }
+  return ::dy::math::GetMortonCodeOf(values[0], values[1], values[2]);
+}
+
+/// @struct DBvhBuildNode
+/// @brief Intermediate node of DBvh builder. Children are allocated as a pair, so nodes can be made in parallel.
+template <typename TType>
+struct DBvhBuildNode final
+{
+  DBounds3D<TType> mBounds;
+  TU32 mLeft   = 0;
+  TU32 mRight  = 0;
+  TU32 mOffset = 0;
+  TU16 mCount  = 0;
+  TU16 mAxis   = 0;
+};
+
+/// @struct DBvhBuilder
+/// @brief Build intermediate nodes of items on DWorkStealingPool, and flatten them into DBvh node layout.
+/// Items are partitioned in place, so leaf offset is index of `mItems`.
+template <typename TType>
+struct DBvhBuilder final
+{
+  DBvhBuilder(std::vector<DBvhBuildItem<TType>>& items, const DBvhBuildOption& option, DWorkStealingPool& pool)
+    : mItems{items}, mOption{option}, mPool{pool}, mNodes(items.size() * 2 - 1)
+  { }
+
+  /// @brief Build all nodes. First node is root.
+  void Build(TIndex binCount, TIndex maxSahDepth, TIndex parallelSize)
+  {
+    this->mBinCount     = binCount;
+    this->mMaxSahDepth  = maxSahDepth;
+    this->mParallelSize = parallelSize;
+    if (this->mOption.mMethod == EBvhBuildMethod::Lbvh) { this->pSortByMortonCode(); }
+
+    this->mPool.Run([this](TIndex worker) { this->pBuildNode(worker, 0, 0, this->mItems.size(), 0); });
+  }
+
+  /// @brief Flatten subtree of given intermediate node in depth-first order and return flattened index.
+  template <typename TNode>
+  TU32 Flatten(TU32 buildIndex, std::vector<TNode>& oNodes) const
+  {
+    const auto& buildNode = this->mNodes[buildIndex];
+    const auto nodeIndex = static_cast<TU32>(oNodes.size());
+    oNodes.emplace_back();
+    oNodes[nodeIndex].mBounds = buildNode.mBounds;
+    oNodes[nodeIndex].mAxis   = buildNode.mAxis;
+    if (buildNode.mCount > 0)
+    {
+      oNodes[nodeIndex].mOffset = buildNode.mOffset;
+      oNodes[nodeIndex].mCount  = buildNode.mCount;
+      return nodeIndex;
+    }
+
+    this->Flatten(buildNode.mLeft, oNodes);
+    oNodes[nodeIndex].mOffset = this->Flatten(buildNode.mRight, oNodes);
+    return nodeIndex;
+  }
+
+private:
+  /// @brief Set morton code of items and sort items by it. Same codes are ordered by index.
+  /// 64-bit keys of (code, position) are sorted instead of items, and items are gathered by sorted keys.
+  void pSortByMortonCode()
+  {
+    auto centroidBounds = GetEmptyBounds3D<TType>();
+    for (const auto& item : this->mItems)
+    {
+      centroidBounds = GetUnionOf(centroidBounds, DBounds3D<TType>{item.mCentroid});
+    }
+
+    const auto count      = this->mItems.size();
+    const auto chunkCount = this->mPool.GetThreadCount();
+    const auto chunkSize  = (count + chunkCount - 1) / chunkCount;
+    const auto getChunk   = [count, chunkSize](TIndex chunk)
+    {
+      return std::pair{std::min(chunk * chunkSize, count), std::min((chunk + 1) * chunkSize, count)};
+    };
+
+    // Calculate code and sort keys of each chunk in parallel.
+    // Items are made in increasing index order, so position is also tie-breaker of index.
+    std::vector<TU64> keys(count);
+    this->mPool.Run([&](TIndex worker)
+    {
+      for (TIndex chunk = 0; chunk < chunkCount; ++chunk)
+      {
+        this->mPool.Push(worker, [&, chunk](TIndex)
+        {
+          const auto [begin, end] = getChunk(chunk);
+          for (TIndex i = begin; i < end; ++i)
+          {
+            auto& item = this->mItems[i];
+            item.mMortonCode = GetMortonCodeOf(item.mCentroid, centroidBounds);
+            keys[i] = (TU64(item.mMortonCode) << 32) | TU64(i);
+          }
+          std::sort(keys.begin() + begin, keys.begin() + end);
+        });
+      }
+    });
+
+    // Merge sorted chunks pairwise. Each round merges independent pairs in parallel.
+    for (TIndex width = 1; width < chunkCount; width *= 2)
+    {
+      this->mPool.Run([&](TIndex worker)
+      {
+        for (TIndex chunk = 0; chunk + width < chunkCount; chunk += width * 2)
+        {
+          this->mPool.Push(worker, [&, chunk](TIndex)
+          {
+            const auto begin  = getChunk(chunk).first;
+            const auto middle = getChunk(chunk + width).first;
+            const auto end    = getChunk(std::min(chunk + width * 2, chunkCount) - 1).second;
+            std::inplace_merge(keys.begin() + begin, keys.begin() + middle, keys.begin() + end);
+          });
+        }
+      });
+    }
+
+    std::vector<DBvhBuildItem<TType>> sortedItems;
+    sortedItems.reserve(count);
+    for (const auto key : keys) { sortedItems.emplace_back(this->mItems[key & kMaxValueOf<TU32>]); }
+    this->mItems.swap(sortedItems);
+  }
+
+  /// @brief Build node of items in [begin, end). Right subtree of big range is pushed into pool.
+  void pBuildNode(TIndex worker, TU32 nodeIndex, TIndex begin, TIndex end, TIndex depth)
+  {
+    auto bounds         = GetEmptyBounds3D<TType>();
+    auto centroidBounds = GetEmptyBounds3D<TType>();
+    for (TIndex i = begin; i < end; ++i)
+    {
+      bounds = GetUnionOf(bounds, this->mItems[i].mBounds);
+      centroidBounds = GetUnionOf(centroidBounds, DBounds3D<TType>{this->mItems[i].mCentroid});
+    }
+
+    auto& node = this->mNodes[nodeIndex];
+    node.mBounds = bounds;
+
+    const auto count = end - begin;
+    if (count <= this->mOption.mMaxLeafSize)
+    {
+      node.mOffset = static_cast<TU32>(begin);
+      node.mCount  = static_cast<TU16>(count);
+      return;
+    }
+
+    // Split along the longest axis of centroids. LBVH replaces it with axis of the morton bit which splits items.
+    const auto extent = centroidBounds.GetDiagonal();
+    TIndex axis = 0;
+    if (extent[1] > extent[axis]) { axis = 1; }
+    if (extent[2] > extent[axis]) { axis = 2; }
+
+    auto mid = this->mOption.mMethod == EBvhBuildMethod::Lbvh
+      ? this->pSplitByMortonCode(begin, end, axis)
+      : this->pSplitBySah(begin, end, depth, centroidBounds, axis);
+
+    // Fallback of median split, when given method could not split.
+    // Items of LBVH are already sorted, so just split at the middle.
+    if (mid == begin || mid == end)
+    {
+      mid = begin + count / 2;
+      if (this->mOption.mMethod != EBvhBuildMethod::Lbvh)
+      {
+        std::nth_element(
+          this->mItems.begin() + begin, this->mItems.begin() + mid, this->mItems.begin() + end,
+          [axis](const auto& lhs, const auto& rhs) { return lhs.mCentroid[axis] < rhs.mCentroid[axis]; });
+      }
+    }
+
+    const auto leftIndex  = this->mNodeCount.fetch_add(2, std::memory_order_relaxed);
+    const auto rightIndex = leftIndex + 1;
+    node.mLeft  = leftIndex;
+    node.mRight = rightIndex;
+    node.mAxis  = static_cast<TU16>(axis);
+
+    if (count >= this->mParallelSize && this->mPool.GetThreadCount() > 1)
+    {
+      this->mPool.Push(worker, [this, rightIndex, mid, end, depth](TIndex other)
+      {
+        this->pBuildNode(other, rightIndex, mid, end, depth + 1);
+      });
+    }
+    else
+    {
+      this->pBuildNode(worker, rightIndex, mid, end, depth + 1);
+    }
+    this->pBuildNode(worker, leftIndex, begin, mid, depth + 1);
+  }
+
+  /// @brief Get split index of binned SAH. Return `begin` when SAH could not split.
+  TIndex pSplitBySah(
+    TIndex begin, TIndex end, TIndex depth,
+    const DBounds3D<TType>& centroidBounds, TIndex axis)
+  {
+    const auto extent = centroidBounds.__mMax[axis] - centroidBounds.__mMin[axis];
+    if (depth >= this->mMaxSahDepth || extent <= TType(0)) { return begin; }
+
+    // Split candidate `i` puts bin [0, i) to left, [i, binCount) to right.
+    struct DBin final { DBounds3D<TType> mBounds = GetEmptyBounds3D<TType>(); TIndex mCount = 0; };
+    std::array<DBin, 32> bins = {};
+    const auto binCount = this->mBinCount;
+    assert(binCount <= bins.size());
+
+    const auto binMin   = centroidBounds.__mMin[axis];
+    const auto binScale = TReal(binCount) / TReal(extent);
+    const auto getBinOf = [binMin, binScale, binCount, axis](const DBvhBuildItem<TType>& item)
+    {
+      const auto bin = static_cast<TIndex>(TReal(item.mCentroid[axis] - binMin) * binScale);
+      return std::min(bin, binCount - 1);
+    };
+    for (TIndex i = begin; i < end; ++i)
+    {
+      auto& bin = bins[getBinOf(this->mItems[i])];
+      bin.mBounds = GetUnionOf(bin.mBounds, this->mItems[i].mBounds);
+      bin.mCount += 1;
+    }
+
+    // Sweep from right to get right-side cost of each split candidate.
+    std::array<TReal, 32> rightCosts = {};
+    auto sweepBounds = GetEmptyBounds3D<TType>();
+    TIndex sweepCount = 0;
+    for (TIndex i = binCount - 1; i > 0; --i)
+    {
+      sweepBounds = GetUnionOf(sweepBounds, bins[i].mBounds);
+      sweepCount += bins[i].mCount;
+      rightCosts[i] = sweepCount == 0 ? TReal(0) : TReal(sweepCount) * sweepBounds.GetSurfaceArea();
+    }
+
+    const auto count = end - begin;
+    TIndex bestSplit = 0;
+    TReal bestCost = kMaxValueOf<TReal>;
+    sweepBounds = GetEmptyBounds3D<TType>();
+    sweepCount = 0;
+    for (TIndex i = 1; i < binCount; ++i)
+    {
+      sweepBounds = GetUnionOf(sweepBounds, bins[i - 1].mBounds);
+      sweepCount += bins[i - 1].mCount;
+      if (sweepCount == 0 || sweepCount == count) { continue; }
+
+      const auto cost = TReal(sweepCount) * sweepBounds.GetSurfaceArea() + rightCosts[i];
+      if (cost < bestCost) { bestCost = cost; bestSplit = i; }
+    }
+    if (bestSplit == 0) { return begin; }
+
+    const auto it = std::partition(
+      this->mItems.begin() + begin, this->mItems.begin() + end,
+      [&getBinOf, bestSplit](const auto& item) { return getBinOf(item) < bestSplit; });
+    return static_cast<TIndex>(it - this->mItems.begin());
+  }
+
+  /// @brief Get split index at the highest different bit of morton codes, and set axis of the bit to `ioAxis`.
+  /// Return `begin` and do not change `ioAxis` when all codes are same.
+  TIndex pSplitByMortonCode(TIndex begin, TIndex end, TIndex& ioAxis) const
+  {
+    const auto first = this->mItems[begin].mMortonCode;
+    const auto last  = this->mItems[end - 1].mMortonCode;
+    if (first == last) { return begin; }
+
+    // Codes are sorted, so upper bits than highest different bit are same in range.
+    TU32 bit = 1u << 29;
+    TIndex bitIndex = 29;
+    while ((first ^ last) < bit) { bit >>= 1; --bitIndex; }
+    // Bits of morton code are interleaved as `...xyzxyz`, so bit 0 is Z.
+    ioAxis = 2 - bitIndex % 3;
+
+    const auto it = std::partition_point(
+      this->mItems.begin() + begin, this->mItems.begin() + end,
+      [bit](const auto& item) { return (item.mMortonCode & bit) == 0; });
+    return static_cast<TIndex>(it - this->mItems.begin());
+  }
+
+  std::vector<DBvhBuildItem<TType>>& mItems;
+  const DBvhBuildOption& mOption;
+  DWorkStealingPool& mPool;
+  std::vector<DBvhBuildNode<TType>> mNodes;
+  std::atomic<TU32> mNodeCount{1};
+  TIndex mBinCount     = 16;
+  TIndex mMaxSahDepth  = 32;
+  TIndex mParallelSize = 4096;
+};
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+template <typename TType>
+DBvh<TType>::DBvh(const std::vector<TShape>& shapes, TIndex maxLeafSize)
+{
+  this->Build(shapes, maxLeafSize);
+}
+
+template <typename TType>
+DBvh<TType>::DBvh(const std::vector<TShape>& shapes, const DBvhBuildOption& option)
+{
+  this->Build(shapes, option);
+}
+
+template <typename TType>
+void DBvh<TType>::Build(const std::vector<TShape>& shapes, TIndex maxLeafSize)
+{
+  DBvhBuildOption option;
+  option.mMaxLeafSize = maxLeafSize;
+  this->Build(shapes, option);
+}
+
+template <typename TType>
+void DBvh<TType>::Build(const std::vector<TShape>& shapes, const DBvhBuildOption& option)
+{
+  auto validOption = option;
+  validOption.mMaxLeafSize = std::clamp<TIndex>(option.mMaxLeafSize, 1, kMaxValueOf<TU16>);
+
+  this->Clear();
+  this->pBuild(shapes, validOption);
+}
+
+template <typename TType>
+void DBvh<TType>::Clear() noexcept
+{
+  this->mNodes.clear();
+  this->mShapes.clear();
+  this->mShapeBounds.clear();
+  this->mIndices.clear();
+  this->mInfiniteShapes.clear();
+  this->mInfiniteIndices.clear();
+}
+
+template <typename TType>
+void DBvh<TType>::pBuild(const std::vector<TShape>& shapes, const DBvhBuildOption& option)
+{
+  assert(shapes.size() <= kMaxValueOf<TU32> / 2);
+
+  std::vector<details::DBvhBuildItem<TType>> items;
+  items.reserve(shapes.size());
+  for (TIndex i = 0, size = shapes.size(); i < size; ++i)
+  {
+    const auto bounds = std::visit([](const auto& shape) { return GetDBounds3DOf(shape); }, shapes[i]);
+    if (bounds.IsInfiniteBound() == true)
+    {
+      this->mInfiniteShapes.emplace_back(shapes[i]);
+      this->mInfiniteIndices.emplace_back(static_cast<TU32>(i));
+      continue;
+    }
+
+    items.push_back({bounds, (bounds.__mMin + bounds.__mMax) / TType(2), static_cast<TU32>(i)});
+  }
+  if (items.empty() == true) { return; }
+
+  DWorkStealingPool pool{option.mThreadCount};
+  details::DBvhBuilder<TType> builder{items, option, pool};
+  builder.Build(kBinCount, kMaxSahDepth, kParallelSubtreeSize);
+
+  this->mNodes.reserve(items.size() * 2 - 1);
+  builder.Flatten(0, this->mNodes);
+  this->mNodes.shrink_to_fit();
+
+  this->mShapes.reserve(items.size());
+  this->mShapeBounds.reserve(items.size());
+  this->mIndices.reserve(items.size());
+  for (const auto& item : items)
+  {
+    this->mShapes.emplace_back(shapes[item.mIndex]);
+    this->mShapeBounds.emplace_back(item.mBounds);
+    this->mIndices.emplace_back(item.mIndex);
+  }
+}
+
+template <typename TType>
+TIndex DBvh<TType>::GetShapeCount() const noexcept
+{
+  return this->mShapes.size() + this->mInfiniteShapes.size();
+}
+
+template <typename TType>
+const std::vector<typename DBvh<TType>::DNode>& DBvh<TType>::GetNodes() const noexcept
+{
+  return this->mNodes;
+}
+
+template <typename TType>
+DBounds3D<TType> DBvh<TType>::GetBounds() const noexcept
+{
+  if (this->mNodes.empty() == true) { return {}; }
+  return this->mNodes.front().mBounds;
+}
+
+template <typename TType>
+std::optional<TReal> DBvh<TType>::pGetClosestTValueOf(const DRay<TValueType>& ray, const TShape& shape)
+{
+  return std::visit([&ray](const auto& item) { return GetClosestTValueOf(ray, item); }, shape);
+}
+
+template <typename TType>
+std::optional<DBvhHit> DBvh<TType>::GetClosestHit(const DRay<TValueType>& ray, TReal maxT) const
+{
+  std::optional<DBvhHit> result = std::nullopt;
+  auto closestT = maxT;
+  const auto testShape = [&result, &closestT, &ray](const TShape& shape, TU32 index)
+  {
+    if (const auto t = pGetClosestTValueOf(ray, shape); t.has_value() == true && *t >= TReal(0) && *t <= closestT)
+    {
+      closestT = *t;
+      result = DBvhHit{index, *t};
+    }
+  };
+
+  for (TIndex i = 0, size = this->mInfiniteShapes.size(); i < size; ++i)
+  {
+    testShape(this->mInfiniteShapes[i], this->mInfiniteIndices[i]);
+  }
+  if (this->mNodes.empty() == true) { return result; }
+
+  const auto& origin = ray.GetOrigin();
+  const auto& direction = ray.GetDirection();
+  const DVector3<TValueType> invDirection =
+  {
+    TValueType(1) / direction.X,
+    TValueType(1) / direction.Y,
+    TValueType(1) / direction.Z
+  };
+
+  // Depth is limited by kMaxSahDepth and median split below it, so stack never overflows.
+  std::array<TU32, 64> stack;
+  TIndex stackSize = 0;
+  TU32 nodeIndex = 0;
+  while (true)
+  {
+    const auto& node = this->mNodes[nodeIndex];
+    if (details::IsRaySlabIntersected(node.mBounds, origin, invDirection, closestT) == true)
+    {
+      if (node.IsLeaf() == false)
+      {
+        // Visit near child first, so far child can be culled by closer hit.
+        if (direction[node.mAxis] < TValueType(0))
+        {
+          stack[stackSize++] = nodeIndex + 1;
+          nodeIndex = node.mOffset;
+        }
+        else
+        {
+          stack[stackSize++] = node.mOffset;
+          nodeIndex = nodeIndex + 1;
+        }
+        continue;
+      }
+
+      for (TIndex i = node.mOffset, end = node.mOffset + node.mCount; i < end; ++i)
+      {
+        testShape(this->mShapes[i], this->mIndices[i]);
+      }
+    }
+
+    if (stackSize == 0) { break; }
+    nodeIndex = stack[--stackSize];
+  }
+
+  return result;
+}
+
+template <typename TType>
+bool DBvh<TType>::IsAnyHit(const DRay<TValueType>& ray, TReal maxT) const
+{
+  const auto isHit = [&ray, maxT](const TShape& shape)
+  {
+    const auto t = pGetClosestTValueOf(ray, shape);
+    return t.has_value() == true && *t >= TReal(0) && *t <= maxT;
+  };
+
+  for (const auto& shape : this->mInfiniteShapes)
+  {
+    if (isHit(shape) == true) { return true; }
+  }
+  if (this->mNodes.empty() == true) { return false; }
+
+  const auto& origin = ray.GetOrigin();
+  const auto& direction = ray.GetDirection();
+  const DVector3<TValueType> invDirection =
+  {
+    TValueType(1) / direction.X,
+    TValueType(1) / direction.Y,
+    TValueType(1) / direction.Z
+  };
+
+  std::array<TU32, 64> stack;
+  TIndex stackSize = 0;
+  TU32 nodeIndex = 0;
+  while (true)
+  {
+    const auto& node = this->mNodes[nodeIndex];
+    if (details::IsRaySlabIntersected(node.mBounds, origin, invDirection, maxT) == true)
+    {
+      if (node.IsLeaf() == false)
+      {
+        stack[stackSize++] = node.mOffset;
+        nodeIndex = nodeIndex + 1;
+        continue;
+      }
+
+      for (TIndex i = node.mOffset, end = node.mOffset + node.mCount; i < end; ++i)
+      {
+        if (isHit(this->mShapes[i]) == true) { return true; }
+      }
+    }
+
+    if (stackSize == 0) { break; }
+    nodeIndex = stack[--stackSize];
+  }
+
+  return false;
+}
+
+template <typename TType>
+void DBvh<TType>::GetOverlappedIndices(const DBounds3D<TValueType>& bounds, std::vector<TIndex>& oIndices) const
+{
+  for (const auto index : this->mInfiniteIndices) { oIndices.emplace_back(index); }
+  if (this->mNodes.empty() == true) { return; }
+
+  std::array<TU32, 64> stack;
+  TIndex stackSize = 0;
+  TU32 nodeIndex = 0;
+  while (true)
+  {
+    const auto& node = this->mNodes[nodeIndex];
+    if (details::IsBounds3DOverlapped(node.mBounds, bounds) == true)
+    {
+      if (node.IsLeaf() == false)
+      {
+        stack[stackSize++] = node.mOffset;
+        nodeIndex = nodeIndex + 1;
+        continue;
+      }
+
+      for (TIndex i = node.mOffset, end = node.mOffset + node.mCount; i < end; ++i)
+      {
+        if (details::IsBounds3DOverlapped(this->mShapeBounds[i], bounds) == true)
+        {
+          oIndices.emplace_back(this->mIndices[i]);
+        }
+      }
+    }
+
+    if (stackSize == 0) { break; }
+    nodeIndex = stack[--stackSize];
+  }
+}
+
+template <typename TType>
+void DBvh<TType>::GetVisibleIndices(const DFrustum<TValueType>& frustum, std::vector<TIndex>& oIndices) const
+{
+  for (const auto index : this->mInfiniteIndices) { oIndices.emplace_back(index); }
+  if (this->mNodes.empty() == true) { return; }
+
+  // Pair of node index and plane mask which is inherited from parent.
+  std::array<std::pair<TU32, TU32>, 64> stack;
+  TIndex stackSize = 0;
+  TU32 nodeIndex = 0;
+  TU32 planeMask = DFrustum<TValueType>::kAllPlaneMask;
+  // Plane which culled the last node. Neighbor nodes are likely to be culled by same plane.
+  TU32 lastPlane = 0;
+  while (true)
+  {
+    const auto& node = this->mNodes[nodeIndex];
+    if (planeMask == 0 || frustum.Test(node.mBounds, planeMask, lastPlane) != EFrustumTest::Outside)
+    {
+      if (node.IsLeaf() == false)
+      {
+        stack[stackSize++] = {node.mOffset, planeMask};
+        nodeIndex = nodeIndex + 1;
+        continue;
+      }
+
+      for (TIndex i = node.mOffset, end = node.mOffset + node.mCount; i < end; ++i)
+      {
+        auto shapeMask = planeMask;
+        if (shapeMask == 0 || frustum.Test(this->mShapeBounds[i], shapeMask, lastPlane) != EFrustumTest::Outside)
+        {
+          oIndices.emplace_back(this->mIndices[i]);
+        }
+      }
+    }
+
+    if (stackSize == 0) { break; }
+    --stackSize;
+    nodeIndex = stack[stackSize].first;
+    planeMask = stack[stackSize].second;
+  }
+}
+
+} /// ::dy::math namespace
@@ -0,0 +1,395 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <cassert>
+#include <Math/Utility/XShapeMath.h>
+
+namespace dy::math
+{
+
+template <typename TType>
+DDynamicBoundsTree<TType>::DDynamicBoundsTree(TValueType margin)
+  : mMargin{margin}
+{ }
+
+template <typename TType>
+typename DDynamicBoundsTree<TType>::THandle
+DDynamicBoundsTree<TType>::Insert(const DBounds3D<TValueType>& bounds, TIndex userValue)
+{
+  assert(bounds.IsInfiniteBound() == false);
+
+  const auto leaf = this->pAllocateNode();
+  auto& node = this->mNodes[leaf];
+  node.mBounds     = GetExpandOf(bounds, this->mMargin);
+  node.mLeafBounds = bounds;
+  node.mUserValue  = userValue;
+  node.mHeight     = 0;
+
+  this->pInsertLeaf(leaf);
+  this->mCount += 1;
+  return leaf;
+}
+
+template <typename TType>
+void DDynamicBoundsTree<TType>::Remove(THandle handle)
+{
+  assert(handle < this->mNodes.size() && this->mNodes[handle].IsLeaf() == true);
+
+  this->pRemoveLeaf(handle);
+  this->pFreeNode(handle);
+  this->mCount -= 1;
+}
+
+template <typename TType>
+bool DDynamicBoundsTree<TType>::Move(THandle handle, const DBounds3D<TValueType>& bounds)
+{
+  assert(handle < this->mNodes.size() && this->mNodes[handle].IsLeaf() == true);
+
+  auto& node = this->mNodes[handle];
+  node.mLeafBounds = bounds;
+  if (details::IsBounds3DContained(node.mBounds, bounds) == true) { return false; }
+
+  this->pRemoveLeaf(handle);
+  this->mNodes[handle].mBounds = GetExpandOf(bounds, this->mMargin);
+  this->pInsertLeaf(handle);
+  return true;
+}
+
+template <typename TType>
+bool DDynamicBoundsTree<TType>::MoveBy(THandle handle, const DVector3<TValueType>& offset)
+{
+  return this->Move(handle, GetMovedOf(this->GetBounds(handle), offset));
+}
+
+template <typename TType>
+void DDynamicBoundsTree<TType>::Clear() noexcept
+{
+  this->mNodes.clear();
+  this->mRoot     = kInvalidHandle;
+  this->mFreeList = kInvalidHandle;
+  this->mCount    = 0;
+}
+
+template <typename TType>
+const DBounds3D<TType>& DDynamicBoundsTree<TType>::GetBounds(THandle handle) const noexcept
+{
+  return this->mNodes[handle].mLeafBounds;
+}
+
+template <typename TType>
+const DBounds3D<TType>& DDynamicBoundsTree<TType>::GetFatBounds(THandle handle) const noexcept
+{
+  return this->mNodes[handle].mBounds;
+}
+
+template <typename TType>
+TIndex DDynamicBoundsTree<TType>::GetUserValue(THandle handle) const noexcept
+{
+  return this->mNodes[handle].mUserValue;
+}
+
+template <typename TType>
+TIndex DDynamicBoundsTree<TType>::GetCount() const noexcept
+{
+  return this->mCount;
+}
+
+template <typename TType>
+TIndex DDynamicBoundsTree<TType>::GetHeight() const noexcept
+{
+  if (this->mRoot == kInvalidHandle) { return 0; }
+  return static_cast<TIndex>(this->mNodes[this->mRoot].mHeight) + 1;
+}
+
+template <typename TType>
+TType DDynamicBoundsTree<TType>::GetMargin() const noexcept
+{
+  return this->mMargin;
+}
+
+template <typename TType>
+void DDynamicBoundsTree<TType>::GetOverlappedHandles(
+  const DBounds3D<TValueType>& bounds,
+  std::vector<THandle>& oHandles) const
+{
+  if (this->mRoot == kInvalidHandle) { return; }
+
+  std::vector<TU32> stack;
+  stack.emplace_back(this->mRoot);
+  while (stack.empty() == false)
+  {
+    const auto& node = this->mNodes[stack.back()];
+    const auto index = stack.back();
+    stack.pop_back();
+    if (details::IsBounds3DOverlapped(node.mBounds, bounds) == false) { continue; }
+
+    if (node.IsLeaf() == true) { oHandles.emplace_back(index); }
+    else
+    {
+      stack.emplace_back(node.mLeft);
+      stack.emplace_back(node.mRight);
+    }
+  }
+}
+
+template <typename TType>
+void DDynamicBoundsTree<TType>::GetOverlappedPairs(std::vector<std::pair<THandle, THandle>>& oPairs) const
+{
+  if (this->mRoot == kInvalidHandle) { return; }
+
+  // Pairs of subtrees to test. Same index pair means pairs inside of one subtree.
+  std::vector<std::pair<TU32, TU32>> stack;
+  stack.emplace_back(this->mRoot, this->mRoot);
+  while (stack.empty() == false)
+  {
+    const auto [lhs, rhs] = stack.back();
+    stack.pop_back();
+
+    const auto& lhsNode = this->mNodes[lhs];
+    if (lhs == rhs)
+    {
+      if (lhsNode.IsLeaf() == true) { continue; }
+      stack.emplace_back(lhsNode.mLeft, lhsNode.mLeft);
+      stack.emplace_back(lhsNode.mRight, lhsNode.mRight);
+      stack.emplace_back(lhsNode.mLeft, lhsNode.mRight);
+      continue;
+    }
+
+    const auto& rhsNode = this->mNodes[rhs];
+    if (details::IsBounds3DOverlapped(lhsNode.mBounds, rhsNode.mBounds) == false) { continue; }
+
+    if (lhsNode.IsLeaf() == true && rhsNode.IsLeaf() == true)
+    {
+      oPairs.emplace_back(std::min(lhs, rhs), std::max(lhs, rhs));
+    }
+    else if (rhsNode.IsLeaf() == true || (lhsNode.IsLeaf() == false && lhsNode.mHeight >= rhsNode.mHeight))
+    {
+      // Descend into higher subtree.
+      stack.emplace_back(lhsNode.mLeft, rhs);
+      stack.emplace_back(lhsNode.mRight, rhs);
+    }
+    else
+    {
+      stack.emplace_back(lhs, rhsNode.mLeft);
+      stack.emplace_back(lhs, rhsNode.mRight);
+    }
+  }
+}
+
+template <typename TType>
+TU32 DDynamicBoundsTree<TType>::pAllocateNode()
+{
+  if (this->mFreeList == kInvalidHandle)
+  {
+    assert(this->mNodes.size() < kInvalidHandle);
+    this->mNodes.emplace_back();
+    return static_cast<TU32>(this->mNodes.size() - 1);
+  }
+
+  const auto index = this->mFreeList;
+  this->mFreeList = this->mNodes[index].mParent;
+  this->mNodes[index] = DNode{};
+  return index;
+}
+
+template <typename TType>
+void DDynamicBoundsTree<TType>::pFreeNode(TU32 index) noexcept
+{
+  auto& node = this->mNodes[index];
+  node.mParent = this->mFreeList;
+  node.mLeft   = kInvalidHandle;
+  node.mRight  = kInvalidHandle;
+  node.mHeight = -1;
+  this->mFreeList = index;
+}
+
+template <typename TType>
+void DDynamicBoundsTree<TType>::pInsertLeaf(TU32 leaf)
+{
+  if (this->mRoot == kInvalidHandle)
+  {
+    this->mRoot = leaf;
+    this->mNodes[leaf].mParent = kInvalidHandle;
+    return;
+  }
+
+  // Find the best sibling by surface area heuristic.
+  // Cost of sibling is area of new parent, plus area increase of all ancestors (inherited cost).
+  const auto leafBounds = this->mNodes[leaf].mBounds;
+  auto index = this->mRoot;
+  while (this->mNodes[index].IsLeaf() == false)
+  {
+    const auto& node = this->mNodes[index];
+    const auto area = node.mBounds.GetSurfaceArea();
+    const auto combinedArea = GetUnionOf(node.mBounds, leafBounds).GetSurfaceArea();
+
+    const auto cost = TReal(2) * combinedArea;
+    const auto inheritedCost = TReal(2) * (combinedArea - area);
+    const auto getChildCost = [this, &leafBounds, inheritedCost](TU32 child)
+    {
+      const auto& childNode = this->mNodes[child];
+      const auto newArea = GetUnionOf(childNode.mBounds, leafBounds).GetSurfaceArea();
+      if (childNode.IsLeaf() == true) { return newArea + inheritedCost; }
+      return newArea - childNode.mBounds.GetSurfaceArea() + inheritedCost;
+    };
+
+    const auto leftCost  = getChildCost(node.mLeft);
+    const auto rightCost = getChildCost(node.mRight);
+    if (cost < leftCost && cost < rightCost) { break; }
+
+    index = leftCost < rightCost ? node.mLeft : node.mRight;
+  }
+
+  // Make new parent of sibling and leaf.
+  const auto sibling   = index;
+  const auto oldParent = this->mNodes[sibling].mParent;
+  const auto newParent = this->pAllocateNode();
+  {
+    auto& parentNode = this->mNodes[newParent];
+    parentNode.mParent = oldParent;
+    parentNode.mBounds = GetUnionOf(leafBounds, this->mNodes[sibling].mBounds);
+    parentNode.mHeight = this->mNodes[sibling].mHeight + 1;
+    parentNode.mLeft   = sibling;
+    parentNode.mRight  = leaf;
+  }
+
+  if (oldParent != kInvalidHandle)
+  {
+    auto& oldParentNode = this->mNodes[oldParent];
+    if (oldParentNode.mLeft == sibling) { oldParentNode.mLeft = newParent; }
+    else                                { oldParentNode.mRight = newParent; }
+  }
+  else
+  {
+    this->mRoot = newParent;
+  }
+  this->mNodes[sibling].mParent = newParent;
+  this->mNodes[leaf].mParent    = newParent;
+
+  this->pRefitFrom(this->mNodes[leaf].mParent);
+}
+
+template <typename TType>
+void DDynamicBoundsTree<TType>::pRemoveLeaf(TU32 leaf)
+{
+  if (leaf == this->mRoot)
+  {
+    this->mRoot = kInvalidHandle;
+    return;
+  }
+
+  const auto parent      = this->mNodes[leaf].mParent;
+  const auto grandParent = this->mNodes[parent].mParent;
+  const auto sibling     = this->mNodes[parent].mLeft == leaf
+    ? this->mNodes[parent].mRight
+    : this->mNodes[parent].mLeft;
+
+  this->pFreeNode(parent);
+  this->mNodes[leaf].mParent = kInvalidHandle;
+  if (grandParent == kInvalidHandle)
+  {
+    this->mRoot = sibling;
+    this->mNodes[sibling].mParent = kInvalidHandle;
+    return;
+  }
+
+  // Connect sibling to grand parent, and refit from grand parent.
+  auto& grandParentNode = this->mNodes[grandParent];
+  if (grandParentNode.mLeft == parent) { grandParentNode.mLeft = sibling; }
+  else                                 { grandParentNode.mRight = sibling; }
+  this->mNodes[sibling].mParent = grandParent;
+
+  this->pRefitFrom(grandParent);
+}
+
+template <typename TType>
+void DDynamicBoundsTree<TType>::pRefitFrom(TU32 index)
+{
+  while (index != kInvalidHandle)
+  {
+    index = this->pBalance(index);
+
+    auto& node = this->mNodes[index];
+    const auto& left  = this->mNodes[node.mLeft];
+    const auto& right = this->mNodes[node.mRight];
+    node.mHeight = 1 + std::max(left.mHeight, right.mHeight);
+    node.mBounds = GetUnionOf(left.mBounds, right.mBounds);
+
+    index = node.mParent;
+  }
+}
+
+template <typename TType>
+TU32 DDynamicBoundsTree<TType>::pBalance(TU32 iA)
+{
+  // When heights of children of A differ more than 1, higher child is rotated up to the place of A.
+  // A takes lower child of rotated node, and rotated node keeps higher one.
+  auto& a = this->mNodes[iA];
+  if (a.IsLeaf() == true || a.mHeight < 2) { return iA; }
+
+  const auto iB = a.mLeft;
+  const auto iC = a.mRight;
+  const auto balance = this->mNodes[iC].mHeight - this->mNodes[iB].mHeight;
+
+  // Rotate child `iUp` of A up. `iOther` is another child of A.
+  const auto rotate = [this, iA](TU32 iUp, TU32 iOther)
+  {
+    auto& a  = this->mNodes[iA];
+    auto& up = this->mNodes[iUp];
+    const auto iF = up.mLeft;
+    const auto iG = up.mRight;
+    auto& f = this->mNodes[iF];
+    auto& g = this->mNodes[iG];
+
+    // Swap A and `up`.
+    up.mLeft   = iA;
+    up.mParent = a.mParent;
+    a.mParent  = iUp;
+
+    if (up.mParent != kInvalidHandle)
+    {
+      auto& parent = this->mNodes[up.mParent];
+      if (parent.mLeft == iA) { parent.mLeft = iUp; }
+      else                    { parent.mRight = iUp; }
+    }
+    else
+    {
+      this->mRoot = iUp;
+    }
+
+    // Higher grand child stays with `up`, lower one moves to A.
+    const auto& other = this->mNodes[iOther];
+    const auto [iStay, iMove] = f.mHeight > g.mHeight ? std::pair{iF, iG} : std::pair{iG, iF};
+    auto& stay = this->mNodes[iStay];
+    auto& move = this->mNodes[iMove];
+
+    up.mRight = iStay;
+    if (a.mLeft == iUp) { a.mLeft = iMove; }
+    else                { a.mRight = iMove; }
+    move.mParent = iA;
+
+    a.mBounds  = GetUnionOf(other.mBounds, move.mBounds);
+    up.mBounds = GetUnionOf(a.mBounds, stay.mBounds);
+    a.mHeight  = 1 + std::max(other.mHeight, move.mHeight);
+    up.mHeight = 1 + std::max(a.mHeight, stay.mHeight);
+    return iUp;
+  };
+
+  if (balance > 1)  { return rotate(iC, iB); }
+  if (balance < -1) { return rotate(iB, iC); }
+  return iA;
+}
+
+} /// ::dy::math namespace
@@ -20,31 +20,31 @@ namespace dy::math
 {
 
 template <typename TType>
-DMatrix2<TType, EMatMajor::Column>::DMatrix2(TValueType _00, TValueType _01, TValueType _10, TValueType _11)
+constexpr DMatrix2<TType, EMatMajor::Column>::DMatrix2(TValueType _00, TValueType _01, TValueType _10, TValueType _11)
   : __mValues{DVector2<TValueType>{_00, _10}, DVector2<TValueType>{_01, _11}} 
 { }
 
 template<typename TType>
-DMatrix2<TType, EMatMajor::Column>::DMatrix2(const DVector2<TValueType>& _0, const DVector2<TValueType>& _1)
+constexpr DMatrix2<TType, EMatMajor::Column>::DMatrix2(const DVector2<TValueType>& _0, const DVector2<TValueType>& _1)
   : __mValues{_0, _1}
 { }
 
 template <typename TType>
-DVector2<typename DMatrix2<TType, EMatMajor::Column>::TValueType>& 
+constexpr DVector2<typename DMatrix2<TType, EMatMajor::Column>::TValueType>& 
 DMatrix2<TType, EMatMajor::Column>::operator[](TIndex index) noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-const DVector2<typename DMatrix2<TType, EMatMajor::Column>::TValueType>& 
+constexpr const DVector2<typename DMatrix2<TType, EMatMajor::Column>::TValueType>& 
 DMatrix2<TType, EMatMajor::Column>::operator[](TIndex index) const noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-DMatrix2<TType, EMatMajor::Column> DMatrix2<TType, EMatMajor::Column>::Transpose() const noexcept
+constexpr DMatrix2<TType, EMatMajor::Column> DMatrix2<TType, EMatMajor::Column>::Transpose() const noexcept
 {
   return DMatrix2
   {
@@ -56,23 +56,23 @@ DMatrix2<TType, EMatMajor::Column> DMatrix2<TType, EMatMajor::Column>::Transpose
 }
 
 template <typename TType>
-bool DMatrix2<TType, EMatMajor::Column>::IsInvertible() const noexcept
+constexpr bool DMatrix2<TType, EMatMajor::Column>::IsInvertible() const noexcept
 {
   return this->GetDeterminant() != TType(0.0);
 }
 
 template <typename TType>
-TType DMatrix2<TType, EMatMajor::Column>::GetDeterminant() const noexcept
+constexpr TType DMatrix2<TType, EMatMajor::Column>::GetDeterminant() const noexcept
 {
   return (*this)[0][0] * (*this)[1][1] - (*this)[1][0] * (*this)[0][1];
 }
 
 template <typename TType>
-DMatrix2<TType, EMatMajor::Column> DMatrix2<TType, EMatMajor::Column>::Inverse() const
+constexpr DMatrix2<TType, EMatMajor::Column> DMatrix2<TType, EMatMajor::Column>::Inverse() const
 {
   const auto det = this->GetDeterminant();
 
-  DMatrix2<TType, EMatMajor::Column> result;
+  DMatrix2<TType, EMatMajor::Column> result{};
   result[0][0] =  (*this)[1][1];
   result[1][1] =  (*this)[0][0];
   result[1][0] = -(*this)[1][0];
@@ -83,7 +83,7 @@ DMatrix2<TType, EMatMajor::Column> DMatrix2<TType, EMatMajor::Column>::Inverse()
 }
 
 template<typename TType>
-DMatrix2<TType,EMatMajor::Row> DMatrix2<TType, EMatMajor::Column>::ConvertToRowMatrix() const
+constexpr DMatrix2<TType,EMatMajor::Row> DMatrix2<TType, EMatMajor::Column>::ConvertToRowMatrix() const
 {
   const auto transposedMatrix = this->Transpose();
   return {transposedMatrix[0], transposedMatrix[1]};
@@ -141,12 +141,11 @@ std::vector<DVector2<TType>> DMatrix2<TType, EMatMajor::Column>::ToVector() cons
 }
 
 template <typename TType>
-DMatrix2<TType, EMatMajor::Column> DMatrix2<TType, EMatMajor::Column>::Identity() noexcept
+constexpr DMatrix2<TType, EMatMajor::Column> DMatrix2<TType, EMatMajor::Column>::Identity() noexcept
 {
   // 1 0
   // 0 1
-  static DMatrix2<TType, EMatMajor::Column> identity{1, 0, 0, 1};
-  return identity;
+  return DMatrix2{1, 0, 0, 1};
 }
 
 } /// ::dy::math namespace
@@ -157,31 +156,31 @@ namespace dy::math
 {
 
 template <typename TType>
-DMatrix2<TType, EMatMajor::Row>::DMatrix2(TValueType _00, TValueType _01, TValueType _10, TValueType _11)
+constexpr DMatrix2<TType, EMatMajor::Row>::DMatrix2(TValueType _00, TValueType _01, TValueType _10, TValueType _11)
   : __mValues{DVector2<TValueType>{_00, _01}, DVector2<TValueType>{_10, _11}} 
 { }
 
 template<typename TType>
-DMatrix2<TType, EMatMajor::Row>::DMatrix2(const DVector2<TValueType>& _0, const DVector2<TValueType>& _1)
+constexpr DMatrix2<TType, EMatMajor::Row>::DMatrix2(const DVector2<TValueType>& _0, const DVector2<TValueType>& _1)
   : __mValues{_0, _1}
 { }
 
 template <typename TType>
-DVector2<typename DMatrix2<TType, EMatMajor::Row>::TValueType>& 
+constexpr DVector2<typename DMatrix2<TType, EMatMajor::Row>::TValueType>& 
 DMatrix2<TType, EMatMajor::Row>::operator[](TIndex index) noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-const DVector2<typename DMatrix2<TType, EMatMajor::Row>::TValueType>& 
+constexpr const DVector2<typename DMatrix2<TType, EMatMajor::Row>::TValueType>& 
 DMatrix2<TType, EMatMajor::Row>::operator[](TIndex index) const noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-DMatrix2<TType, EMatMajor::Row> DMatrix2<TType, EMatMajor::Row>::Transpose() const noexcept
+constexpr DMatrix2<TType, EMatMajor::Row> DMatrix2<TType, EMatMajor::Row>::Transpose() const noexcept
 {
   return DMatrix2
   {
@@ -193,23 +192,23 @@ DMatrix2<TType, EMatMajor::Row> DMatrix2<TType, EMatMajor::Row>::Transpose() con
 }
 
 template <typename TType>
-bool DMatrix2<TType, EMatMajor::Row>::IsInvertible() const noexcept
+constexpr bool DMatrix2<TType, EMatMajor::Row>::IsInvertible() const noexcept
 {
   return this->GetDeterminant() != TType(0.0);
 }
 
 template <typename TType>
-TType DMatrix2<TType, EMatMajor::Row>::GetDeterminant() const noexcept
+constexpr TType DMatrix2<TType, EMatMajor::Row>::GetDeterminant() const noexcept
 {
   return (*this)[0][0] * (*this)[1][1] - (*this)[1][0] * (*this)[0][1];
 }
 
 template <typename TType>
-DMatrix2<TType, EMatMajor::Row> DMatrix2<TType, EMatMajor::Row>::Inverse() const
+constexpr DMatrix2<TType, EMatMajor::Row> DMatrix2<TType, EMatMajor::Row>::Inverse() const
 {
   const auto det = this->GetDeterminant();
 
-  DMatrix2<TType, EMatMajor::Row> result;
+  DMatrix2<TType, EMatMajor::Row> result{};
   result[0][0] =  (*this)[1][1];
   result[1][1] =  (*this)[0][0];
   result[1][0] = -(*this)[1][0];
@@ -220,7 +219,7 @@ DMatrix2<TType, EMatMajor::Row> DMatrix2<TType, EMatMajor::Row>::Inverse() const
 }
 
 template<typename TType>
-DMatrix2<TType, EMatMajor::Column> DMatrix2<TType, EMatMajor::Row>::ConvertToColumnMatrix() const
+constexpr DMatrix2<TType, EMatMajor::Column> DMatrix2<TType, EMatMajor::Row>::ConvertToColumnMatrix() const
 {
   return {this->operator[](0), this->operator[](1)};
 }
@@ -277,12 +276,11 @@ std::vector<DVector2<TType>> DMatrix2<TType, EMatMajor::Row>::ToVector() const n
 }
 
 template <typename TType>
-DMatrix2<TType, EMatMajor::Row> DMatrix2<TType, EMatMajor::Row>::Identity() noexcept
+constexpr DMatrix2<TType, EMatMajor::Row> DMatrix2<TType, EMatMajor::Row>::Identity() noexcept
 {
   // 1 0
   // 0 1
-  static DMatrix2<TType, EMatMajor::Row> identity{1, 0, 0, 1};
-  return identity;
+  return DMatrix2{1, 0, 0, 1};
 }
 
 } /// ::dy::math namespace
@@ -21,7 +21,7 @@ namespace dy::math
 /// [c d]   [v1]
 /// https://en.wikibooks.org/wiki/GLSL_Programming/Vector_and_Matrix_Operations
 template <typename TLeft, typename TRight>
-DVector2<GetBiggerType<TLeft, TRight>> 
+constexpr DVector2<GetBiggerType<TLeft, TRight>> 
 operator*(const DMatrix2<TLeft, EMatMajor::Column>& lhs, const DVector2<TRight>& rhs) noexcept 
 {
   return 
@@ -32,7 +32,7 @@ operator*(const DMatrix2<TLeft, EMatMajor::Column>& lhs, const DVector2<TRight>&
 }
 
 template <typename TLeft, typename TRight>
-DVector2<GetBiggerType<TLeft, TRight>> 
+constexpr DVector2<GetBiggerType<TLeft, TRight>> 
 operator*(const DVector2<TLeft>& lhs, const DMatrix2<TRight, EMatMajor::Column>& rhs) noexcept 
 {
   return 
@@ -43,7 +43,7 @@ operator*(const DVector2<TLeft>& lhs, const DMatrix2<TRight, EMatMajor::Column>&
 }
 
 template <typename TLeft, typename TRight>
-DMatrix2<GetBiggerType<TLeft, TRight>, EMatMajor::Column> 
+constexpr DMatrix2<GetBiggerType<TLeft, TRight>, EMatMajor::Column> 
 operator*(const DMatrix2<TLeft, EMatMajor::Column>& lhs, const DMatrix2<TRight, EMatMajor::Column>& rhs) noexcept 
 {
   return 
@@ -56,7 +56,7 @@ operator*(const DMatrix2<TLeft, EMatMajor::Column>& lhs, const DMatrix2<TRight,
 }
 
 template <typename TLeft>
-DMatrix2<TLeft, EMatMajor::Column>& 
+constexpr DMatrix2<TLeft, EMatMajor::Column>& 
 operator*=(DMatrix2<TLeft, EMatMajor::Column>& lhs, const DMatrix2<TLeft, EMatMajor::Column>& rhs) noexcept 
 {
   const DVector2<TLeft> _0 = 
@@ -86,7 +86,7 @@ namespace dy::math
 /// [c d]   [v1]
 /// https://en.wikibooks.org/wiki/GLSL_Programming/Vector_and_Matrix_Operations
 template <typename TLeft, typename TRight>
-DVector2<GetBiggerType<TLeft, TRight>> 
+constexpr DVector2<GetBiggerType<TLeft, TRight>> 
 operator*(const DMatrix2<TLeft, EMatMajor::Row>& lhs, const DVector2<TRight>& rhs) noexcept 
 {
   return 
@@ -97,7 +97,7 @@ operator*(const DMatrix2<TLeft, EMatMajor::Row>& lhs, const DVector2<TRight>& rh
 }
 
 template <typename TLeft, typename TRight>
-DVector2<GetBiggerType<TLeft, TRight>> 
+constexpr DVector2<GetBiggerType<TLeft, TRight>> 
 operator*(const DVector2<TLeft>& lhs, const DMatrix2<TRight, EMatMajor::Row>& rhs) noexcept 
 {
   return 
@@ -108,7 +108,7 @@ operator*(const DVector2<TLeft>& lhs, const DMatrix2<TRight, EMatMajor::Row>& rh
 }
 
 template <typename TLeft, typename TRight>
-DMatrix2<GetBiggerType<TLeft, TRight>, EMatMajor::Row> 
+constexpr DMatrix2<GetBiggerType<TLeft, TRight>, EMatMajor::Row> 
 operator*(const DMatrix2<TLeft, EMatMajor::Row>& lhs, const DMatrix2<TRight, EMatMajor::Row>& rhs) noexcept 
 {
   return 
@@ -121,7 +121,7 @@ operator*(const DMatrix2<TLeft, EMatMajor::Row>& lhs, const DMatrix2<TRight, EMa
 }
 
 template <typename TLeft>
-DMatrix2<TLeft, EMatMajor::Row>& 
+constexpr DMatrix2<TLeft, EMatMajor::Row>& 
 operator*=(DMatrix2<TLeft, EMatMajor::Row>& lhs, const DMatrix2<TLeft, EMatMajor::Row>& rhs) noexcept 
 {
   const DVector2<TLeft> _0 = 
@@ -146,7 +146,7 @@ namespace dy::math
 {
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix2<TLeft, TMajor>& operator*=(const DMatrix2<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
+constexpr DMatrix2<TLeft, TMajor>& operator*=(const DMatrix2<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
 {
   lhs[0] *= rhs;
   lhs[1] *= rhs;
@@ -154,7 +154,7 @@ DMatrix2<TLeft, TMajor>& operator*=(const DMatrix2<TLeft, TMajor>& lhs, TLeft rh
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TRight>>>
-DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
 operator*(const DMatrix2<TLeft, TMajor>& lhs, TRight rhs) noexcept 
 {
   return 
@@ -165,7 +165,7 @@ operator*(const DMatrix2<TLeft, TMajor>& lhs, TRight rhs) noexcept
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TLeft>>>
-DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
 operator*(TLeft lhs, const DMatrix2<TRight, TMajor>& rhs) noexcept 
 {
   return 
@@ -177,7 +177,7 @@ operator*(TLeft lhs, const DMatrix2<TRight, TMajor>& rhs) noexcept
 
 /// @brief Elementary addition.
 template <typename TLeft, typename TRight, EMatMajor TMajor>
-DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
 operator+(const DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TRight, TMajor>& rhs) noexcept 
 {
   return 
@@ -188,7 +188,7 @@ operator+(const DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TRight, TMajor>& rh
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix2<TLeft, TMajor>& 
+constexpr DMatrix2<TLeft, TMajor>& 
 operator+=(DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TLeft, TMajor>& rhs) noexcept 
 {
   lhs[0] += rhs[0]; 
@@ -198,7 +198,7 @@ operator+=(DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TLeft, TMajor>& rhs) noe
 
 /// @brief Elementary subtraction.
 template <typename TLeft, typename TRight, EMatMajor TMajor>
-DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
 operator-(const DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TRight, TMajor>& rhs) noexcept 
 {
   return 
@@ -209,7 +209,7 @@ operator-(const DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TRight, TMajor>& rh
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix2<TLeft, TMajor>& 
+constexpr DMatrix2<TLeft, TMajor>& 
 operator-=(DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TLeft, TMajor>& rhs) noexcept 
 {
   lhs[0] -= rhs[0]; 
@@ -219,7 +219,7 @@ operator-=(DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TLeft, TMajor>& rhs) noe
 
 /// @brief Elementary multiplication.
 template <typename TLeft, typename TRight, EMatMajor TMajor>
-DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
 operator/(const DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TRight, TMajor>& rhs) noexcept 
 {
   return 
@@ -230,7 +230,7 @@ operator/(const DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TRight, TMajor>& rh
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix2<TLeft, TMajor>& 
+constexpr DMatrix2<TLeft, TMajor>& 
 operator/=(DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TLeft, TMajor>& rhs) noexcept 
 {
   lhs[0] /= rhs[0]; 
@@ -239,7 +239,7 @@ operator/=(DMatrix2<TLeft, TMajor>& lhs, const DMatrix2<TLeft, TMajor>& rhs) noe
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix2<TLeft, TMajor>& operator/=(DMatrix2<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
+constexpr DMatrix2<TLeft, TMajor>& operator/=(DMatrix2<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
 {
   lhs[0] /= rhs;
   lhs[1] /= rhs;
@@ -248,7 +248,7 @@ DMatrix2<TLeft, TMajor>& operator/=(DMatrix2<TLeft, TMajor>& lhs, TLeft rhs) noe
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TRight>>>
-DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
 operator/(const DMatrix2<TLeft, TMajor>& lhs, TRight rhs) noexcept 
 {
   return 
@@ -259,7 +259,7 @@ operator/(const DMatrix2<TLeft, TMajor>& lhs, TRight rhs) noexcept
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TLeft>>>
-DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix2<GetBiggerType<TLeft, TRight>, TMajor> 
 operator/(TLeft lhs, const DMatrix2<TRight, TMajor>& rhs) noexcept 
 {
   return 
@@ -270,13 +270,13 @@ operator/(TLeft lhs, const DMatrix2<TRight, TMajor>& rhs) noexcept
 }
 
 template <typename TType, EMatMajor TMajor>
-bool operator==(const DMatrix2<TType, TMajor>& lhs, const DMatrix2<TType, TMajor>& rhs) noexcept 
+constexpr bool operator==(const DMatrix2<TType, TMajor>& lhs, const DMatrix2<TType, TMajor>& rhs) noexcept 
 {
   return lhs[0] == rhs[0] && lhs[1] == rhs[1];
 }
 
 template <typename TType, EMatMajor TMajor>
-bool operator!=(const DMatrix2<TType, TMajor>& lhs, const DMatrix2<TType, TMajor>& rhs) noexcept 
+constexpr bool operator!=(const DMatrix2<TType, TMajor>& lhs, const DMatrix2<TType, TMajor>& rhs) noexcept 
 {
   return !(lhs == rhs);
 }
@@ -20,7 +20,7 @@ namespace dy::math
 {
 
 template <typename TType>
-DMatrix3<TType, EMatMajor::Column>::DMatrix3(
+constexpr DMatrix3<TType, EMatMajor::Column>::DMatrix3(
   TValueType _00, TValueType _01, TValueType _02, 
   TValueType _10, TValueType _11, TValueType _12, 
   TValueType _20, TValueType _21, TValueType _22)
@@ -31,7 +31,7 @@ DMatrix3<TType, EMatMajor::Column>::DMatrix3(
 { }
 
 template<typename TType>
-DMatrix3<TType, EMatMajor::Column>::DMatrix3(
+constexpr DMatrix3<TType, EMatMajor::Column>::DMatrix3(
   const DVector3<TValueType>& _0, 
   const DVector3<TValueType>& _1,
   const DVector3<TValueType>& _2)
@@ -39,21 +39,21 @@ DMatrix3<TType, EMatMajor::Column>::DMatrix3(
 { }
 
 template <typename TType>
-DVector3<typename DMatrix3<TType, EMatMajor::Column>::TValueType>& 
+constexpr DVector3<typename DMatrix3<TType, EMatMajor::Column>::TValueType>& 
 DMatrix3<TType, EMatMajor::Column>::operator[](TIndex index) noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-const DVector3<typename DMatrix3<TType, EMatMajor::Column>::TValueType>& 
+constexpr const DVector3<typename DMatrix3<TType, EMatMajor::Column>::TValueType>& 
 DMatrix3<TType, EMatMajor::Column>::operator[](TIndex index) const noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-DMatrix3<TType, EMatMajor::Column> DMatrix3<TType, EMatMajor::Column>::Transpose() const noexcept
+constexpr DMatrix3<TType, EMatMajor::Column> DMatrix3<TType, EMatMajor::Column>::Transpose() const noexcept
 {
   return DMatrix3
   {
@@ -64,13 +64,13 @@ DMatrix3<TType, EMatMajor::Column> DMatrix3<TType, EMatMajor::Column>::Transpose
 }
 
 template <typename TType>
-bool DMatrix3<TType, EMatMajor::Column>::IsInvertible() const noexcept
+constexpr bool DMatrix3<TType, EMatMajor::Column>::IsInvertible() const noexcept
 {
   return this->GetDeterminant() != TType(0.0);
 }
 
 template <typename TType>
-TType DMatrix3<TType, EMatMajor::Column>::GetDeterminant() const noexcept
+constexpr TType DMatrix3<TType, EMatMajor::Column>::GetDeterminant() const noexcept
 {
   return 
     + (*this)[0][0] * ((*this)[1][1] * (*this)[2][2] - (*this)[2][1] * (*this)[1][2])
@@ -79,7 +79,7 @@ TType DMatrix3<TType, EMatMajor::Column>::GetDeterminant() const noexcept
 }
 
 template <typename TType>
-DMatrix3<TType, EMatMajor::Column> DMatrix3<TType, EMatMajor::Column>::Inverse() const
+constexpr DMatrix3<TType, EMatMajor::Column> DMatrix3<TType, EMatMajor::Column>::Inverse() const
 {
   const auto det = this->GetDeterminant();
 
@@ -155,19 +155,18 @@ std::vector<DVector3<TType>> DMatrix3<TType, EMatMajor::Column>::ToVector() cons
 }
 
 template <typename TType>
-DMatrix3<TType, EMatMajor::Column> DMatrix3<TType, EMatMajor::Column>::Identity() noexcept
+constexpr DMatrix3<TType, EMatMajor::Column> DMatrix3<TType, EMatMajor::Column>::Identity() noexcept
 {
-  static DMatrix3<TType, EMatMajor::Column> identity
+  return DMatrix3
   {
     1, 0, 0, 
     0, 1, 0,
     0, 0, 1
   };
-  return identity;
 }
 
 template<typename TType>
-DMatrix3<TType, EMatMajor::Row> DMatrix3<TType, EMatMajor::Column>::ConvertToRowMatrix() const
+constexpr DMatrix3<TType, EMatMajor::Row> DMatrix3<TType, EMatMajor::Column>::ConvertToRowMatrix() const
 {
   return 
   {
@@ -185,7 +184,7 @@ namespace dy::math
 {
 
 template <typename TType>
-DMatrix3<TType, EMatMajor::Row>::DMatrix3(
+constexpr DMatrix3<TType, EMatMajor::Row>::DMatrix3(
   TValueType _00, TValueType _01, TValueType _02, 
   TValueType _10, TValueType _11, TValueType _12, 
   TValueType _20, TValueType _21, TValueType _22)
@@ -196,7 +195,7 @@ DMatrix3<TType, EMatMajor::Row>::DMatrix3(
 { }
 
 template<typename TType>
-DMatrix3<TType, EMatMajor::Row>::DMatrix3(
+constexpr DMatrix3<TType, EMatMajor::Row>::DMatrix3(
   const DVector3<TValueType>& _0, 
   const DVector3<TValueType>& _1,
   const DVector3<TValueType>& _2)
@@ -204,21 +203,21 @@ DMatrix3<TType, EMatMajor::Row>::DMatrix3(
 { }
 
 template <typename TType>
-DVector3<typename DMatrix3<TType, EMatMajor::Row>::TValueType>& 
+constexpr DVector3<typename DMatrix3<TType, EMatMajor::Row>::TValueType>& 
 DMatrix3<TType, EMatMajor::Row>::operator[](TIndex index) noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-const DVector3<typename DMatrix3<TType, EMatMajor::Row>::TValueType>& 
+constexpr const DVector3<typename DMatrix3<TType, EMatMajor::Row>::TValueType>& 
 DMatrix3<TType, EMatMajor::Row>::operator[](TIndex index) const noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-DMatrix3<TType, EMatMajor::Row> DMatrix3<TType, EMatMajor::Row>::Transpose() const noexcept
+constexpr DMatrix3<TType, EMatMajor::Row> DMatrix3<TType, EMatMajor::Row>::Transpose() const noexcept
 {
   return DMatrix3
   {
@@ -229,13 +228,13 @@ DMatrix3<TType, EMatMajor::Row> DMatrix3<TType, EMatMajor::Row>::Transpose() con
 }
 
 template <typename TType>
-bool DMatrix3<TType, EMatMajor::Row>::IsInvertible() const noexcept
+constexpr bool DMatrix3<TType, EMatMajor::Row>::IsInvertible() const noexcept
 {
   return this->GetDeterminant() != TType(0.0);
 }
 
 template <typename TType>
-TType DMatrix3<TType, EMatMajor::Row>::GetDeterminant() const noexcept
+constexpr TType DMatrix3<TType, EMatMajor::Row>::GetDeterminant() const noexcept
 {
   return 
     + (*this)[0][0] * ((*this)[1][1] * (*this)[2][2] - (*this)[2][1] * (*this)[1][2])
@@ -244,7 +243,7 @@ TType DMatrix3<TType, EMatMajor::Row>::GetDeterminant() const noexcept
 }
 
 template <typename TType>
-DMatrix3<TType, EMatMajor::Row> DMatrix3<TType, EMatMajor::Row>::Inverse() const
+constexpr DMatrix3<TType, EMatMajor::Row> DMatrix3<TType, EMatMajor::Row>::Inverse() const
 {
   const auto det = this->GetDeterminant();
 
@@ -320,19 +319,18 @@ std::vector<DVector3<TType>> DMatrix3<TType, EMatMajor::Row>::ToVector() const n
 }
 
 template <typename TType>
-DMatrix3<TType, EMatMajor::Row> DMatrix3<TType, EMatMajor::Row>::Identity() noexcept
+constexpr DMatrix3<TType, EMatMajor::Row> DMatrix3<TType, EMatMajor::Row>::Identity() noexcept
 {
-  static DMatrix3<TType, EMatMajor::Row> identity
+  return DMatrix3
   {
     1, 0, 0, 
     0, 1, 0,
     0, 0, 1
   };
-  return identity;
 }
 
 template<typename TType>
-DMatrix3<TType, EMatMajor::Column> DMatrix3<TType, EMatMajor::Row>::ConvertToColumnMatrix() const
+constexpr DMatrix3<TType, EMatMajor::Column> DMatrix3<TType, EMatMajor::Row>::ConvertToColumnMatrix() const
 {
   return 
   {
@@ -22,7 +22,7 @@ namespace dy::math
 /// [g h i]   [v2]
 /// https://en.wikibooks.org/wiki/GLSL_Programming/Vector_and_Matrix_Operations
 template <typename TLeft, typename TRight>
-DVector3<GetBiggerType<TLeft, TRight>> 
+constexpr DVector3<GetBiggerType<TLeft, TRight>> 
 operator*(const DMatrix3<TLeft, EMatMajor::Column>& lhs, const DVector3<TRight>& rhs) noexcept 
 {
   return 
@@ -34,7 +34,7 @@ operator*(const DMatrix3<TLeft, EMatMajor::Column>& lhs, const DVector3<TRight>&
 }
 
 template <typename TLeft, typename TRight>
-DVector3<GetBiggerType<TLeft, TRight>> 
+constexpr DVector3<GetBiggerType<TLeft, TRight>> 
 operator*(const DVector3<TLeft>& lhs, const DMatrix3<TRight, EMatMajor::Column>& rhs) noexcept 
 {
   return 
@@ -46,7 +46,7 @@ operator*(const DVector3<TLeft>& lhs, const DMatrix3<TRight, EMatMajor::Column>&
 }
 
 template <typename TLeft, typename TRight>
-DMatrix3<GetBiggerType<TLeft, TRight>, EMatMajor::Column> 
+constexpr DMatrix3<GetBiggerType<TLeft, TRight>, EMatMajor::Column> 
 operator*(const DMatrix3<TLeft, EMatMajor::Column>& lhs, const DMatrix3<TRight, EMatMajor::Column>& rhs) noexcept 
 {
   return 
@@ -66,7 +66,7 @@ operator*(const DMatrix3<TLeft, EMatMajor::Column>& lhs, const DMatrix3<TRight,
 }
 
 template <typename TLeft>
-DMatrix3<TLeft, EMatMajor::Column>& 
+constexpr DMatrix3<TLeft, EMatMajor::Column>& 
 operator*=(DMatrix3<TLeft, EMatMajor::Column>& lhs, const DMatrix3<TLeft, EMatMajor::Column>& rhs) noexcept 
 {
   const DVector3<TLeft> _0 = 
@@ -105,7 +105,7 @@ namespace dy::math
 /// [d e f]   [v1]
 /// [g h i]   [v2]
 template <typename TLeft, typename TRight>
-DVector3<GetBiggerType<TLeft, TRight>> 
+constexpr DVector3<GetBiggerType<TLeft, TRight>> 
 operator*(const DMatrix3<TLeft, EMatMajor::Row>& lhs, const DVector3<TRight>& rhs) noexcept 
 {
   return 
@@ -117,7 +117,7 @@ operator*(const DMatrix3<TLeft, EMatMajor::Row>& lhs, const DVector3<TRight>& rh
 }
 
 template <typename TLeft, typename TRight>
-DVector3<GetBiggerType<TLeft, TRight>> 
+constexpr DVector3<GetBiggerType<TLeft, TRight>> 
 operator*(const DVector3<TLeft>& lhs, const DMatrix3<TRight, EMatMajor::Row>& rhs) noexcept 
 {
   return 
@@ -129,7 +129,7 @@ operator*(const DVector3<TLeft>& lhs, const DMatrix3<TRight, EMatMajor::Row>& rh
 }
 
 template <typename TLeft, typename TRight>
-DMatrix3<GetBiggerType<TLeft, TRight>, EMatMajor::Row> 
+constexpr DMatrix3<GetBiggerType<TLeft, TRight>, EMatMajor::Row> 
 operator*(const DMatrix3<TLeft, EMatMajor::Row>& lhs, const DMatrix3<TRight, EMatMajor::Row>& rhs) noexcept 
 {
   return 
@@ -149,7 +149,7 @@ operator*(const DMatrix3<TLeft, EMatMajor::Row>& lhs, const DMatrix3<TRight, EMa
 }
 
 template <typename TLeft>
-DMatrix3<TLeft, EMatMajor::Row>& 
+constexpr DMatrix3<TLeft, EMatMajor::Row>& 
 operator*=(DMatrix3<TLeft, EMatMajor::Row>& lhs, const DMatrix3<TLeft, EMatMajor::Row>& rhs) noexcept 
 {
   const DVector3<TLeft> _0 = 
@@ -185,21 +185,21 @@ namespace dy::math
 {
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix3<TLeft, TMajor>& operator*=(const DMatrix3<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
+constexpr DMatrix3<TLeft, TMajor>& operator*=(const DMatrix3<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
 {
   lhs[0] *= rhs; lhs[1] *= rhs; lhs[2] *= rhs;
   return lhs;
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TRight>>>
-DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
 operator*(const DMatrix3<TLeft, TMajor>& lhs, TRight rhs) noexcept 
 {
   return { lhs[0] * rhs, lhs[1] * rhs, lhs[2] * rhs };
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TLeft>>>
-DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
 operator*(TLeft lhs, const DMatrix3<TRight, TMajor>& rhs) noexcept 
 {
   return { lhs * rhs[0], lhs * rhs[1], lhs * rhs[2] };
@@ -207,14 +207,14 @@ operator*(TLeft lhs, const DMatrix3<TRight, TMajor>& rhs) noexcept
 
 /// @brief Elementary addition.
 template <typename TLeft, typename TRight, EMatMajor TMajor>
-DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
 operator+(const DMatrix3<TLeft, TMajor>& lhs, const DMatrix3<TRight, TMajor>& rhs) noexcept 
 {
   return { lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2] };
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix3<TLeft, TMajor>& operator+=(DMatrix3<TLeft, TMajor>& lhs, const DMatrix3<TLeft, TMajor>& rhs) noexcept 
+constexpr DMatrix3<TLeft, TMajor>& operator+=(DMatrix3<TLeft, TMajor>& lhs, const DMatrix3<TLeft, TMajor>& rhs) noexcept 
 {
   lhs[0] += rhs[0]; lhs[1] += rhs[1]; lhs[2] += rhs[2];
   return lhs;
@@ -222,14 +222,14 @@ DMatrix3<TLeft, TMajor>& operator+=(DMatrix3<TLeft, TMajor>& lhs, const DMatrix3
 
 /// @brief Elementary subtraction.
 template <typename TLeft, typename TRight, EMatMajor TMajor>
-DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
 operator-(const DMatrix3<TLeft, TMajor>& lhs, const DMatrix3<TRight, TMajor>& rhs) noexcept 
 {
   return { lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2] };
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix3<TLeft, TMajor>& operator-=(DMatrix3<TLeft, TMajor>& lhs, const DMatrix3<TLeft, TMajor>& rhs) noexcept 
+constexpr DMatrix3<TLeft, TMajor>& operator-=(DMatrix3<TLeft, TMajor>& lhs, const DMatrix3<TLeft, TMajor>& rhs) noexcept 
 {
   lhs[0] -= rhs[0]; lhs[1] -= rhs[1]; lhs[2] -= rhs[2];
   return lhs;
@@ -237,48 +237,48 @@ DMatrix3<TLeft, TMajor>& operator-=(DMatrix3<TLeft, TMajor>& lhs, const DMatrix3
 
 /// @brief Elementary multiplication.
 template <typename TLeft, typename TRight, EMatMajor TMajor>
-DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
 operator/(const DMatrix3<TLeft, TMajor>& lhs, const DMatrix3<TRight, TMajor>& rhs) noexcept 
 {
   return { lhs[0] / rhs[0], lhs[1] / rhs[1], lhs[2] / rhs[2] };
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix3<TLeft, TMajor>& operator/=(DMatrix3<TLeft, TMajor>& lhs, const DMatrix3<TLeft, TMajor>& rhs) noexcept 
+constexpr DMatrix3<TLeft, TMajor>& operator/=(DMatrix3<TLeft, TMajor>& lhs, const DMatrix3<TLeft, TMajor>& rhs) noexcept 
 {
   lhs[0] /= rhs[0]; lhs[1] /= rhs[1]; lhs[2] /= rhs[2];
   return lhs;
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix3<TLeft, TMajor>& operator/=(DMatrix3<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
+constexpr DMatrix3<TLeft, TMajor>& operator/=(DMatrix3<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
 {
   lhs[0] /= rhs; lhs[1] /= rhs; lhs[2] /= rhs;
   return lhs;
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TRight>>>
-DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
 operator/(const DMatrix3<TLeft, TMajor>& lhs, TRight rhs) noexcept 
 {
   return { lhs[0] / rhs, lhs[1] / rhs, lhs[2] / rhs };
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TLeft>>>
-DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix3<GetBiggerType<TLeft, TRight>, TMajor> 
 operator/(TLeft lhs, const DMatrix3<TRight, TMajor>& rhs) noexcept 
 {
   return { lhs / rhs[0], lhs / rhs[1], lhs / rhs[2] };
 }
 
 template <typename TType, EMatMajor TMajor>
-bool operator==(const DMatrix3<TType, TMajor>& lhs, const DMatrix3<TType, TMajor>& rhs) noexcept 
+constexpr bool operator==(const DMatrix3<TType, TMajor>& lhs, const DMatrix3<TType, TMajor>& rhs) noexcept 
 {
   return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2];
 }
 
 template <typename TType, EMatMajor TMajor>
-bool operator!=(const DMatrix3<TType, TMajor>& lhs, const DMatrix3<TType, TMajor>& rhs) noexcept 
+constexpr bool operator!=(const DMatrix3<TType, TMajor>& lhs, const DMatrix3<TType, TMajor>& rhs) noexcept 
 {
   return !(lhs == rhs);
 }
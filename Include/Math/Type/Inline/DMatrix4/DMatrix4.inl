@@ -20,7 +20,7 @@ namespace dy::math
 {
 
 template <typename TType>
-DMatrix4<TType, EMatMajor::Column>::DMatrix4(
+constexpr DMatrix4<TType, EMatMajor::Column>::DMatrix4(
   TValueType _00, TValueType _01, TValueType _02, TValueType _03,
   TValueType _10, TValueType _11, TValueType _12, TValueType _13,
   TValueType _20, TValueType _21, TValueType _22, TValueType _23,
@@ -33,7 +33,7 @@ DMatrix4<TType, EMatMajor::Column>::DMatrix4(
 { }
 
 template<typename TType>
-DMatrix4<TType, EMatMajor::Column>::DMatrix4(
+constexpr DMatrix4<TType, EMatMajor::Column>::DMatrix4(
   const DVector4<TValueType>& _0, 
   const DVector4<TValueType>& _1,
   const DVector4<TValueType>& _2,
@@ -42,21 +42,21 @@ DMatrix4<TType, EMatMajor::Column>::DMatrix4(
 { }
 
 template <typename TType>
-DVector4<typename DMatrix4<TType, EMatMajor::Column>::TValueType>& 
+constexpr DVector4<typename DMatrix4<TType, EMatMajor::Column>::TValueType>& 
 DMatrix4<TType, EMatMajor::Column>::operator[](TIndex index) noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-const DVector4<typename DMatrix4<TType, EMatMajor::Column>::TValueType>& 
+constexpr const DVector4<typename DMatrix4<TType, EMatMajor::Column>::TValueType>& 
 DMatrix4<TType, EMatMajor::Column>::operator[](TIndex index) const noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-DMatrix4<TType, EMatMajor::Column> DMatrix4<TType, EMatMajor::Column>::Transpose() const noexcept
+constexpr DMatrix4<TType, EMatMajor::Column> DMatrix4<TType, EMatMajor::Column>::Transpose() const noexcept
 {
   return DMatrix4
   {
@@ -68,13 +68,13 @@ DMatrix4<TType, EMatMajor::Column> DMatrix4<TType, EMatMajor::Column>::Transpose
 }
 
 template <typename TType>
-bool DMatrix4<TType, EMatMajor::Column>::IsInvertible() const noexcept
+constexpr bool DMatrix4<TType, EMatMajor::Column>::IsInvertible() const noexcept
 {
   return this->GetDeterminant() != TType(0.0);
 }
 
 template <typename TType>
-TType DMatrix4<TType, EMatMajor::Column>::GetDeterminant() const noexcept
+constexpr TType DMatrix4<TType, EMatMajor::Column>::GetDeterminant() const noexcept
 {
   TType SubFactor00 = (*this)[2][2] * (*this)[3][3] - (*this)[3][2] * (*this)[2][3];
   TType SubFactor01 = (*this)[2][1] * (*this)[3][3] - (*this)[3][1] * (*this)[2][3];
@@ -97,7 +97,7 @@ TType DMatrix4<TType, EMatMajor::Column>::GetDeterminant() const noexcept
 }
 
 template <typename TType>
-DMatrix4<TType, EMatMajor::Column> DMatrix4<TType, EMatMajor::Column>::Inverse() const
+constexpr DMatrix4<TType, EMatMajor::Column> DMatrix4<TType, EMatMajor::Column>::Inverse() const
 {
   TType Coef00 = (*this)[2][2] * (*this)[3][3] - (*this)[3][2] * (*this)[2][3];
   TType Coef02 = (*this)[1][2] * (*this)[3][3] - (*this)[3][2] * (*this)[1][3];
@@ -207,7 +207,7 @@ std::vector<DVector4<TType>> DMatrix4<TType, EMatMajor::Column>::ToVector() cons
 }
 
 template<typename TType>
-DMatrix4<TType,EMatMajor::Row> DMatrix4<TType, EMatMajor::Column>::ConvertToRowMatrix() const
+constexpr DMatrix4<TType,EMatMajor::Row> DMatrix4<TType, EMatMajor::Column>::ConvertToRowMatrix() const
 {
   return
   {
@@ -219,16 +219,15 @@ DMatrix4<TType,EMatMajor::Row> DMatrix4<TType, EMatMajor::Column>::ConvertToRowM
 }
 
 template <typename TType>
-DMatrix4<TType, EMatMajor::Column> DMatrix4<TType, EMatMajor::Column>::Identity() noexcept
+constexpr DMatrix4<TType, EMatMajor::Column> DMatrix4<TType, EMatMajor::Column>::Identity() noexcept
 {
-  static DMatrix4<TType> identity
+  return DMatrix4
   {
     1, 0, 0, 0,
     0, 1, 0, 0,
     0, 0, 1, 0,
     0, 0, 0, 1
   };
-  return identity;
 }
 
 } /// ::dy::math namespace
@@ -239,7 +238,7 @@ namespace dy::math
 {
 
 template <typename TType>
-DMatrix4<TType, EMatMajor::Row>::DMatrix4(
+constexpr DMatrix4<TType, EMatMajor::Row>::DMatrix4(
   TValueType _00, TValueType _01, TValueType _02, TValueType _03,
   TValueType _10, TValueType _11, TValueType _12, TValueType _13,
   TValueType _20, TValueType _21, TValueType _22, TValueType _23,
@@ -252,7 +251,7 @@ DMatrix4<TType, EMatMajor::Row>::DMatrix4(
 { }
 
 template<typename TType>
-DMatrix4<TType, EMatMajor::Row>::DMatrix4(
+constexpr DMatrix4<TType, EMatMajor::Row>::DMatrix4(
   const DVector4<TValueType>& _0, 
   const DVector4<TValueType>& _1,
   const DVector4<TValueType>& _2,
@@ -261,21 +260,21 @@ DMatrix4<TType, EMatMajor::Row>::DMatrix4(
 { }
 
 template <typename TType>
-DVector4<typename DMatrix4<TType, EMatMajor::Row>::TValueType>& 
+constexpr DVector4<typename DMatrix4<TType, EMatMajor::Row>::TValueType>& 
 DMatrix4<TType, EMatMajor::Row>::operator[](TIndex index) noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-const DVector4<typename DMatrix4<TType, EMatMajor::Row>::TValueType>& 
+constexpr const DVector4<typename DMatrix4<TType, EMatMajor::Row>::TValueType>& 
 DMatrix4<TType, EMatMajor::Row>::operator[](TIndex index) const noexcept
 {
   return this->__mValues[index];
 }
 
 template <typename TType>
-DMatrix4<TType, EMatMajor::Row> DMatrix4<TType, EMatMajor::Row>::Transpose() const noexcept
+constexpr DMatrix4<TType, EMatMajor::Row> DMatrix4<TType, EMatMajor::Row>::Transpose() const noexcept
 {
   return DMatrix4
   {
@@ -287,13 +286,13 @@ DMatrix4<TType, EMatMajor::Row> DMatrix4<TType, EMatMajor::Row>::Transpose() con
 }
 
 template <typename TType>
-bool DMatrix4<TType, EMatMajor::Row>::IsInvertible() const noexcept
+constexpr bool DMatrix4<TType, EMatMajor::Row>::IsInvertible() const noexcept
 {
   return this->GetDeterminant() != TType(0.0);
 }
 
 template <typename TType>
-TType DMatrix4<TType, EMatMajor::Row>::GetDeterminant() const noexcept
+constexpr TType DMatrix4<TType, EMatMajor::Row>::GetDeterminant() const noexcept
 {
   TType SubFactor00 = (*this)[2][2] * (*this)[3][3] - (*this)[3][2] * (*this)[2][3];
   TType SubFactor01 = (*this)[2][1] * (*this)[3][3] - (*this)[3][1] * (*this)[2][3];
@@ -316,7 +315,7 @@ TType DMatrix4<TType, EMatMajor::Row>::GetDeterminant() const noexcept
 }
 
 template <typename TType>
-DMatrix4<TType, EMatMajor::Row> DMatrix4<TType, EMatMajor::Row>::Inverse() const
+constexpr DMatrix4<TType, EMatMajor::Row> DMatrix4<TType, EMatMajor::Row>::Inverse() const
 {
   TType Coef00 = (*this)[2][2] * (*this)[3][3] - (*this)[3][2] * (*this)[2][3];
   TType Coef02 = (*this)[1][2] * (*this)[3][3] - (*this)[3][2] * (*this)[1][3];
@@ -426,7 +425,7 @@ std::vector<DVector4<TType>> DMatrix4<TType, EMatMajor::Row>::ToVector() const n
 }
 
 template<typename TType>
-DMatrix4<TType,EMatMajor::Column> DMatrix4<TType, EMatMajor::Row>::ConvertToColumnMatrix() const
+constexpr DMatrix4<TType,EMatMajor::Column> DMatrix4<TType, EMatMajor::Row>::ConvertToColumnMatrix() const
 {
   return
   {
@@ -438,16 +437,15 @@ DMatrix4<TType,EMatMajor::Column> DMatrix4<TType, EMatMajor::Row>::ConvertToColu
 }
 
 template <typename TType>
-DMatrix4<TType, EMatMajor::Row> DMatrix4<TType, EMatMajor::Row>::Identity() noexcept
+constexpr DMatrix4<TType, EMatMajor::Row> DMatrix4<TType, EMatMajor::Row>::Identity() noexcept
 {
-  static DMatrix4<TType> identity
+  return DMatrix4
   {
     1, 0, 0, 0,
     0, 1, 0, 0,
     0, 0, 1, 0,
     0, 0, 0, 1
   };
-  return identity;
 }
 
 } /// ::dy::math namespace
@@ -23,7 +23,7 @@ namespace dy::math
 /// [m n o p]   [v3]
 /// https://en.wikibooks.org/wiki/GLSL_Programming/Vector_and_Matrix_Operations
 template <typename TLeft, typename TRight>
-DVector4<GetBiggerType<TLeft, TRight>> 
+constexpr DVector4<GetBiggerType<TLeft, TRight>> 
 operator*(const DMatrix4<TLeft, EMatMajor::Column>& lhs, const DVector4<TRight>& rhs) noexcept 
 {
   return 
@@ -36,7 +36,7 @@ operator*(const DMatrix4<TLeft, EMatMajor::Column>& lhs, const DVector4<TRight>&
 }
 
 template <typename TLeft, typename TRight>
-DVector4<GetBiggerType<TLeft, TRight>> 
+constexpr DVector4<GetBiggerType<TLeft, TRight>> 
 operator*(const DVector4<TLeft>& lhs, const DMatrix4<TRight, EMatMajor::Column>& rhs) noexcept 
 {
   return 
@@ -49,7 +49,7 @@ operator*(const DVector4<TLeft>& lhs, const DMatrix4<TRight, EMatMajor::Column>&
 }
 
 template <typename TLeft, typename TRight>
-DMatrix4<GetBiggerType<TLeft, TRight>, EMatMajor::Column> 
+constexpr DMatrix4<GetBiggerType<TLeft, TRight>, EMatMajor::Column> 
 operator*(const DMatrix4<TLeft, EMatMajor::Column>& lhs, const DMatrix4<TRight, EMatMajor::Column>& rhs) noexcept 
 {
   return 
@@ -77,7 +77,7 @@ operator*(const DMatrix4<TLeft, EMatMajor::Column>& lhs, const DMatrix4<TRight,
 }
 
 template <typename TLeft>
-DMatrix4<TLeft, EMatMajor::Column>& 
+constexpr DMatrix4<TLeft, EMatMajor::Column>& 
 operator*=(DMatrix4<TLeft, EMatMajor::Column>& lhs, const DMatrix4<TLeft, EMatMajor::Column>& rhs) noexcept 
 {
   const DVector4<TLeft> _0 = 
@@ -129,7 +129,7 @@ namespace dy::math
 /// [m n o p]   [v3]
 /// https://en.wikibooks.org/wiki/GLSL_Programming/Vector_and_Matrix_Operations
 template <typename TLeft, typename TRight>
-DVector4<GetBiggerType<TLeft, TRight>> 
+constexpr DVector4<GetBiggerType<TLeft, TRight>> 
 operator*(const DMatrix4<TLeft, EMatMajor::Row>& lhs, const DVector4<TRight>& rhs) noexcept 
 {
   return 
@@ -142,7 +142,7 @@ operator*(const DMatrix4<TLeft, EMatMajor::Row>& lhs, const DVector4<TRight>& rh
 }
 
 template <typename TLeft, typename TRight>
-DVector4<GetBiggerType<TLeft, TRight>> 
+constexpr DVector4<GetBiggerType<TLeft, TRight>> 
 operator*(const DVector4<TLeft>& lhs, const DMatrix4<TRight, EMatMajor::Row>& rhs) noexcept 
 {
   return 
@@ -155,7 +155,7 @@ operator*(const DVector4<TLeft>& lhs, const DMatrix4<TRight, EMatMajor::Row>& rh
 }
 
 template <typename TLeft, typename TRight>
-DMatrix4<GetBiggerType<TLeft, TRight>, EMatMajor::Row> 
+constexpr DMatrix4<GetBiggerType<TLeft, TRight>, EMatMajor::Row> 
 operator*(const DMatrix4<TLeft, EMatMajor::Row>& lhs, const DMatrix4<TRight, EMatMajor::Row>& rhs) noexcept 
 {
   return 
@@ -183,7 +183,7 @@ operator*(const DMatrix4<TLeft, EMatMajor::Row>& lhs, const DMatrix4<TRight, EMa
 }
 
 template <typename TLeft>
-DMatrix4<TLeft, EMatMajor::Row>& 
+constexpr DMatrix4<TLeft, EMatMajor::Row>& 
 operator*=(DMatrix4<TLeft, EMatMajor::Row>& lhs, const DMatrix4<TLeft, EMatMajor::Row>& rhs) noexcept 
 {
   const DVector4<TLeft> _0 = 
@@ -231,21 +231,21 @@ namespace dy::math
 
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix4<TLeft, TMajor>& operator*=(const DMatrix4<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
+constexpr DMatrix4<TLeft, TMajor>& operator*=(const DMatrix4<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
 {
   lhs[0] *= rhs; lhs[1] *= rhs; lhs[2] *= rhs; lhs[3] *= rhs;
   return lhs;
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TRight>>>
-DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
 operator*(const DMatrix4<TLeft, TMajor>& lhs, TRight rhs) noexcept 
 {
   return { lhs[0] * rhs, lhs[1] * rhs, lhs[2] * rhs, lhs[3] * rhs };
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TLeft>>>
-DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
 operator*(TLeft lhs, const DMatrix4<TRight, TMajor>& rhs) noexcept 
 {
   return { lhs * rhs[0], lhs * rhs[1], lhs * rhs[2], lhs * rhs[3] };
@@ -253,14 +253,14 @@ operator*(TLeft lhs, const DMatrix4<TRight, TMajor>& rhs) noexcept
 
 /// @brief Elementary addition.
 template <typename TLeft, typename TRight, EMatMajor TMajor>
-DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
 operator+(const DMatrix4<TLeft, TMajor>& lhs, const DMatrix4<TRight, TMajor>& rhs) noexcept 
 {
   return { lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2], lhs[3] + rhs[3] };
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix4<TLeft, TMajor>& operator+=(DMatrix4<TLeft, TMajor>& lhs, const DMatrix4<TLeft, TMajor>& rhs) noexcept 
+constexpr DMatrix4<TLeft, TMajor>& operator+=(DMatrix4<TLeft, TMajor>& lhs, const DMatrix4<TLeft, TMajor>& rhs) noexcept 
 {
   lhs[0] += rhs[0]; lhs[1] += rhs[1]; lhs[2] += rhs[2]; lhs[3] += rhs[3];
   return lhs;
@@ -268,14 +268,14 @@ DMatrix4<TLeft, TMajor>& operator+=(DMatrix4<TLeft, TMajor>& lhs, const DMatrix4
 
 /// @brief Elementary subtraction.
 template <typename TLeft, typename TRight, EMatMajor TMajor>
-DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
 operator-(const DMatrix4<TLeft, TMajor>& lhs, const DMatrix4<TRight, TMajor>& rhs) noexcept 
 {
   return { lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], lhs[3] - rhs[3] };
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix4<TLeft, TMajor>& operator-=(DMatrix4<TLeft, TMajor>& lhs, const DMatrix4<TLeft, TMajor>& rhs) noexcept 
+constexpr DMatrix4<TLeft, TMajor>& operator-=(DMatrix4<TLeft, TMajor>& lhs, const DMatrix4<TLeft, TMajor>& rhs) noexcept 
 {
   lhs[0] -= rhs[0]; lhs[1] -= rhs[1]; lhs[2] -= rhs[2]; lhs[3] -= rhs[3];
   return lhs;
@@ -283,48 +283,48 @@ DMatrix4<TLeft, TMajor>& operator-=(DMatrix4<TLeft, TMajor>& lhs, const DMatrix4
 
 /// @brief Elementary multiplication.
 template <typename TLeft, typename TRight, EMatMajor TMajor>
-DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
 operator/(const DMatrix4<TLeft, TMajor>& lhs, const DMatrix4<TRight, TMajor>& rhs) noexcept 
 {
   return { lhs[0] / rhs[0], lhs[1] / rhs[1], lhs[2] / rhs[2], lhs[3] / rhs[3] };
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix4<TLeft, TMajor>& operator/=(DMatrix4<TLeft, TMajor>& lhs, const DMatrix4<TLeft, TMajor>& rhs) noexcept 
+constexpr DMatrix4<TLeft, TMajor>& operator/=(DMatrix4<TLeft, TMajor>& lhs, const DMatrix4<TLeft, TMajor>& rhs) noexcept 
 {
   lhs[0] /= rhs[0]; lhs[1] /= rhs[1]; lhs[2] /= rhs[2]; lhs[3] /= rhs[3];
   return lhs;
 }
 
 template <typename TLeft, EMatMajor TMajor>
-DMatrix4<TLeft, TMajor>& operator/=(DMatrix4<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
+constexpr DMatrix4<TLeft, TMajor>& operator/=(DMatrix4<TLeft, TMajor>& lhs, TLeft rhs) noexcept 
 {
   lhs[0] /= rhs; lhs[1] /= rhs; lhs[2] /= rhs; lhs[3] /= rhs;
   return lhs;
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TRight>>>
-DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
 operator/(const DMatrix4<TLeft, TMajor>& lhs, TRight rhs) noexcept 
 {
   return { lhs[0] / rhs, lhs[1] / rhs, lhs[2] / rhs, lhs[3] / rhs };
 }
 
 template <typename TLeft, typename TRight, EMatMajor TMajor, typename = std::enable_if_t<std::is_arithmetic_v<TLeft>>>
-DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
+constexpr DMatrix4<GetBiggerType<TLeft, TRight>, TMajor> 
 operator/(TLeft lhs, const DMatrix4<TRight, TMajor>& rhs) noexcept 
 {
   return { lhs / rhs[0], lhs / rhs[1], lhs / rhs[2], lhs / rhs[3] };
 }
 
 template <typename TType, EMatMajor TMajor>
-bool operator==(const DMatrix4<TType, TMajor>& lhs, const DMatrix4<TType, TMajor>& rhs) noexcept 
+constexpr bool operator==(const DMatrix4<TType, TMajor>& lhs, const DMatrix4<TType, TMajor>& rhs) noexcept 
 {
   return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3];
 }
 
 template <typename TType, EMatMajor TMajor>
-bool operator!=(const DMatrix4<TType, TMajor>& lhs, const DMatrix4<TType, TMajor>& rhs) noexcept 
+constexpr bool operator!=(const DMatrix4<TType, TMajor>& lhs, const DMatrix4<TType, TMajor>& rhs) noexcept 
 {
   return !(lhs == rhs);
 }
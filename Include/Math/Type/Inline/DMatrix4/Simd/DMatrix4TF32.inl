@@ -0,0 +1,329 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+/// SIMD specialization of DMatrix4<TF32>.
+/// Each storage vector (column of column-major, row of row-major) is a `__m128`,
+/// so multiply, transpose, determinant and inverse are done without scalar indexing.
+/// All functions keep the operation order of scalar implementation,
+/// so results are same to scalar path as long as scalar code is not FMA-contracted.
+
+#ifdef MATH_ENABLE_SIMD
+#include <emmintrin.h>
+#include <smmintrin.h>
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+namespace dy::math::details
+{
+
+/// @brief Broadcast `TLane` lane of `value` to all lanes.
+template <int TLane>
+inline __m128 SplatLaneOf(__m128 value) noexcept
+{
+  return _mm_shuffle_ps(value, value, _MM_SHUFFLE(TLane, TLane, TLane, TLane));
+}
+
+/// @brief Return `((v0 * s0 + v1 * s1) + v2 * s2) + v3 * s3`,
+/// where `sN` is `N` lane of `scalars` broadcasted.
+inline __m128 LinearCombineOf(__m128 v0, __m128 v1, __m128 v2, __m128 v3, __m128 scalars) noexcept
+{
+  __m128 result = _mm_mul_ps(v0, SplatLaneOf<0>(scalars));
+  result = _mm_add_ps(result, _mm_mul_ps(v1, SplatLaneOf<1>(scalars)));
+  result = _mm_add_ps(result, _mm_mul_ps(v2, SplatLaneOf<2>(scalars)));
+  result = _mm_add_ps(result, _mm_mul_ps(v3, SplatLaneOf<3>(scalars)));
+  return result;
+}
+
+/// @brief Multiply storage vectors of two matrices as `result[j] = sum_k lhs[k] * rhs[j][k]`.
+/// This is column-major `lhs * rhs`, and row-major `rhs * lhs`.
+inline void MultiplyStorageOf(
+  const std::array<DVector4<TF32>, 4>& lhs,
+  const std::array<DVector4<TF32>, 4>& rhs,
+  std::array<DVector4<TF32>, 4>& result) noexcept
+{
+#if defined(__AVX__)
+  // Process two result vectors at once.
+  // Each 128-bit half of `rhs` pair is broadcasted by `_mm256_shuffle_ps` within own half.
+  const __m256 l0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[0].Data()));
+  const __m256 l1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[1].Data()));
+  const __m256 l2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[2].Data()));
+  const __m256 l3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs[3].Data()));
+  for (TIndex j = 0; j < 4; j += 2)
+  {
+    const __m256 r = _mm256_set_m128(rhs[j + 1].__GetSimd(), rhs[j].__GetSimd());
+    __m256 value = _mm256_mul_ps(l0, _mm256_shuffle_ps(r, r, _MM_SHUFFLE(0, 0, 0, 0)));
+    value = _mm256_add_ps(value, _mm256_mul_ps(l1, _mm256_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1))));
+    value = _mm256_add_ps(value, _mm256_mul_ps(l2, _mm256_shuffle_ps(r, r, _MM_SHUFFLE(2, 2, 2, 2))));
+    value = _mm256_add_ps(value, _mm256_mul_ps(l3, _mm256_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3))));
+    result[j].__SetSimd(_mm256_castps256_ps128(value));
+    result[j + 1].__SetSimd(_mm256_extractf128_ps(value, 1));
+  }
+#else
+  for (TIndex j = 0; j < 4; ++j)
+  {
+    result[j].__SetSimd(LinearCombineOf(
+      lhs[0].__GetSimd(), lhs[1].__GetSimd(), lhs[2].__GetSimd(), lhs[3].__GetSimd(),
+      rhs[j].__GetSimd()));
+  }
+#endif
+}
+
+/// @brief Transpose storage vectors.
+inline std::array<DVector4<TF32>, 4>
+TransposeStorageOf(const std::array<DVector4<TF32>, 4>& values) noexcept
+{
+  __m128 v0 = values[0].__GetSimd();
+  __m128 v1 = values[1].__GetSimd();
+  __m128 v2 = values[2].__GetSimd();
+  __m128 v3 = values[3].__GetSimd();
+  _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+  return {DVector4<TF32>{v0}, DVector4<TF32>{v1}, DVector4<TF32>{v2}, DVector4<TF32>{v3}};
+}
+
+/// @brief Return `(value[TL0], value[TL1], value[TL2], value[TL3])`.
+template <int TL0, int TL1, int TL2, int TL3>
+inline __m128 ShuffleOf(__m128 value) noexcept
+{
+  return _mm_shuffle_ps(value, value, _MM_SHUFFLE(TL3, TL2, TL1, TL0));
+}
+
+/// @brief Get determinant of storage vectors.
+/// Determinant is same for both transposed and original matrix, so both major can use this.
+inline TF32 GetDeterminantOfStorage(const std::array<DVector4<TF32>, 4>& m) noexcept
+{
+  // SubFactor(p, q) = m[2][p] * m[3][q] - m[3][p] * m[2][q].
+  // DetCof = (A * FA - B * FB + C * FC) * (+1, -1, +1, -1), where
+  // A = m[1](1, 0, 0, 0), FA = (SubFactor00, SubFactor00, SubFactor01, SubFactor02),
+  // B = m[1](2, 2, 1, 1), FB = (SubFactor01, SubFactor03, SubFactor03, SubFactor04),
+  // C = m[1](3, 3, 3, 2), FC = (SubFactor02, SubFactor04, SubFactor05, SubFactor05).
+  const __m128 m2P = ShuffleOf<2, 2, 1, 1>(m[2].__GetSimd());
+  const __m128 m2Q = ShuffleOf<3, 3, 3, 2>(m[2].__GetSimd());
+  const __m128 m2R = ShuffleOf<1, 0, 0, 0>(m[2].__GetSimd());
+  const __m128 m3P = ShuffleOf<2, 2, 1, 1>(m[3].__GetSimd());
+  const __m128 m3Q = ShuffleOf<3, 3, 3, 2>(m[3].__GetSimd());
+  const __m128 m3R = ShuffleOf<1, 0, 0, 0>(m[3].__GetSimd());
+
+  const __m128 fa = _mm_sub_ps(_mm_mul_ps(m2P, m3Q), _mm_mul_ps(m3P, m2Q));
+  const __m128 fb = _mm_sub_ps(_mm_mul_ps(m2R, m3Q), _mm_mul_ps(m3R, m2Q));
+  const __m128 fc = _mm_sub_ps(_mm_mul_ps(m2R, m3P), _mm_mul_ps(m3R, m2P));
+
+  const __m128 a = ShuffleOf<1, 0, 0, 0>(m[1].__GetSimd());
+  const __m128 b = ShuffleOf<2, 2, 1, 1>(m[1].__GetSimd());
+  const __m128 c = ShuffleOf<3, 3, 3, 2>(m[1].__GetSimd());
+
+  __m128 detCof = _mm_sub_ps(_mm_mul_ps(a, fa), _mm_mul_ps(b, fb));
+  detCof = _mm_add_ps(detCof, _mm_mul_ps(c, fc));
+  detCof = _mm_xor_ps(detCof, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+
+  // Sum from x to w one by one, as scalar code does.
+  const __m128 dot = _mm_mul_ps(m[0].__GetSimd(), detCof);
+  __m128 sum = _mm_add_ss(dot, SplatLaneOf<1>(dot));
+  sum = _mm_add_ss(sum, SplatLaneOf<2>(dot));
+  sum = _mm_add_ss(sum, SplatLaneOf<3>(dot));
+  return _mm_cvtss_f32(sum);
+}
+
+/// @brief Get `fac` vector of inverse,
+/// `(Coef(a, b), Coef(a, b), Coef'(a, b), Coef''(a, b))` where
+/// `Coef(a, b) = m[2][a] * m[3][b] - m[3][a] * m[2][b]`,
+/// `Coef'(a, b) = m[1][a] * m[3][b] - m[3][a] * m[1][b]`,
+/// `Coef''(a, b) = m[1][a] * m[2][b] - m[2][a] * m[1][b]`.
+template <int TA, int TB>
+inline __m128 GetInverseFactorOf(__m128 m1, __m128 m2, __m128 m3) noexcept
+{
+  // (m[2][x], m[2][x], m[1][x], m[1][x]) and (m[3][x], m[3][x], m[3][x], m[2][x]).
+  const __m128 xa = _mm_shuffle_ps(m2, m1, _MM_SHUFFLE(TA, TA, TA, TA));
+  const __m128 xb = _mm_shuffle_ps(m2, m1, _MM_SHUFFLE(TB, TB, TB, TB));
+  const __m128 ya = ShuffleOf<0, 0, 0, 2>(_mm_shuffle_ps(m3, m2, _MM_SHUFFLE(TA, TA, TA, TA)));
+  const __m128 yb = ShuffleOf<0, 0, 0, 2>(_mm_shuffle_ps(m3, m2, _MM_SHUFFLE(TB, TB, TB, TB)));
+  return _mm_sub_ps(_mm_mul_ps(xa, yb), _mm_mul_ps(ya, xb));
+}
+
+/// @brief Get `(m[1][x], m[0][x], m[0][x], m[0][x])`.
+template <int TX>
+inline __m128 GetInverseVectorOf(__m128 m0, __m128 m1) noexcept
+{
+  return ShuffleOf<0, 2, 2, 2>(_mm_shuffle_ps(m1, m0, _MM_SHUFFLE(TX, TX, TX, TX)));
+}
+
+/// @brief Get inverse of storage vectors.
+/// Inverse of transposed matrix is transposed inverse, so both major can use this.
+inline std::array<DVector4<TF32>, 4>
+InverseStorageOf(const std::array<DVector4<TF32>, 4>& m) noexcept
+{
+  const __m128 m0 = m[0].__GetSimd();
+  const __m128 m1 = m[1].__GetSimd();
+  const __m128 m2 = m[2].__GetSimd();
+  const __m128 m3 = m[3].__GetSimd();
+
+  const __m128 fac0 = GetInverseFactorOf<2, 3>(m1, m2, m3);
+  const __m128 fac1 = GetInverseFactorOf<1, 3>(m1, m2, m3);
+  const __m128 fac2 = GetInverseFactorOf<1, 2>(m1, m2, m3);
+  const __m128 fac3 = GetInverseFactorOf<0, 3>(m1, m2, m3);
+  const __m128 fac4 = GetInverseFactorOf<0, 2>(m1, m2, m3);
+  const __m128 fac5 = GetInverseFactorOf<0, 1>(m1, m2, m3);
+
+  const __m128 vec0 = GetInverseVectorOf<0>(m0, m1);
+  const __m128 vec1 = GetInverseVectorOf<1>(m0, m1);
+  const __m128 vec2 = GetInverseVectorOf<2>(m0, m1);
+  const __m128 vec3 = GetInverseVectorOf<3>(m0, m1);
+
+  const auto Cofactor = [](__m128 va, __m128 fa, __m128 vb, __m128 fb, __m128 vc, __m128 fc)
+  {
+    return _mm_add_ps(_mm_sub_ps(_mm_mul_ps(va, fa), _mm_mul_ps(vb, fb)), _mm_mul_ps(vc, fc));
+  };
+
+  const __m128 signA = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+  const __m128 signB = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+  const __m128 inv0 = _mm_xor_ps(Cofactor(vec1, fac0, vec2, fac1, vec3, fac2), signA);
+  const __m128 inv1 = _mm_xor_ps(Cofactor(vec0, fac0, vec2, fac3, vec3, fac4), signB);
+  const __m128 inv2 = _mm_xor_ps(Cofactor(vec0, fac1, vec1, fac3, vec3, fac5), signA);
+  const __m128 inv3 = _mm_xor_ps(Cofactor(vec0, fac2, vec1, fac4, vec2, fac5), signB);
+
+  // row0 = (inv0[0], inv1[0], inv2[0], inv3[0]), det = (x + y) + (z + w) of m[0] * row0.
+  const __m128 row0 = _mm_shuffle_ps(
+    _mm_shuffle_ps(inv0, inv1, _MM_SHUFFLE(0, 0, 0, 0)),
+    _mm_shuffle_ps(inv2, inv3, _MM_SHUFFLE(0, 0, 0, 0)),
+    _MM_SHUFFLE(2, 0, 2, 0));
+  const __m128 dot0 = _mm_mul_ps(m0, row0);
+  const __m128 pair = _mm_add_ps(dot0, ShuffleOf<1, 0, 3, 2>(dot0));
+  const __m128 det  = _mm_add_ps(pair, ShuffleOf<2, 3, 0, 1>(pair));
+
+  return
+  {
+    DVector4<TF32>{_mm_div_ps(inv0, det)}, DVector4<TF32>{_mm_div_ps(inv1, det)},
+    DVector4<TF32>{_mm_div_ps(inv2, det)}, DVector4<TF32>{_mm_div_ps(inv3, det)}
+  };
+}
+
+} /// ::dy::math::details namespace
+
+// Column Major
+
+namespace dy::math
+{
+
+template <>
+inline DMatrix4<TF32, EMatMajor::Column> DMatrix4<TF32, EMatMajor::Column>::Transpose() const noexcept
+{
+  DMatrix4 result;
+  result.__mValues = details::TransposeStorageOf(this->__mValues);
+  return result;
+}
+
+template <>
+inline TF32 DMatrix4<TF32, EMatMajor::Column>::GetDeterminant() const noexcept
+{
+  return details::GetDeterminantOfStorage(this->__mValues);
+}
+
+template <>
+inline DMatrix4<TF32, EMatMajor::Column> DMatrix4<TF32, EMatMajor::Column>::Inverse() const
+{
+  DMatrix4 result;
+  result.__mValues = details::InverseStorageOf(this->__mValues);
+  return result;
+}
+
+inline DVector4<TF32>
+operator*(const DMatrix4<TF32, EMatMajor::Column>& lhs, const DVector4<TF32>& rhs) noexcept
+{
+  return {details::LinearCombineOf(lhs[0].__GetSimd(), lhs[1].__GetSimd(), lhs[2].__GetSimd(), lhs[3].__GetSimd(), rhs.__GetSimd())};
+}
+
+inline DVector4<TF32>
+operator*(const DVector4<TF32>& lhs, const DMatrix4<TF32, EMatMajor::Column>& rhs) noexcept
+{
+  // Each column dotted with lhs is each row of transposed matrix combined by lhs.
+  const auto rows = details::TransposeStorageOf(rhs.__mValues);
+  return {details::LinearCombineOf(rows[0].__GetSimd(), rows[1].__GetSimd(), rows[2].__GetSimd(), rows[3].__GetSimd(), lhs.__GetSimd())};
+}
+
+inline DMatrix4<TF32, EMatMajor::Column>
+operator*(const DMatrix4<TF32, EMatMajor::Column>& lhs, const DMatrix4<TF32, EMatMajor::Column>& rhs) noexcept
+{
+  DMatrix4<TF32, EMatMajor::Column> result;
+  details::MultiplyStorageOf(lhs.__mValues, rhs.__mValues, result.__mValues);
+  return result;
+}
+
+inline DMatrix4<TF32, EMatMajor::Column>&
+operator*=(DMatrix4<TF32, EMatMajor::Column>& lhs, const DMatrix4<TF32, EMatMajor::Column>& rhs) noexcept
+{
+  lhs = lhs * rhs;
+  return lhs;
+}
+
+} /// ::dy::math namespace
+
+// Row Major
+
+namespace dy::math
+{
+
+template <>
+inline DMatrix4<TF32, EMatMajor::Row> DMatrix4<TF32, EMatMajor::Row>::Transpose() const noexcept
+{
+  DMatrix4 result;
+  result.__mValues = details::TransposeStorageOf(this->__mValues);
+  return result;
+}
+
+template <>
+inline TF32 DMatrix4<TF32, EMatMajor::Row>::GetDeterminant() const noexcept
+{
+  return details::GetDeterminantOfStorage(this->__mValues);
+}
+
+template <>
+inline DMatrix4<TF32, EMatMajor::Row> DMatrix4<TF32, EMatMajor::Row>::Inverse() const
+{
+  DMatrix4 result;
+  result.__mValues = details::InverseStorageOf(this->__mValues);
+  return result;
+}
+
+inline DVector4<TF32>
+operator*(const DMatrix4<TF32, EMatMajor::Row>& lhs, const DVector4<TF32>& rhs) noexcept
+{
+  // Each row dotted with rhs is each column of transposed matrix combined by rhs.
+  const auto columns = details::TransposeStorageOf(lhs.__mValues);
+  return {details::LinearCombineOf(columns[0].__GetSimd(), columns[1].__GetSimd(), columns[2].__GetSimd(), columns[3].__GetSimd(), rhs.__GetSimd())};
+}
+
+inline DVector4<TF32>
+operator*(const DVector4<TF32>& lhs, const DMatrix4<TF32, EMatMajor::Row>& rhs) noexcept
+{
+  return {details::LinearCombineOf(rhs[0].__GetSimd(), rhs[1].__GetSimd(), rhs[2].__GetSimd(), rhs[3].__GetSimd(), lhs.__GetSimd())};
+}
+
+inline DMatrix4<TF32, EMatMajor::Row>
+operator*(const DMatrix4<TF32, EMatMajor::Row>& lhs, const DMatrix4<TF32, EMatMajor::Row>& rhs) noexcept
+{
+  // Row i of result is rows of rhs combined by row i of lhs.
+  DMatrix4<TF32, EMatMajor::Row> result;
+  details::MultiplyStorageOf(rhs.__mValues, lhs.__mValues, result.__mValues);
+  return result;
+}
+
+inline DMatrix4<TF32, EMatMajor::Row>&
+operator*=(DMatrix4<TF32, EMatMajor::Row>& lhs, const DMatrix4<TF32, EMatMajor::Row>& rhs) noexcept
+{
+  lhs = lhs * rhs;
+  return lhs;
+}
+
+} /// ::dy::math namespace
+#endif /// MATH_ENABLE_SIMD
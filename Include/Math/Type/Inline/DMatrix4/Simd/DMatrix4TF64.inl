@@ -0,0 +1,295 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+/// AVX2 specialization of DMatrix4<TF64>.
+/// Each storage vector is a `__m256d` of DVector4<TF64>, and every function mirrors DMatrix4TF32.inl,
+/// so results are same to scalar path as long as scalar code is not FMA-contracted.
+
+#if defined(MATH_ENABLE_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+
+namespace dy::math::details
+{
+
+/// @brief Broadcast `TLane` lane of `value` to all lanes.
+template <int TLane>
+inline __m256d SplatLaneOf(__m256d value) noexcept
+{
+  return _mm256_permute4x64_pd(value, _MM_SHUFFLE(TLane, TLane, TLane, TLane));
+}
+
+/// @brief Return `((v0 * s0 + v1 * s1) + v2 * s2) + v3 * s3`,
+/// where `sN` is `N` lane of `scalars` broadcasted.
+inline __m256d LinearCombineOf(__m256d v0, __m256d v1, __m256d v2, __m256d v3, __m256d scalars) noexcept
+{
+  __m256d result = _mm256_mul_pd(v0, SplatLaneOf<0>(scalars));
+  result = _mm256_add_pd(result, _mm256_mul_pd(v1, SplatLaneOf<1>(scalars)));
+  result = _mm256_add_pd(result, _mm256_mul_pd(v2, SplatLaneOf<2>(scalars)));
+  result = _mm256_add_pd(result, _mm256_mul_pd(v3, SplatLaneOf<3>(scalars)));
+  return result;
+}
+
+/// @brief Multiply storage vectors of two matrices as `result[j] = sum_k lhs[k] * rhs[j][k]`.
+/// This is column-major `lhs * rhs`, and row-major `rhs * lhs`.
+inline void MultiplyStorageOf(
+  const std::array<DVector4<TF64>, 4>& lhs,
+  const std::array<DVector4<TF64>, 4>& rhs,
+  std::array<DVector4<TF64>, 4>& result) noexcept
+{
+  for (TIndex j = 0; j < 4; ++j)
+  {
+    result[j].__SetSimd(LinearCombineOf(
+      lhs[0].__GetSimd(), lhs[1].__GetSimd(), lhs[2].__GetSimd(), lhs[3].__GetSimd(),
+      rhs[j].__GetSimd()));
+  }
+}
+
+/// @brief Transpose storage vectors.
+inline std::array<DVector4<TF64>, 4>
+TransposeStorageOf(const std::array<DVector4<TF64>, 4>& values) noexcept
+{
+  // (v0[0], v1[0], v0[2], v1[2]), (v0[1], v1[1], v0[3], v1[3]), and same of v2 and v3.
+  const __m256d t0 = _mm256_unpacklo_pd(values[0].__GetSimd(), values[1].__GetSimd());
+  const __m256d t1 = _mm256_unpackhi_pd(values[0].__GetSimd(), values[1].__GetSimd());
+  const __m256d t2 = _mm256_unpacklo_pd(values[2].__GetSimd(), values[3].__GetSimd());
+  const __m256d t3 = _mm256_unpackhi_pd(values[2].__GetSimd(), values[3].__GetSimd());
+  return
+  {
+    DVector4<TF64>{_mm256_permute2f128_pd(t0, t2, 0x20)}, DVector4<TF64>{_mm256_permute2f128_pd(t1, t3, 0x20)},
+    DVector4<TF64>{_mm256_permute2f128_pd(t0, t2, 0x31)}, DVector4<TF64>{_mm256_permute2f128_pd(t1, t3, 0x31)}
+  };
+}
+
+/// @brief Return `(value[TL0], value[TL1], value[TL2], value[TL3])`.
+template <int TL0, int TL1, int TL2, int TL3>
+inline __m256d ShuffleOf(__m256d value) noexcept
+{
+  return _mm256_permute4x64_pd(value, _MM_SHUFFLE(TL3, TL2, TL1, TL0));
+}
+
+/// @brief Get determinant of storage vectors.
+/// Determinant is same for both transposed and original matrix, so both major can use this.
+inline TF64 GetDeterminantOfStorage(const std::array<DVector4<TF64>, 4>& m) noexcept
+{
+  // Same factors to TF32 version. See DMatrix4TF32.inl.
+  const __m256d m2P = ShuffleOf<2, 2, 1, 1>(m[2].__GetSimd());
+  const __m256d m2Q = ShuffleOf<3, 3, 3, 2>(m[2].__GetSimd());
+  const __m256d m2R = ShuffleOf<1, 0, 0, 0>(m[2].__GetSimd());
+  const __m256d m3P = ShuffleOf<2, 2, 1, 1>(m[3].__GetSimd());
+  const __m256d m3Q = ShuffleOf<3, 3, 3, 2>(m[3].__GetSimd());
+  const __m256d m3R = ShuffleOf<1, 0, 0, 0>(m[3].__GetSimd());
+
+  const __m256d fa = _mm256_sub_pd(_mm256_mul_pd(m2P, m3Q), _mm256_mul_pd(m3P, m2Q));
+  const __m256d fb = _mm256_sub_pd(_mm256_mul_pd(m2R, m3Q), _mm256_mul_pd(m3R, m2Q));
+  const __m256d fc = _mm256_sub_pd(_mm256_mul_pd(m2R, m3P), _mm256_mul_pd(m3R, m2P));
+
+  const __m256d a = ShuffleOf<1, 0, 0, 0>(m[1].__GetSimd());
+  const __m256d b = ShuffleOf<2, 2, 1, 1>(m[1].__GetSimd());
+  const __m256d c = ShuffleOf<3, 3, 3, 2>(m[1].__GetSimd());
+
+  __m256d detCof = _mm256_sub_pd(_mm256_mul_pd(a, fa), _mm256_mul_pd(b, fb));
+  detCof = _mm256_add_pd(detCof, _mm256_mul_pd(c, fc));
+  detCof = _mm256_xor_pd(detCof, _mm256_setr_pd(0.0, -0.0, 0.0, -0.0));
+
+  // Sum from x to w one by one, as scalar code does.
+  return SumLanesOf(_mm256_mul_pd(m[0].__GetSimd(), detCof));
+}
+
+/// @brief Get `fac` vector of inverse. See GetInverseFactorOf of DMatrix4TF32.inl.
+template <int TA, int TB>
+inline __m256d GetInverseFactorOf(__m256d m1, __m256d m2, __m256d m3) noexcept
+{
+  // (m[2][x], m[2][x], m[1][x], m[1][x]) and (m[3][x], m[3][x], m[3][x], m[2][x]).
+  const __m256d xa = _mm256_blend_pd(SplatLaneOf<TA>(m2), SplatLaneOf<TA>(m1), 0b1100);
+  const __m256d xb = _mm256_blend_pd(SplatLaneOf<TB>(m2), SplatLaneOf<TB>(m1), 0b1100);
+  const __m256d ya = _mm256_blend_pd(SplatLaneOf<TA>(m3), SplatLaneOf<TA>(m2), 0b1000);
+  const __m256d yb = _mm256_blend_pd(SplatLaneOf<TB>(m3), SplatLaneOf<TB>(m2), 0b1000);
+  return _mm256_sub_pd(_mm256_mul_pd(xa, yb), _mm256_mul_pd(ya, xb));
+}
+
+/// @brief Get `(m[1][x], m[0][x], m[0][x], m[0][x])`.
+template <int TX>
+inline __m256d GetInverseVectorOf(__m256d m0, __m256d m1) noexcept
+{
+  return _mm256_blend_pd(SplatLaneOf<TX>(m0), SplatLaneOf<TX>(m1), 0b0001);
+}
+
+/// @brief Get inverse of storage vectors.
+/// Inverse of transposed matrix is transposed inverse, so both major can use this.
+inline std::array<DVector4<TF64>, 4>
+InverseStorageOf(const std::array<DVector4<TF64>, 4>& m) noexcept
+{
+  const __m256d m0 = m[0].__GetSimd();
+  const __m256d m1 = m[1].__GetSimd();
+  const __m256d m2 = m[2].__GetSimd();
+  const __m256d m3 = m[3].__GetSimd();
+
+  const __m256d fac0 = GetInverseFactorOf<2, 3>(m1, m2, m3);
+  const __m256d fac1 = GetInverseFactorOf<1, 3>(m1, m2, m3);
+  const __m256d fac2 = GetInverseFactorOf<1, 2>(m1, m2, m3);
+  const __m256d fac3 = GetInverseFactorOf<0, 3>(m1, m2, m3);
+  const __m256d fac4 = GetInverseFactorOf<0, 2>(m1, m2, m3);
+  const __m256d fac5 = GetInverseFactorOf<0, 1>(m1, m2, m3);
+
+  const __m256d vec0 = GetInverseVectorOf<0>(m0, m1);
+  const __m256d vec1 = GetInverseVectorOf<1>(m0, m1);
+  const __m256d vec2 = GetInverseVectorOf<2>(m0, m1);
+  const __m256d vec3 = GetInverseVectorOf<3>(m0, m1);
+
+  const auto Cofactor = [](__m256d va, __m256d fa, __m256d vb, __m256d fb, __m256d vc, __m256d fc)
+  {
+    return _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(va, fa), _mm256_mul_pd(vb, fb)), _mm256_mul_pd(vc, fc));
+  };
+
+  const __m256d signA = _mm256_setr_pd(0.0, -0.0, 0.0, -0.0);
+  const __m256d signB = _mm256_setr_pd(-0.0, 0.0, -0.0, 0.0);
+  const __m256d inv0 = _mm256_xor_pd(Cofactor(vec1, fac0, vec2, fac1, vec3, fac2), signA);
+  const __m256d inv1 = _mm256_xor_pd(Cofactor(vec0, fac0, vec2, fac3, vec3, fac4), signB);
+  const __m256d inv2 = _mm256_xor_pd(Cofactor(vec0, fac1, vec1, fac3, vec3, fac5), signA);
+  const __m256d inv3 = _mm256_xor_pd(Cofactor(vec0, fac2, vec1, fac4, vec2, fac5), signB);
+
+  // row0 = (inv0[0], inv1[0], inv2[0], inv3[0]), det = (x + y) + (z + w) of m[0] * row0.
+  const __m256d row0 = _mm256_permute2f128_pd(
+    _mm256_unpacklo_pd(inv0, inv1),
+    _mm256_unpacklo_pd(inv2, inv3),
+    0x20);
+  const __m256d dot0 = _mm256_mul_pd(m0, row0);
+  const __m256d pair = _mm256_add_pd(dot0, _mm256_permute_pd(dot0, 0b0101));
+  const __m256d det  = _mm256_add_pd(pair, _mm256_permute2f128_pd(pair, pair, 0x01));
+
+  return
+  {
+    DVector4<TF64>{_mm256_div_pd(inv0, det)}, DVector4<TF64>{_mm256_div_pd(inv1, det)},
+    DVector4<TF64>{_mm256_div_pd(inv2, det)}, DVector4<TF64>{_mm256_div_pd(inv3, det)}
+  };
+}
+
+} /// ::dy::math::details namespace
+// Column Major
+
+namespace dy::math
+{
+
+template <>
+inline DMatrix4<TF64, EMatMajor::Column> DMatrix4<TF64, EMatMajor::Column>::Transpose() const noexcept
+{
+  DMatrix4 result;
+  result.__mValues = details::TransposeStorageOf(this->__mValues);
+  return result;
+}
+
+template <>
+inline TF64 DMatrix4<TF64, EMatMajor::Column>::GetDeterminant() const noexcept
+{
+  return details::GetDeterminantOfStorage(this->__mValues);
+}
+
+template <>
+inline DMatrix4<TF64, EMatMajor::Column> DMatrix4<TF64, EMatMajor::Column>::Inverse() const
+{
+  DMatrix4 result;
+  result.__mValues = details::InverseStorageOf(this->__mValues);
+  return result;
+}
+
+inline DVector4<TF64>
+operator*(const DMatrix4<TF64, EMatMajor::Column>& lhs, const DVector4<TF64>& rhs) noexcept
+{
+  return {details::LinearCombineOf(lhs[0].__GetSimd(), lhs[1].__GetSimd(), lhs[2].__GetSimd(), lhs[3].__GetSimd(), rhs.__GetSimd())};
+}
+
+inline DVector4<TF64>
+operator*(const DVector4<TF64>& lhs, const DMatrix4<TF64, EMatMajor::Column>& rhs) noexcept
+{
+  // Each column dotted with lhs is each row of transposed matrix combined by lhs.
+  const auto rows = details::TransposeStorageOf(rhs.__mValues);
+  return {details::LinearCombineOf(rows[0].__GetSimd(), rows[1].__GetSimd(), rows[2].__GetSimd(), rows[3].__GetSimd(), lhs.__GetSimd())};
+}
+
+inline DMatrix4<TF64, EMatMajor::Column>
+operator*(const DMatrix4<TF64, EMatMajor::Column>& lhs, const DMatrix4<TF64, EMatMajor::Column>& rhs) noexcept
+{
+  DMatrix4<TF64, EMatMajor::Column> result;
+  details::MultiplyStorageOf(lhs.__mValues, rhs.__mValues, result.__mValues);
+  return result;
+}
+
+inline DMatrix4<TF64, EMatMajor::Column>&
+operator*=(DMatrix4<TF64, EMatMajor::Column>& lhs, const DMatrix4<TF64, EMatMajor::Column>& rhs) noexcept
+{
+  lhs = lhs * rhs;
+  return lhs;
+}
+
+} /// ::dy::math namespace
+
+// Row Major
+
+namespace dy::math
+{
+
+template <>
+inline DMatrix4<TF64, EMatMajor::Row> DMatrix4<TF64, EMatMajor::Row>::Transpose() const noexcept
+{
+  DMatrix4 result;
+  result.__mValues = details::TransposeStorageOf(this->__mValues);
+  return result;
+}
+
+template <>
+inline TF64 DMatrix4<TF64, EMatMajor::Row>::GetDeterminant() const noexcept
+{
+  return details::GetDeterminantOfStorage(this->__mValues);
+}
+
+template <>
+inline DMatrix4<TF64, EMatMajor::Row> DMatrix4<TF64, EMatMajor::Row>::Inverse() const
+{
+  DMatrix4 result;
+  result.__mValues = details::InverseStorageOf(this->__mValues);
+  return result;
+}
+
+inline DVector4<TF64>
+operator*(const DMatrix4<TF64, EMatMajor::Row>& lhs, const DVector4<TF64>& rhs) noexcept
+{
+  // Each row dotted with rhs is each column of transposed matrix combined by rhs.
+  const auto columns = details::TransposeStorageOf(lhs.__mValues);
+  return {details::LinearCombineOf(columns[0].__GetSimd(), columns[1].__GetSimd(), columns[2].__GetSimd(), columns[3].__GetSimd(), rhs.__GetSimd())};
+}
+
+inline DVector4<TF64>
+operator*(const DVector4<TF64>& lhs, const DMatrix4<TF64, EMatMajor::Row>& rhs) noexcept
+{
+  return {details::LinearCombineOf(rhs[0].__GetSimd(), rhs[1].__GetSimd(), rhs[2].__GetSimd(), rhs[3].__GetSimd(), lhs.__GetSimd())};
+}
+
+inline DMatrix4<TF64, EMatMajor::Row>
+operator*(const DMatrix4<TF64, EMatMajor::Row>& lhs, const DMatrix4<TF64, EMatMajor::Row>& rhs) noexcept
+{
+  // Row i of result is rows of rhs combined by row i of lhs.
+  DMatrix4<TF64, EMatMajor::Row> result;
+  details::MultiplyStorageOf(rhs.__mValues, lhs.__mValues, result.__mValues);
+  return result;
+}
+
+inline DMatrix4<TF64, EMatMajor::Row>&
+operator*=(DMatrix4<TF64, EMatMajor::Row>& lhs, const DMatrix4<TF64, EMatMajor::Row>& rhs) noexcept
+{
+  lhs = lhs * rhs;
+  return lhs;
+}
+
+} /// ::dy::math namespace
+#endif /// defined(MATH_ENABLE_SIMD) && defined(__AVX2__)
@@ -36,12 +36,12 @@ DQuaternion<TType>::DQuaternion(const DVector3<TType>& eulerAngle, bool isDegree
 }
 
 template <typename TType>
-DQuaternion<TType>::DQuaternion(TValueType x, TValueType y, TValueType z, TValueType w)
+constexpr DQuaternion<TType>::DQuaternion(TValueType x, TValueType y, TValueType z, TValueType w)
   : mX{x}, mY{y}, mZ{z}, mW{w}
 { }
 
 template <typename TType>
-typename DQuaternion<TType>::TValueType& 
+constexpr typename DQuaternion<TType>::TValueType& 
 DQuaternion<TType>::operator[](TIndex index) 
 {
   switch (index)
@@ -56,7 +56,7 @@ DQuaternion<TType>::operator[](TIndex index)
 }
 
 template <typename TType>
-const typename DQuaternion<TType>::TValueType& 
+constexpr const typename DQuaternion<TType>::TValueType& 
 DQuaternion<TType>::operator[](TIndex index) const
 {
   switch (index)
@@ -72,7 +72,7 @@ DQuaternion<TType>::operator[](TIndex index) const
 
 template <typename TType>
 template <EMatMajor TMajor>
-DMatrix3<typename DQuaternion<TType>::TValueType, TMajor> 
+constexpr DMatrix3<typename DQuaternion<TType>::TValueType, TMajor> 
 DQuaternion<TType>::ToMatrix3() const noexcept
 {
   auto qxx = this->mX * this->mX;
@@ -106,7 +106,7 @@ DQuaternion<TType>::ToMatrix3() const noexcept
 
 template <typename TType>
 template <EMatMajor TMajor>
-DMatrix4<typename DQuaternion<TType>::TValueType, TMajor> 
+constexpr DMatrix4<typename DQuaternion<TType>::TValueType, TMajor> 
 DQuaternion<TType>::ToMatrix4() const noexcept
 {
   const auto matrix3 = this->ToMatrix3<TMajor>();
@@ -127,16 +127,16 @@ DQuaternion<TType>::ToMatrix4() const noexcept
       DVector4<TType>{matrix3[0], 0},
       DVector4<TType>{matrix3[1], 0},
       DVector4<TType>{matrix3[2], 0},
-      DVector4<TType>{matrix3[3], 1},
+      DVector4<TType>{0, 0, 0, 1},
     };
   }
 }
 
 template <typename TType>
-DQuaternion<TType> DQuaternion<TType>::Inverse() const
+constexpr DQuaternion<TType> DQuaternion<TType>::Inverse() const
 {
   // Get conjugate matrix. 
-  const auto conjugate = DQuaternion<TType>{-this->mX, -this->mY, -this->mZ, this->mW};
+  auto conjugate = DQuaternion<TType>{-this->mX, -this->mY, -this->mZ, this->mW};
   const auto dot = Dot(*this, *this);
 
   conjugate[0] /= dot;
@@ -297,28 +297,28 @@ DQuaternion<TType>::Data() const noexcept
 }
 
 template <typename TType>
-typename DQuaternion<TType>::TValueType 
+constexpr typename DQuaternion<TType>::TValueType 
 DQuaternion<TType>::X() const noexcept
 {
   return this->mX;
 }
 
 template <typename TType>
-typename DQuaternion<TType>::TValueType 
+constexpr typename DQuaternion<TType>::TValueType 
 DQuaternion<TType>::Y() const noexcept
 {
   return this->mY;
 }
 
 template <typename TType>
-typename DQuaternion<TType>::TValueType 
+constexpr typename DQuaternion<TType>::TValueType 
 DQuaternion<TType>::Z() const noexcept
 {
   return this->mZ;
 }
 
 template <typename TType>
-typename DQuaternion<TType>::TValueType 
+constexpr typename DQuaternion<TType>::TValueType 
 DQuaternion<TType>::W() const noexcept
 {
   return this->mW;
@@ -0,0 +1,55 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+
+#include <Math/Type/Shape/DRayPacket.h>
+
+namespace dy::math
+{
+
+template <typename TType, TIndex TLanes>
+DRayPacket<TType, TLanes>::DRayPacket(const std::array<DRay<TValueType>, TLanes>& rays) noexcept
+  : DRayPacket{rays.data()}
+{ }
+
+template <typename TType, TIndex TLanes>
+DRayPacket<TType, TLanes>::DRayPacket(const DRay<TValueType>* pRays) noexcept
+{
+  for (TIndex i = 0; i < TLanes; ++i) { this->SetRay(i, pRays[i]); }
+}
+
+template <typename TType, TIndex TLanes>
+void DRayPacket<TType, TLanes>::SetRay(TIndex index, const DRay<TValueType>& ray) noexcept
+{
+  const auto& origin = ray.GetOrigin();
+  const auto& direction = ray.GetDirection();
+  this->__mOriginX[index] = origin.X;
+  this->__mOriginY[index] = origin.Y;
+  this->__mOriginZ[index] = origin.Z;
+  this->__mDirectionX[index] = direction.X;
+  this->__mDirectionY[index] = direction.Y;
+  this->__mDirectionZ[index] = direction.Z;
+}
+
+template <typename TType, TIndex TLanes>
+DRay<typename DRayPacket<TType, TLanes>::TValueType> 
+DRayPacket<TType, TLanes>::GetRay(TIndex index) const
+{
+  return DRay<TValueType>{
+    DVector3<TValueType>{this->__mOriginX[index], this->__mOriginY[index], this->__mOriginZ[index]},
+    DVector3<TValueType>{this->__mDirectionX[index], this->__mDirectionY[index], this->__mDirectionZ[index]},
+    false};
+}
+
+} /// ::dy::math namespace
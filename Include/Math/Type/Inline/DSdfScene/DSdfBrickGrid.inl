@@ -0,0 +1,465 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <Math/Utility/XMath.h>
+
+namespace dy::math::details
+{
+
+/// @brief Round up offset to multiple of 64 bytes.
+constexpr TIndex AlignSdfBlobOffset(TIndex offset) noexcept
+{
+  return (offset + 63) & ~TIndex(63);
+}
+
+/// @brief Get distance between two bounds. 0 when overlapped.
+template <typename TType>
+TType GetDistanceOf(const DBounds3D<TType>& lhs, const DBounds3D<TType>& rhs) noexcept
+{
+  TType sum = 0;
+  for (TIndex axis = 0; axis < 3; ++axis)
+  {
+    const TType gap = std::max({lhs.GetMin()[axis] - rhs.GetMax()[axis], rhs.GetMin()[axis] - lhs.GetMax()[axis], TType(0)});
+    sum += gap * gap;
+  }
+  return std::sqrt(sum);
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+template <typename TType>
+DSdfBrickGrid<TType>::DSdfBrickGrid(
+  const DSdfScene<TValueType>& scene,
+  const DBounds3D<TValueType>& bounds,
+  TValueType voxelSize,
+  TValueType bandWidth)
+{
+  this->Bake(scene, bounds, voxelSize, bandWidth);
+}
+
+template <typename TType>
+void DSdfBrickGrid<TType>::Bake(
+  const DSdfScene<TValueType>& scene,
+  const DBounds3D<TValueType>& bounds,
+  TValueType voxelSize,
+  TValueType bandWidth)
+{
+  assert(voxelSize > TValueType(0));
+  assert(bandWidth >= TValueType(0));
+  assert(bounds.IsInfiniteBound() == false);
+  this->Clear();
+
+  const TValueType brickSize = voxelSize * TValueType(kBrickCells);
+  DHeader header;
+  TIndex counts[3] = {};
+  for (TIndex axis = 0; axis < 3; ++axis)
+  {
+    const auto extent = bounds.GetMax()[axis] - bounds.GetMin()[axis];
+    counts[axis] = std::max(TIndex(1), static_cast<TIndex>(std::ceil(extent / brickSize)));
+    assert(counts[axis] <= kMaxBrickCount);
+    header.mBrickCounts[axis] = static_cast<TU32>(counts[axis]);
+    header.mOrigin[axis] = static_cast<TF64>(bounds.GetMin()[axis]);
+  }
+  header.mVoxelSize = static_cast<TF64>(voxelSize);
+  const TIndex brickCount = counts[0] * counts[1] * counts[2];
+  const DVector3<TValueType> origin = bounds.GetMin();
+
+  // Bricks far from bounds of scene are not evaluated. Their SDF values are not less than distance to bounds.
+  const bool hasRoot = scene.HasRoot();
+  const bool isBounded = hasRoot == true
+    && scene.GetNode(scene.GetRoot()).mIsPrunable == true
+    && scene.GetBounds().IsInfiniteBound() == false;
+
+  std::vector<TU32> slots(brickCount, kEmptyBrick);
+  std::vector<TValueType> coarseValues(brickCount, kMaxValueOf<TValueType>);
+  std::vector<TIndex> candidates;
+  std::vector<DVector3<TValueType>> centers;
+  for (TIndex z = 0, index = 0; z < counts[2]; ++z)
+  {
+    for (TIndex y = 0; y < counts[1]; ++y)
+    {
+      for (TIndex x = 0; x < counts[0]; ++x, ++index)
+      {
+        if (hasRoot == false) { continue; }
+
+        const auto min = origin + DVector3<TValueType>{TValueType(x), TValueType(y), TValueType(z)} * brickSize;
+        const auto max = min + DVector3<TValueType>{brickSize};
+        if (isBounded == true)
+        {
+          const auto distance = details::GetDistanceOf(DBounds3D<TValueType>{min, max}, scene.GetBounds());
+          if (distance > bandWidth)
+          {
+            coarseValues[index] = distance;
+            continue;
+          }
+        }
+        candidates.emplace_back(index);
+        centers.emplace_back((min + max) * TValueType(0.5));
+      }
+    }
+  }
+
+  // Brick whose center is farther than half diagonal from the surface does not have surface inside.
+  const TValueType halfDiagonal = brickSize * TValueType(0.8660254037844386);
+  std::vector<TReal> centerValues(centers.size());
+  if (centers.empty() == false)
+  {
+    scene.GetSDFValuesOf(DVector3Stream<TValueType>{centers.data(), centers.size()}, centerValues.data());
+  }
+
+  std::vector<std::pair<TU32, TU32>> allocated; // (morton code, brick index)
+  for (TIndex i = 0; i < candidates.size(); ++i)
+  {
+    const auto value = static_cast<TValueType>(centerValues[i]);
+    const auto index = candidates[i];
+    if (std::abs(value) <= halfDiagonal + bandWidth)
+    {
+      const auto x = index % counts[0];
+      const auto y = (index / counts[0]) % counts[1];
+      const auto z = index / (counts[0] * counts[1]);
+      allocated.emplace_back(
+        GetMortonCodeOf(static_cast<TU32>(x), static_cast<TU32>(y), static_cast<TU32>(z)),
+        static_cast<TU32>(index));
+      coarseValues[index] = value;
+    }
+    else
+    {
+      coarseValues[index] = value > TValueType(0) ? value - halfDiagonal : value + halfDiagonal;
+    }
+  }
+  std::sort(allocated.begin(), allocated.end());
+  for (TIndex slot = 0; slot < allocated.size(); ++slot) { slots[allocated[slot].second] = static_cast<TU32>(slot); }
+  header.mAllocatedCount = static_cast<TU32>(allocated.size());
+
+  // Write blob.
+  const TIndex slotOffset   = details::AlignSdfBlobOffset(sizeof(DHeader));
+  const TIndex coarseOffset = details::AlignSdfBlobOffset(slotOffset + brickCount * sizeof(TU32));
+  const TIndex sampleOffset = details::AlignSdfBlobOffset(coarseOffset + brickCount * sizeof(TValueType));
+  const TIndex size = sampleOffset + allocated.size() * kBrickSampleCount * sizeof(TValueType);
+  this->mStorage.assign(size, TU8(0));
+
+  TU8* data = this->mStorage.data();
+  std::memcpy(data, &header, sizeof(DHeader));
+  std::memcpy(data + slotOffset, slots.data(), brickCount * sizeof(TU32));
+  std::memcpy(data + coarseOffset, coarseValues.data(), brickCount * sizeof(TValueType));
+
+  DVector3Stream<TValueType> samplePoints{kBrickSampleCount};
+  std::vector<TReal> sampleValues(kBrickSampleCount);
+  std::vector<TValueType> brickValues(kBrickSampleCount);
+  for (TIndex slot = 0; slot < allocated.size(); ++slot)
+  {
+    const TIndex index = allocated[slot].second;
+    const TIndex first[3] = {
+      (index % counts[0]) * kBrickCells,
+      ((index / counts[0]) % counts[1]) * kBrickCells,
+      (index / (counts[0] * counts[1])) * kBrickCells};
+    for (TIndex z = 0, i = 0; z < kBrickSamples; ++z)
+    {
+      for (TIndex y = 0; y < kBrickSamples; ++y)
+      {
+        for (TIndex x = 0; x < kBrickSamples; ++x, ++i)
+        {
+          samplePoints.GetPlane(0)[i] = origin.X + TValueType(first[0] + x) * voxelSize;
+          samplePoints.GetPlane(1)[i] = origin.Y + TValueType(first[1] + y) * voxelSize;
+          samplePoints.GetPlane(2)[i] = origin.Z + TValueType(first[2] + z) * voxelSize;
+        }
+      }
+    }
+
+    scene.GetSDFValuesOf(samplePoints, sampleValues.data());
+    std::transform(sampleValues.begin(), sampleValues.end(), brickValues.begin(),
+      [](TReal value) { return static_cast<TValueType>(value); });
+    std::memcpy(
+      data + sampleOffset + slot * kBrickSampleCount * sizeof(TValueType),
+      brickValues.data(), kBrickSampleCount * sizeof(TValueType));
+  }
+
+  [[maybe_unused]] const bool isValid = this->pSetData(data, size);
+  assert(isValid == true);
+}
+
+template <typename TType>
+bool DSdfBrickGrid<TType>::Load(const void* data, TIndex size)
+{
+  this->Clear();
+  const auto* bytes = static_cast<const TU8*>(data);
+  this->mStorage.assign(bytes, bytes + size);
+  if (this->pSetData(this->mStorage.data(), size) == false)
+  {
+    this->Clear();
+    return false;
+  }
+  return true;
+}
+
+template <typename TType>
+bool DSdfBrickGrid<TType>::SetView(const void* data, TIndex size)
+{
+  this->Clear();
+  assert(reinterpret_cast<std::uintptr_t>(data) % alignof(TValueType) == 0);
+  this->mView = static_cast<const TU8*>(data);
+  if (this->pSetData(data, size) == false)
+  {
+    this->Clear();
+    return false;
+  }
+  return true;
+}
+
+template <typename TType>
+void DSdfBrickGrid<TType>::Clear() noexcept
+{
+  this->mStorage.clear();
+  this->mStorage.shrink_to_fit();
+  this->mView = nullptr;
+  this->mSize = 0;
+  this->mOrigin = {};
+  this->mInvVoxelSize = 0;
+  std::fill(std::begin(this->mBrickCounts), std::end(this->mBrickCounts), TIndex(0));
+  this->mSlotOffset = this->mCoarseOffset = this->mSampleOffset = 0;
+}
+
+template <typename TType>
+bool DSdfBrickGrid<TType>::IsEmpty() const noexcept
+{
+  return this->mSize == 0;
+}
+
+template <typename TType>
+const void* DSdfBrickGrid<TType>::GetData() const noexcept
+{
+  return this->IsEmpty() == true ? nullptr : this->pGetData();
+}
+
+template <typename TType>
+TIndex DSdfBrickGrid<TType>::GetDataSize() const noexcept
+{
+  return this->mSize;
+}
+
+template <typename TType>
+DBounds3D<TType> DSdfBrickGrid<TType>::GetBounds() const noexcept
+{
+  assert(this->IsEmpty() == false);
+  const TValueType brickSize = this->GetVoxelSize() * TValueType(kBrickCells);
+  const DVector3<TValueType> extent = {
+    TValueType(this->mBrickCounts[0]) * brickSize,
+    TValueType(this->mBrickCounts[1]) * brickSize,
+    TValueType(this->mBrickCounts[2]) * brickSize};
+  return {this->mOrigin, this->mOrigin + extent};
+}
+
+template <typename TType>
+TType DSdfBrickGrid<TType>::GetVoxelSize() const noexcept
+{
+  if (this->IsEmpty() == true) { return TValueType(0); }
+
+  DHeader header;
+  std::memcpy(&header, this->pGetData(), sizeof(DHeader));
+  return static_cast<TValueType>(header.mVoxelSize);
+}
+
+template <typename TType>
+DVector3<TU32> DSdfBrickGrid<TType>::GetBrickCounts() const noexcept
+{
+  return {
+    static_cast<TU32>(this->mBrickCounts[0]),
+    static_cast<TU32>(this->mBrickCounts[1]),
+    static_cast<TU32>(this->mBrickCounts[2])};
+}
+
+template <typename TType>
+TIndex DSdfBrickGrid<TType>::GetAllocatedBrickCount() const noexcept
+{
+  return this->IsEmpty() == true
+    ? 0
+    : (this->mSize - this->mSampleOffset) / (kBrickSampleCount * sizeof(TValueType));
+}
+
+template <typename TType>
+TReal DSdfBrickGrid<TType>::GetSDFValueOf(const DVector3<TValueType>& point) const noexcept
+{
+  const DCell cell = this->pGetCellOf(point);
+  if (cell.mSamples == nullptr) { return static_cast<TReal>(cell.mValue + cell.mOutside); }
+
+  // Samples of cell are (x, y, z) = s[x + y * 8 + z * 64].
+  constexpr TIndex kY = kBrickSamples;
+  constexpr TIndex kZ = kBrickSamples * kBrickSamples;
+  const TValueType* s = cell.mSamples;
+  const auto [fx, fy, fz] = cell.mLocal;
+
+  const TValueType x00 = s[0]       + (s[1]           - s[0])       * fx;
+  const TValueType x10 = s[kY]      + (s[kY + 1]      - s[kY])      * fx;
+  const TValueType x01 = s[kZ]      + (s[kZ + 1]      - s[kZ])      * fx;
+  const TValueType x11 = s[kZ + kY] + (s[kZ + kY + 1] - s[kZ + kY]) * fx;
+  const TValueType y0 = x00 + (x10 - x00) * fy;
+  const TValueType y1 = x01 + (x11 - x01) * fy;
+  return static_cast<TReal>(y0 + (y1 - y0) * fz + cell.mOutside);
+}
+
+template <typename TType>
+void DSdfBrickGrid<TType>::GetSDFValuesOf(const DVector3Stream<TValueType>& points, TReal* oValues) const noexcept
+{
+  const TValueType* px = points.GetPlane(0);
+  const TValueType* py = points.GetPlane(1);
+  const TValueType* pz = points.GetPlane(2);
+  for (TIndex i = 0, size = points.size(); i < size; ++i)
+  {
+    oValues[i] = this->GetSDFValueOf(DVector3<TValueType>{px[i], py[i], pz[i]});
+  }
+}
+
+template <typename TType>
+DVector3<TType> DSdfBrickGrid<TType>::GetGradientOf(const DVector3<TValueType>& point) const noexcept
+{
+  const DCell cell = this->pGetCellOf(point);
+  if (cell.mSamples == nullptr) { return {}; }
+
+  // Partial derivatives of trilinear interpolation in the cell.
+  constexpr TIndex kY = kBrickSamples;
+  constexpr TIndex kZ = kBrickSamples * kBrickSamples;
+  const TValueType* s = cell.mSamples;
+  const auto [fx, fy, fz] = cell.mLocal;
+  const auto Lerp2 = [](TValueType v00, TValueType v10, TValueType v01, TValueType v11, TValueType u, TValueType v)
+  {
+    const TValueType v0 = v00 + (v10 - v00) * u;
+    const TValueType v1 = v01 + (v11 - v01) * u;
+    return v0 + (v1 - v0) * v;
+  };
+
+  const TValueType dx = Lerp2(
+    s[1] - s[0],           s[kY + 1] - s[kY],
+    s[kZ + 1] - s[kZ],     s[kZ + kY + 1] - s[kZ + kY], fy, fz);
+  const TValueType dy = Lerp2(
+    s[kY] - s[0],          s[kY + 1] - s[1],
+    s[kZ + kY] - s[kZ],    s[kZ + kY + 1] - s[kZ + 1], fx, fz);
+  const TValueType dz = Lerp2(
+    s[kZ] - s[0],          s[kZ + 1] - s[1],
+    s[kZ + kY] - s[kY],    s[kZ + kY + 1] - s[kY + 1], fx, fy);
+  return DVector3<TValueType>{dx, dy, dz} * this->mInvVoxelSize;
+}
+
+template <typename TType>
+DVector3<TType> DSdfBrickGrid<TType>::GetNormalOf(const DVector3<TValueType>& point) const noexcept
+{
+  const auto gradient = this->GetGradientOf(point);
+  const auto squaredLength = gradient.GetSquareLength();
+  if (squaredLength <= TValueType(0)) { return {}; }
+  return gradient / std::sqrt(squaredLength);
+}
+
+template <typename TType>
+bool DSdfBrickGrid<TType>::pSetData(const void* data, TIndex size)
+{
+  if (data == nullptr || size < sizeof(DHeader)) { return false; }
+
+  DHeader header;
+  std::memcpy(&header, data, sizeof(DHeader));
+  if (header.mMagic != kMagic
+  ||  header.mVersion != kVersion
+  ||  header.mValueSize != sizeof(TValueType)
+  ||  header.mBrickSamples != kBrickSamples
+  ||  (header.mVoxelSize > 0) == false)
+  {
+    return false;
+  }
+  for (const TU32 count : header.mBrickCounts)
+  {
+    if (count == 0 || count > kMaxBrickCount) { return false; }
+  }
+
+  const TIndex brickCount = TIndex(header.mBrickCounts[0]) * header.mBrickCounts[1] * header.mBrickCounts[2];
+  const TIndex slotOffset   = details::AlignSdfBlobOffset(sizeof(DHeader));
+  const TIndex coarseOffset = details::AlignSdfBlobOffset(slotOffset + brickCount * sizeof(TU32));
+  const TIndex sampleOffset = details::AlignSdfBlobOffset(coarseOffset + brickCount * sizeof(TValueType));
+  if (header.mAllocatedCount > brickCount
+  ||  size != sampleOffset + TIndex(header.mAllocatedCount) * kBrickSampleCount * sizeof(TValueType))
+  {
+    return false;
+  }
+
+  // Slot out of range would read out of blob.
+  const auto* slots = reinterpret_cast<const TU32*>(static_cast<const TU8*>(data) + slotOffset);
+  for (TIndex i = 0; i < brickCount; ++i)
+  {
+    if (slots[i] != kEmptyBrick && slots[i] >= header.mAllocatedCount) { return false; }
+  }
+
+  this->mSize = size;
+  for (TIndex axis = 0; axis < 3; ++axis)
+  {
+    this->mOrigin[axis] = static_cast<TValueType>(header.mOrigin[axis]);
+    this->mBrickCounts[axis] = header.mBrickCounts[axis];
+  }
+  this->mInvVoxelSize = static_cast<TValueType>(1.0 / header.mVoxelSize);
+  this->mSlotOffset = slotOffset;
+  this->mCoarseOffset = coarseOffset;
+  this->mSampleOffset = sampleOffset;
+  return true;
+}
+
+template <typename TType>
+const TU8* DSdfBrickGrid<TType>::pGetData() const noexcept
+{
+  return this->mView != nullptr ? this->mView : this->mStorage.data();
+}
+
+template <typename TType>
+typename DSdfBrickGrid<TType>::DCell DSdfBrickGrid<TType>::pGetCellOf(const DVector3<TValueType>& point) const noexcept
+{
+  assert(this->IsEmpty() == false);
+
+  DCell result;
+  TIndex brickIndex = 0;
+  TIndex sampleIndex = 0;
+  TValueType outside = 0;
+  for (TIndex axis = 3; axis-- > 0;)
+  {
+    const TIndex cellCount = this->mBrickCounts[axis] * kBrickCells;
+    const TValueType local = (point[axis] - this->mOrigin[axis]) * this->mInvVoxelSize;
+    const TValueType clamped = std::clamp(local, TValueType(0), TValueType(cellCount));
+    const TIndex cell = std::min(static_cast<TIndex>(clamped), cellCount - 1);
+    const TIndex brick = cell / kBrickCells;
+
+    outside += (local - clamped) * (local - clamped);
+    result.mLocal[axis] = clamped - TValueType(cell);
+    brickIndex  = brickIndex * this->mBrickCounts[axis] + brick;
+    sampleIndex = sampleIndex * kBrickSamples + (cell - brick * kBrickCells);
+  }
+  result.mOutside = std::sqrt(outside) / this->mInvVoxelSize;
+
+  const TU8* data = this->pGetData();
+  const TU32 slot = reinterpret_cast<const TU32*>(data + this->mSlotOffset)[brickIndex];
+  if (slot == kEmptyBrick)
+  {
+    result.mValue = reinterpret_cast<const TValueType*>(data + this->mCoarseOffset)[brickIndex];
+  }
+  else
+  {
+    result.mSamples = reinterpret_cast<const TValueType*>(data + this->mSampleOffset)
+      + TIndex(slot) * kBrickSampleCount + sampleIndex;
+  }
+  return result;
+}
+
+} /// ::dy::math namespace
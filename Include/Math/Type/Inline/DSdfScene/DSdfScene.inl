@@ -0,0 +1,493 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <type_traits>
+#include <Math/Utility/XShapeMath.h>
+#include <Math/Common/XSimdDispatch.h>
+
+MATH_SIMD_KERNEL_REGION_BEGIN
+
+namespace dy::math::details
+{
+
+/// @struct DSdfOperationSign
+/// @brief Every ESdfOperation is `min` or smooth `min` of signed operands, with signed result.
+struct DSdfOperationSign final
+{
+  bool mIsLhsNegated = false;
+  bool mIsRhsNegated = false;
+  bool mIsResultNegated = false;
+  bool mIsSmooth = false;
+};
+
+/// @brief Get signs of operands and result of operation.
+constexpr DSdfOperationSign GetSignOf(ESdfOperation operation) noexcept
+{
+  switch (operation)
+  {
+  case ESdfOperation::Union:              return {false, false, false, false};
+  case ESdfOperation::Intersection:       return {true,  true,  true,  false};
+  case ESdfOperation::Subtraction:        return {true,  false, true,  false};
+  case ESdfOperation::SmoothUnion:        return {false, false, false, true};
+  case ESdfOperation::SmoothIntersection: return {true,  true,  true,  true};
+  case ESdfOperation::SmoothSubtraction:  return {true,  false, true,  true};
+  }
+  return {};
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+template <typename TType>
+typename DSdfScene<TType>::TNodeId DSdfScene<TType>::AddShape(const TShape& shape)
+{
+  DPrimitive primitive;
+  primitive.mType = static_cast<TU32>(shape.index());
+  switch (shape.index())
+  {
+  case 0:
+  {
+    const auto& sphere = std::get<DSphere<TType>>(shape);
+    primitive.mOrigin = sphere.GetOrigin();
+    primitive.mParams = {sphere.GetRadius(), 0, 0};
+  } break;
+  case 1:
+  {
+    // Box is converted into symmetrical box, as `GetSDFValueOf(point, box)`.
+    const auto& box = std::get<DBox<TType>>(shape);
+    primitive.mOrigin = (box.GetMinPos() + box.GetMaxPos()) / TType(2);
+    primitive.mParams = (box.GetMaxPos() - box.GetMinPos()) / TType(2);
+  } break;
+  case 2:
+  {
+    const auto& capsule = std::get<DCapsule<TType>>(shape);
+    primitive.mOrigin = capsule.GetOrigin();
+    primitive.mParams = {capsule.GetHeight(), capsule.GetRadius(), 0};
+  } break;
+  case 3:
+  {
+    // Origin is apex, and params are normal of side line on (xz length, y) plane and y of bottom.
+    const auto& cone = std::get<DCone<TType>>(shape);
+    const auto normal = DVector2<TType>{cone.GetHeight(), cone.GetRadius()}.Normalize();
+    primitive.mOrigin = cone.GetOrigin() + DVector3<TType>{0, cone.GetHeight(), 0};
+    primitive.mParams = {TType(normal.X), TType(normal.Y), cone.GetOrigin().Y};
+  } break;
+  case 4:
+  {
+    const auto& torus = std::get<DTorus<TType>>(shape);
+    primitive.mOrigin = torus.GetOrigin();
+    primitive.mParams = {torus.GetDistance(), torus.GetRadius(), 0};
+  } break;
+  default:
+  {
+    // Origin is normal, and params are d and length of normal.
+    const auto& plane = std::get<DPlane<TType>>(shape);
+    primitive.mOrigin = plane.GetNormal();
+    primitive.mParams = {plane.GetD(), TType(plane.GetNormal().GetLength()), 0};
+  } break;
+  }
+
+  DNode node;
+  node.mBounds = std::visit([](const auto& item) { return GetDBounds3DOf(item); }, shape);
+  node.mLhs = static_cast<TU32>(this->mPrimitives.size());
+  node.mIsShape = true;
+  // SDF of cone is not exact distance, and plane is infinite.
+  node.mIsPrunable = shape.index() != 3 && node.mBounds.IsInfiniteBound() == false;
+
+  this->mPrimitives.emplace_back(primitive);
+  this->mNodes.emplace_back(node);
+  return static_cast<TNodeId>(this->mNodes.size() - 1);
+}
+
+template <typename TType>
+typename DSdfScene<TType>::TNodeId
+DSdfScene<TType>::AddOperation(ESdfOperation operation, TNodeId lhs, TNodeId rhs, TValueType smoothness)
+{
+  assert(lhs < this->mNodes.size() && rhs < this->mNodes.size());
+  assert(details::GetSignOf(operation).mIsSmooth == false || smoothness > 0);
+  const auto& lhsNode = this->mNodes[lhs];
+  const auto& rhsNode = this->mNodes[rhs];
+
+  DNode node;
+  node.mOperation  = operation;
+  node.mSmoothness = smoothness;
+  node.mLhs = lhs;
+  node.mRhs = rhs;
+  node.mIsShape = false;
+  node.mStackDepth = lhsNode.mStackDepth == rhsNode.mStackDepth
+    ? lhsNode.mStackDepth + 1
+    : std::max(lhsNode.mStackDepth, rhsNode.mStackDepth);
+  assert(node.mStackDepth <= kMaxStackDepth);
+
+  switch (operation)
+  {
+  case ESdfOperation::Union:
+  case ESdfOperation::SmoothUnion:
+  {
+    node.mBounds = GetUnionOf(lhsNode.mBounds, rhsNode.mBounds);
+    node.mIsPrunable = lhsNode.mIsPrunable == true && rhsNode.mIsPrunable == true;
+    // Smooth minimum is not less than `min(a, b) - k / 4`.
+    if (operation == ESdfOperation::SmoothUnion && node.mBounds.IsInfiniteBound() == false)
+    {
+      node.mBounds = GetExpandOf(node.mBounds, smoothness / TType(4));
+    }
+  } break;
+  case ESdfOperation::Intersection:
+  case ESdfOperation::SmoothIntersection:
+  {
+    // Result is not less than any operand, so bounds of one operand can be used.
+    // Prunable one is preferred, and smaller one is preferred.
+    const auto IsBetter = [](const DNode& lhs, const DNode& rhs)
+    {
+      if (lhs.mIsPrunable != rhs.mIsPrunable) { return lhs.mIsPrunable; }
+      if (rhs.mBounds.IsInfiniteBound() == true) { return true; }
+      return lhs.mBounds.IsInfiniteBound() == false && lhs.mBounds.GetVolume() <= rhs.mBounds.GetVolume();
+    };
+    const auto& chosen = IsBetter(lhsNode, rhsNode) == true ? lhsNode : rhsNode;
+    node.mBounds = chosen.mBounds;
+    node.mIsPrunable = chosen.mIsPrunable;
+  } break;
+  case ESdfOperation::Subtraction:
+  case ESdfOperation::SmoothSubtraction:
+  {
+    node.mBounds = lhsNode.mBounds;
+    node.mIsPrunable = lhsNode.mIsPrunable;
+  } break;
+  }
+
+  this->mNodes.emplace_back(node);
+  return static_cast<TNodeId>(this->mNodes.size() - 1);
+}
+
+template <typename TType>
+void DSdfScene<TType>::SetRoot(TNodeId root)
+{
+  assert(root < this->mNodes.size());
+  this->mRoot = root;
+  this->mProgram.clear();
+
+  // Postfix traversal without recursion, because chain of operations can be very deep.
+  struct DFrame final
+  {
+    TU32 mNode  = 0;
+    TU32 mStage = 0;
+    TU32 mPrune = kMaxValueOf<TU32>;
+  };
+  std::vector<DFrame> frames{{root, 0, kMaxValueOf<TU32>}};
+  while (frames.empty() == false)
+  {
+    const auto nodeId = frames.back().mNode;
+    const auto& node  = this->mNodes[nodeId];
+    if (node.mIsShape == true)
+    {
+      this->mProgram.push_back({EInstruction::Shape, false, node.mLhs, 0, 0});
+      frames.pop_back();
+      continue;
+    }
+
+    // Child which needs deeper stack is evaluated first.
+    const bool isSwapped = this->mNodes[node.mRhs].mStackDepth > this->mNodes[node.mLhs].mStackDepth;
+    const auto first  = isSwapped == true ? node.mRhs : node.mLhs;
+    const auto second = isSwapped == true ? node.mLhs : node.mRhs;
+    switch (frames.back().mStage++)
+    {
+    case 0: frames.push_back({first, 0, kMaxValueOf<TU32>}); break;
+    case 1:
+    {
+      // Second operand can be skipped only when it is operand of `min` as it is.
+      const auto sign = details::GetSignOf(node.mOperation);
+      const bool isSecondNegated = isSwapped == true ? sign.mIsLhsNegated : sign.mIsRhsNegated;
+      const auto& secondNode = this->mNodes[second];
+      if (secondNode.mIsShape == false && secondNode.mIsPrunable == true && isSecondNegated == false)
+      {
+        frames.back().mPrune = static_cast<TU32>(this->mProgram.size());
+        this->mProgram.push_back({EInstruction::Prune, isSwapped, second, nodeId, 0});
+      }
+      frames.push_back({second, 0, kMaxValueOf<TU32>});
+    } break;
+    default:
+    {
+      if (const auto prune = frames.back().mPrune; prune != kMaxValueOf<TU32>)
+      {
+        this->mProgram[prune].mJump = static_cast<TU32>(this->mProgram.size() + 1);
+      }
+      this->mProgram.push_back({EInstruction::Operation, isSwapped, nodeId, nodeId, 0});
+      frames.pop_back();
+    } break;
+    }
+  }
+}
+
+template <typename TType>
+bool DSdfScene<TType>::HasRoot() const noexcept
+{
+  return this->mProgram.empty() == false;
+}
+
+template <typename TType>
+typename DSdfScene<TType>::TNodeId DSdfScene<TType>::GetRoot() const noexcept
+{
+  return this->mRoot;
+}
+
+template <typename TType>
+void DSdfScene<TType>::Clear() noexcept
+{
+  this->mNodes.clear();
+  this->mPrimitives.clear();
+  this->mProgram.clear();
+  this->mRoot = kMaxValueOf<TU32>;
+}
+
+template <typename TType>
+TIndex DSdfScene<TType>::GetNodeCount() const noexcept
+{
+  return this->mNodes.size();
+}
+
+template <typename TType>
+const typename DSdfScene<TType>::DNode& DSdfScene<TType>::GetNode(TNodeId id) const noexcept
+{
+  return this->mNodes[id];
+}
+
+template <typename TType>
+const std::vector<typename DSdfScene<TType>::DInstruction>& DSdfScene<TType>::GetProgram() const noexcept
+{
+  return this->mProgram;
+}
+
+template <typename TType>
+DBounds3D<TType> DSdfScene<TType>::GetBounds() const noexcept
+{
+  if (this->HasRoot() == false) { return {}; }
+  return this->mNodes[this->mRoot].mBounds;
+}
+
+template <typename TType>
+TReal DSdfScene<TType>::GetSDFValueOf(const DVector3<TValueType>& point) const
+{
+  if (this->HasRoot() == false) { return kMaxValueOf<TReal>; }
+  return static_cast<TReal>(this->template GetSDFValueOf<TSimdScalar<TType>>(point.X, point.Y, point.Z));
+}
+
+template <typename TType>
+void DSdfScene<TType>::GetSDFValuesOf(const DVector3Stream<TValueType>& points, TReal* oValues) const
+{
+  const TIndex count = points.size();
+  if (this->HasRoot() == false)
+  {
+    std::fill(oValues, oValues + count, kMaxValueOf<TReal>);
+    return;
+  }
+
+  const TType* px = points.GetPlane(0);
+  const TType* py = points.GetPlane(1);
+  const TType* pz = points.GetPlane(2);
+  const auto GetScalarValueOf = [this, px, py, pz, oValues](TIndex i)
+  {
+    oValues[i] = static_cast<TReal>(this->template GetSDFValueOf<TSimdScalar<TType>>(px[i], py[i], pz[i]));
+  };
+
+#ifdef MATH_SIMD_KERNELS
+  if constexpr (std::is_same_v<TType, TF32> == true && std::is_same_v<TType, TReal> == true)
+  {
+    const bool isDispatched = details::DispatchSimdF32([this, px, py, pz, oValues, count](auto simd) MATH_SIMD_INLINE
+    {
+      using TSimd = decltype(simd);
+      constexpr TIndex kLanes = TSimd::kLanes;
+      TIndex i = 0;
+      for (; i + kLanes <= count; i += kLanes)
+      {
+        TSimd::StoreU(oValues + i,
+          this->template GetSDFValueOf<TSimd>(TSimd::Load(px + i), TSimd::Load(py + i), TSimd::Load(pz + i)));
+      }
+      if (i == count) { return; }
+
+      // Cost of program does not depend on the number of lanes, so remained points (e.g. small batch of
+      // ray marching) are evaluated at once in one register padded with the last point.
+      alignas(64) TType x[kLanes];
+      alignas(64) TType y[kLanes];
+      alignas(64) TType z[kLanes];
+      alignas(64) TType values[kLanes];
+      for (TIndex k = 0; k < kLanes; ++k)
+      {
+        const TIndex j = std::min(i + k, count - 1);
+        x[k] = px[j];
+        y[k] = py[j];
+        z[k] = pz[j];
+      }
+      TSimd::Store(values, this->template GetSDFValueOf<TSimd>(TSimd::Load(x), TSimd::Load(y), TSimd::Load(z)));
+      std::copy(values, values + (count - i), oValues + i);
+    });
+    if (isDispatched == true) { return; }
+  }
+#endif
+
+  for (TIndex i = 0; i < count; ++i) { GetScalarValueOf(i); }
+}
+
+template <typename TType>
+template <typename TSimd>
+inline typename TSimd::TReg DSdfScene<TType>::GetSDFValueOf(
+  const typename TSimd::TReg& x,
+  const typename TSimd::TReg& y,
+  const typename TSimd::TReg& z) const
+{
+  using S = TSimd;
+  using TReg = typename S::TReg;
+  using TLane = typename S::TValueType;
+  constexpr TU32 kAllLanes = TU32((TU64(1) << S::kLanes) - 1);
+  const auto zero = S::Set1(TLane(0));
+  const auto one  = S::Set1(TLane(1));
+  const auto half = S::Set1(TLane(0.5));
+
+  TReg stack[kMaxStackDepth];
+  TIndex top = 0;
+  for (TIndex pc = 0, size = this->mProgram.size(); pc < size;)
+  {
+    const auto& instruction = this->mProgram[pc];
+    switch (instruction.mType)
+    {
+    case EInstruction::Shape:
+    {
+      stack[top++] = pGetSDFValueOf<S>(this->mPrimitives[instruction.mIndex], x, y, z);
+      ++pc;
+    } break;
+    case EInstruction::Prune:
+    {
+      // Distance to bounds is lower bound of SDF value of subtree, when point is outside of bounds.
+      // If it is bigger than evaluated operand (by `k` when smooth), result is evaluated operand.
+      const auto& node  = this->mNodes[instruction.mOperation];
+      const auto& min   = this->mNodes[instruction.mIndex].mBounds.GetMin();
+      const auto& max   = this->mNodes[instruction.mIndex].mBounds.GetMax();
+      const auto sign   = details::GetSignOf(node.mOperation);
+      const bool isNegated = instruction.mIsSwapped == true ? sign.mIsRhsNegated : sign.mIsLhsNegated;
+      const auto value  = isNegated == true ? S::Neg(stack[top - 1]) : stack[top - 1];
+
+      const auto dx = S::Max(S::Max(S::Sub(S::Set1(TLane(min.X)), x), S::Sub(x, S::Set1(TLane(max.X)))), zero);
+      const auto dy = S::Max(S::Max(S::Sub(S::Set1(TLane(min.Y)), y), S::Sub(y, S::Set1(TLane(max.Y)))), zero);
+      const auto dz = S::Max(S::Max(S::Sub(S::Set1(TLane(min.Z)), z), S::Sub(z, S::Set1(TLane(max.Z)))), zero);
+      const auto distance = S::Sqrt(S::Add(S::Add(S::Mul(dx, dx), S::Mul(dy, dy)), S::Mul(dz, dz)));
+      const auto isFar = sign.mIsSmooth == true
+        ? S::CmpGe(S::Sub(distance, value), S::Set1(TLane(node.mSmoothness)))
+        : S::CmpGe(distance, value);
+
+      if (S::MoveMask(S::And(S::CmpGt(distance, zero), isFar)) == kAllLanes)
+      {
+        stack[top - 1] = sign.mIsResultNegated == true ? S::Neg(value) : value;
+        pc = instruction.mJump;
+      }
+      else { ++pc; }
+    } break;
+    case EInstruction::Operation:
+    {
+      const auto& node = this->mNodes[instruction.mIndex];
+      const auto sign  = details::GetSignOf(node.mOperation);
+      const auto second = stack[--top];
+      const auto first  = stack[top - 1];
+      auto lhs = instruction.mIsSwapped == true ? second : first;
+      auto rhs = instruction.mIsSwapped == true ? first : second;
+      if (sign.mIsLhsNegated == true) { lhs = S::Neg(lhs); }
+      if (sign.mIsRhsNegated == true) { rhs = S::Neg(rhs); }
+
+      TReg result;
+      if (sign.mIsSmooth == false) { result = S::Min(lhs, rhs); }
+      else
+      {
+        // h = clamp(0.5 + 0.5 (b - a) / k, 0, 1), result = b (1 - h) + a h - k h (1 - h).
+        const auto k = S::Set1(TLane(node.mSmoothness));
+        const auto h = S::Max(S::Min(S::Add(half, S::Mul(half, S::Div(S::Sub(rhs, lhs), k))), one), zero);
+        const auto invH = S::Sub(one, h);
+        result = S::Sub(S::Add(S::Mul(rhs, invH), S::Mul(lhs, h)), S::Mul(S::Mul(k, h), invH));
+      }
+      stack[top - 1] = sign.mIsResultNegated == true ? S::Neg(result) : result;
+      ++pc;
+    } break;
+    }
+  }
+  return stack[0];
+}
+
+template <typename TType>
+template <typename TSimd>
+inline typename TSimd::TReg DSdfScene<TType>::pGetSDFValueOf(
+  const DPrimitive& primitive,
+  const typename TSimd::TReg& x,
+  const typename TSimd::TReg& y,
+  const typename TSimd::TReg& z)
+{
+  using S = TSimd;
+  using TLane = typename S::TValueType;
+  const auto& o = primitive.mOrigin;
+  const auto& p = primitive.mParams;
+  const auto zero = S::Set1(TLane(0));
+
+  const auto rx = S::Sub(x, S::Set1(TLane(o.X)));
+  const auto ry = S::Sub(y, S::Set1(TLane(o.Y)));
+  const auto rz = S::Sub(z, S::Set1(TLane(o.Z)));
+  const auto LengthOf = [](const auto& a, const auto& b, const auto& c) MATH_SIMD_INLINE
+  {
+    return S::Sqrt(S::Add(S::Add(S::Mul(a, a), S::Mul(b, b)), S::Mul(c, c)));
+  };
+
+  switch (primitive.mType)
+  {
+  case 0: // Sphere
+  {
+    return S::Sub(LengthOf(rx, ry, rz), S::Set1(TLane(p.X)));
+  }
+  case 1: // Box
+  {
+    const auto dx = S::Sub(S::Abs(rx), S::Set1(TLane(p.X)));
+    const auto dy = S::Sub(S::Abs(ry), S::Set1(TLane(p.Y)));
+    const auto dz = S::Sub(S::Abs(rz), S::Set1(TLane(p.Z)));
+    const auto outside = LengthOf(S::Max(dx, zero), S::Max(dy, zero), S::Max(dz, zero));
+    const auto inside  = S::Min(S::Max(S::Max(dz, dy), dx), zero);
+    return S::Add(outside, inside);
+  }
+  case 2: // Capsule
+  {
+    // Nearest point of segment is (0, clamp(y, 0, height), 0).
+    const auto segmentY = S::Max(S::Min(ry, S::Set1(TLane(p.X))), zero);
+    return S::Sub(LengthOf(rx, S::Sub(ry, segmentY), rz), S::Set1(TLane(p.Y)));
+  }
+  case 3: // Cone
+  {
+    const auto q = S::Sqrt(S::Add(S::Mul(rx, rx), S::Mul(rz, rz)));
+    const auto side = S::Add(S::Mul(S::Set1(TLane(p.X)), q), S::Mul(S::Set1(TLane(p.Y)), ry));
+    const auto bottom = S::Sub(S::Set1(TLane(p.Z)), y);
+    return S::Select(S::CmpLt(side, zero), S::Max(side, bottom), side);
+  }
+  case 4: // Torus
+  {
+    const auto q = S::Sub(S::Sqrt(S::Add(S::Mul(rx, rx), S::Mul(rz, rz))), S::Set1(TLane(p.X)));
+    return S::Sub(S::Sqrt(S::Add(S::Mul(q, q), S::Mul(ry, ry))), S::Set1(TLane(p.Y)));
+  }
+  default: // Plane
+  {
+    const auto dot = S::Add(S::Add(S::Mul(x, S::Set1(TLane(o.X))), S::Mul(y, S::Set1(TLane(o.Y)))), S::Mul(z, S::Set1(TLane(o.Z))));
+    return S::Div(S::Add(dot, S::Set1(TLane(p.X))), S::Set1(TLane(p.Y)));
+  }
+  }
+}
+
+} /// ::dy::math namespace
+
+MATH_SIMD_KERNEL_REGION_END
@@ -25,20 +25,20 @@ namespace dy::math
 {
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
+constexpr DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::DVector2(TValueType x, TValueType y) noexcept
   : X{x}, Y{y}
 { }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
+constexpr DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::DVector2(TValueType value) noexcept
   : X{value}, Y{value} 
 { }
 
 template <typename TType>
 template <typename TAnotherType>
-DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
+constexpr DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator DVector2<TAnotherType>() const noexcept
 {
   using AnotherType = typename DVector2<
@@ -53,7 +53,7 @@ DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-typename DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>::TValueType& 
+constexpr typename DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>::TValueType& 
 DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator[](TIndex index)
 {
@@ -67,7 +67,7 @@ DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-const typename DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>::TValueType& 
+constexpr const typename DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>::TValueType& 
 DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator[](TIndex index) const 
 {
@@ -122,7 +122,7 @@ DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
+constexpr DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
 DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator+=(const DVector2& value) noexcept
 {
@@ -131,7 +131,7 @@ DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
+constexpr DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
 DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator-=(const DVector2& value) noexcept
 {
@@ -140,7 +140,7 @@ DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
+constexpr DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
 DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator*=(TValueType value) noexcept
 {
@@ -149,7 +149,7 @@ DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
+constexpr DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
 DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator*=(const DVector2& value) noexcept
 {
@@ -158,7 +158,7 @@ DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
+constexpr DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
 DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator/=(TValueType value)
 {
@@ -167,7 +167,7 @@ DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
+constexpr DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>&
 DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator/=(const DVector2& value)
 {
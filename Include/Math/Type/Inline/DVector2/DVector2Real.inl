@@ -24,20 +24,20 @@ namespace dy::math
 {
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
+constexpr DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::DVector2(TValueType x, TValueType y) noexcept
   : X{x}, Y{y}
 { }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
+constexpr DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::DVector2(TValueType value) noexcept
   : X{value}, Y{value} 
 { }
 
 template <typename TType>
 template <typename TAnotherType>
-DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
+constexpr DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator DVector2<TAnotherType>() const noexcept
 {
   using AnotherType = typename DVector2<
@@ -54,7 +54,7 @@ DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-typename DVector2<TType, std::enable_if_t<kIsRealType<TType>>>::TValueType& 
+constexpr typename DVector2<TType, std::enable_if_t<kIsRealType<TType>>>::TValueType& 
 DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator[](TIndex index)
 {
@@ -68,7 +68,7 @@ DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-const typename DVector2<TType, std::enable_if_t<kIsRealType<TType>>>::TValueType& 
+constexpr const typename DVector2<TType, std::enable_if_t<kIsRealType<TType>>>::TValueType& 
 DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator[](TIndex index) const 
 {
@@ -144,7 +144,7 @@ DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
+constexpr DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
 DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator+=(const DVector2& value) noexcept
 {
@@ -153,7 +153,7 @@ DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
+constexpr DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
 DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator-=(const DVector2& value) noexcept
 {
@@ -162,7 +162,7 @@ DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
+constexpr DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
 DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator*=(TValueType value) noexcept
 {
@@ -171,7 +171,7 @@ DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
+constexpr DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
 DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator*=(const DVector2& value) noexcept
 {
@@ -180,7 +180,7 @@ DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
+constexpr DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
 DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator/=(TValueType value)
 {
@@ -189,7 +189,7 @@ DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
+constexpr DVector2<TType, std::enable_if_t<kIsRealType<TType>>>& 
 DVector2<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator/=(const DVector2& value)
 {
@@ -16,7 +16,7 @@ namespace dy::math
 {
 
 template <typename TLeft, typename TRight>
-DVector3<GetBiggerType<TLeft, TRight>> 
+constexpr DVector3<GetBiggerType<TLeft, TRight>> 
 operator+(const DVector3<TLeft>& lhs, const DVector3<TRight>& rhs) noexcept 
 {
   using TBiggerType = GetBiggerType<TLeft, TRight>;
@@ -24,7 +24,7 @@ operator+(const DVector3<TLeft>& lhs, const DVector3<TRight>& rhs) noexcept
 }
 
 template <typename TLeft, typename TRight>
-DVector3<GetBiggerType<TLeft, TRight>> 
+constexpr DVector3<GetBiggerType<TLeft, TRight>> 
 operator-(const DVector3<TLeft>& lhs, const DVector3<TRight>& rhs) noexcept 
 {
   using TBiggerType = GetBiggerType<TLeft, TRight>;
@@ -36,7 +36,7 @@ template <
   typename TType, typename TValue, 
   typename = std::enable_if_t<std::is_arithmetic_v<TValue> == true>
 >
-DVector3<GetBiggerType<TType, TValue>> 
+constexpr DVector3<GetBiggerType<TType, TValue>> 
 operator*(const DVector3<TType>& lhs, TValue rhs) noexcept
 {
   using TBiggerType = GetBiggerType<TType, TValue>;
@@ -47,7 +47,7 @@ template <
   typename TType, typename TValue, 
   typename = std::enable_if_t<std::is_arithmetic_v<TValue> == true>
 >
-DVector3<GetBiggerType<TType, TValue>> 
+constexpr DVector3<GetBiggerType<TType, TValue>> 
 operator*(TValue lhs, const DVector3<TType>& rhs) noexcept
 {
   using TBiggerType = GetBiggerType<TType, TValue>;
@@ -56,7 +56,7 @@ operator*(TValue lhs, const DVector3<TType>& rhs) noexcept
 
 /// If lhs and rhs are DVector3<TType>, element multiplication happens.
 template <typename TLeft, typename TRight>
-DVector3<GetBiggerType<TLeft, TRight>> 
+constexpr DVector3<GetBiggerType<TLeft, TRight>> 
 operator*(const DVector3<TLeft>& lhs, const DVector3<TRight>& rhs) noexcept 
 {
   using TBiggerType = GetBiggerType<TLeft, TRight>;
@@ -68,7 +68,7 @@ template <
   typename TType, typename TValue, 
   typename = std::enable_if_t<std::is_arithmetic_v<TValue> == true>
 >
-DVector3<GetBiggerType<TType, TValue>> 
+constexpr DVector3<GetBiggerType<TType, TValue>> 
 operator/(DVector3<TType> lhs, TValue rhs) noexcept 
 {
   using TBiggerType = GetBiggerType<TType, TValue>;
@@ -79,7 +79,7 @@ template <
   typename TType, typename TValue, 
   typename = std::enable_if_t<std::is_arithmetic_v<TValue> == true>
 >
-DVector3<GetBiggerType<TType, TValue>> 
+constexpr DVector3<GetBiggerType<TType, TValue>> 
 operator/(TValue lhs, const DVector3<TType>& rhs) noexcept
 {
   using TBiggerType = GetBiggerType<TType, TValue>;
@@ -88,7 +88,7 @@ operator/(TValue lhs, const DVector3<TType>& rhs) noexcept
 
 /// If rhs vector has any 0 value, this function just do nothing.
 template <typename TLeft, typename TRight>
-DVector3<GetBiggerType<TLeft, TRight>> 
+constexpr DVector3<GetBiggerType<TLeft, TRight>> 
 operator/(DVector3<TLeft> lhs, const DVector3<TRight>& rhs) noexcept 
 {
   using TBiggerType = GetBiggerType<TLeft, TRight>;
@@ -96,13 +96,13 @@ operator/(DVector3<TLeft> lhs, const DVector3<TRight>& rhs) noexcept
 }
 
 template <typename TType>
-bool operator==(const DVector3<TType>& lhs, const DVector3<TType>& rhs) noexcept
+constexpr bool operator==(const DVector3<TType>& lhs, const DVector3<TType>& rhs) noexcept
 {
   return lhs.X == rhs.X && lhs.Y == rhs.Y && lhs.Z == rhs.Z;
 }
 
 template <typename TType>
-bool operator!=(const DVector3<TType>& lhs, const DVector3<TType>& rhs) noexcept
+constexpr bool operator!=(const DVector3<TType>& lhs, const DVector3<TType>& rhs) noexcept
 {
   return !(lhs == rhs);
 }
@@ -16,26 +16,26 @@ namespace dy::math
 {
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::DVector3(TValueType x, TValueType y, TValueType z) noexcept
   : X{x}, Y{y}, Z{z}
 { }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::DVector3(TValueType value) noexcept
   : X{value}, Y{value}, Z{value} 
 { }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::DVector3(const DVector2<TValueType>& value) noexcept
   : X{value.X}, Y{value.Y}, Z{TValueType{}} 
 { }
 
 template <typename TType>
 template <typename TAnotherType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator DVector3<TAnotherType>() const noexcept
 {
   using AnotherType = typename DVector3<
@@ -49,14 +49,14 @@ DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>::operator 
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>::operator 
 DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>>() const noexcept
 {
   return DVector2<TType>{this->X, this->Y};
 }
 
 template <typename TType>
-typename DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>::TValueType& 
+constexpr typename DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>::TValueType& 
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator[](TIndex index)
 {
@@ -71,7 +71,7 @@ DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-const typename DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>::TValueType& 
+constexpr const typename DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>::TValueType& 
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator[](TIndex index) const
 {
@@ -131,7 +131,7 @@ DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>& 
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>& 
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator+=(const DVector3& value) noexcept
 {
@@ -140,7 +140,7 @@ DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>& 
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>& 
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator-=(const DVector3& value) noexcept
 {
@@ -149,7 +149,7 @@ DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>&
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>&
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator*=(TValueType value) noexcept
 {
@@ -158,7 +158,7 @@ DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>& 
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>& 
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator*=(const DVector3& value) noexcept
 {
@@ -167,7 +167,7 @@ DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>&
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>&
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator/=(TValueType value) noexcept
 {
@@ -176,7 +176,7 @@ DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>& 
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>& 
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 ::operator/=(const DVector3& value) noexcept
 {
@@ -185,27 +185,24 @@ DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>
 }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>> 
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>> 
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>::UnitX() noexcept
 {
-  static DVector3 ret{1, 0, 0};
-  return ret;
+  return DVector3{1, 0, 0};
 }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>> 
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>> 
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>::UnitY() noexcept
 {
-  static DVector3 ret{0, 1, 0};
-  return ret;
+  return DVector3{0, 1, 0};
 }
 
 template <typename TType>
-DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>> 
+constexpr DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>> 
 DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>>::UnitZ() noexcept
 {
-  static DVector3 ret{0, 0, 1};
-  return ret;
+  return DVector3{0, 0, 1};
 }
 
 } /// ::dy::math namespace
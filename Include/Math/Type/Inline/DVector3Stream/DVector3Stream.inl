@@ -0,0 +1,186 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cassert>
+#include <type_traits>
+
+#ifdef MATH_ENABLE_SIMD
+#include <emmintrin.h>
+#include <smmintrin.h>
+#endif
+
+namespace dy::math
+{
+
+template <typename TType>
+DVector3Stream<TType>::DVector3Stream(TIndex size)
+{
+  this->resize(size);
+}
+
+template <typename TType>
+DVector3Stream<TType>::DVector3Stream(const DVector3<TValueType>* iValues, TIndex count)
+{
+  this->Gather(iValues, count);
+}
+
+template <typename TType>
+TIndex DVector3Stream<TType>::size() const noexcept
+{
+  return this->__mPlanes[0].size();
+}
+
+template <typename TType>
+bool DVector3Stream<TType>::empty() const noexcept
+{
+  return this->__mPlanes[0].empty();
+}
+
+template <typename TType>
+void DVector3Stream<TType>::resize(TIndex size)
+{
+  for (auto& plane : this->__mPlanes) { plane.resize(size); }
+}
+
+template <typename TType>
+void DVector3Stream<TType>::reserve(TIndex capacity)
+{
+  for (auto& plane : this->__mPlanes) { plane.reserve(capacity); }
+}
+
+template <typename TType>
+void DVector3Stream<TType>::clear() noexcept
+{
+  for (auto& plane : this->__mPlanes) { plane.clear(); }
+}
+
+template <typename TType>
+void DVector3Stream<TType>::push_back(const DVector3<TValueType>& value)
+{
+  this->__mPlanes[0].push_back(value.X);
+  this->__mPlanes[1].push_back(value.Y);
+  this->__mPlanes[2].push_back(value.Z);
+}
+
+template <typename TType>
+DVector3<TType> DVector3Stream<TType>::Get(TIndex index) const noexcept
+{
+  assert(index < this->size());
+  return {this->__mPlanes[0][index], this->__mPlanes[1][index], this->__mPlanes[2][index]};
+}
+
+template <typename TType>
+void DVector3Stream<TType>::Set(TIndex index, const DVector3<TValueType>& value) noexcept
+{
+  assert(index < this->size());
+  this->__mPlanes[0][index] = value.X;
+  this->__mPlanes[1][index] = value.Y;
+  this->__mPlanes[2][index] = value.Z;
+}
+
+template <typename TType>
+TType* DVector3Stream<TType>::GetPlane(TIndex axis) noexcept
+{
+  return this->__mPlanes[axis].data();
+}
+
+template <typename TType>
+const TType* DVector3Stream<TType>::GetPlane(TIndex axis) const noexcept
+{
+  return this->__mPlanes[axis].data();
+}
+
+template <typename TType>
+void DVector3Stream<TType>::Gather(const DVector3<TValueType>* iValues, TIndex count)
+{
+  this->resize(count);
+  TType* x = this->GetPlane(0);
+  TType* y = this->GetPlane(1);
+  TType* z = this->GetPlane(2);
+
+  TIndex i = 0;
+#ifdef MATH_ENABLE_SIMD
+  if constexpr (std::is_same_v<TType, TF32> && sizeof(DVector3<TF32>) == sizeof(TF32) * 3)
+  {
+    // Load 4 vectors (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3) and transpose them to planes.
+    const TIndex simdCount = count - count % 4;
+    for (; i < simdCount; i += 4)
+    {
+      const TF32* src = &iValues[i].X;
+      const __m128 v0 = _mm_loadu_ps(src);
+      const __m128 v1 = _mm_loadu_ps(src + 4);
+      const __m128 v2 = _mm_loadu_ps(src + 8);
+
+      const __m128 x23 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(1, 1, 2, 2));
+      const __m128 y01 = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 1, 1));
+      const __m128 y23 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 2, 3, 3));
+      const __m128 z01 = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 1, 2, 2));
+      _mm_store_ps(x + i, _mm_shuffle_ps(v0, x23, _MM_SHUFFLE(2, 0, 3, 0)));
+      _mm_store_ps(y + i, _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0)));
+      _mm_store_ps(z + i, _mm_shuffle_ps(z01, v2, _MM_SHUFFLE(3, 0, 2, 0)));
+    }
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    x[i] = iValues[i].X;
+    y[i] = iValues[i].Y;
+    z[i] = iValues[i].Z;
+  }
+}
+
+template <typename TType>
+void DVector3Stream<TType>::Scatter(DVector3<TValueType>* oValues) const noexcept
+{
+  const TIndex count = this->size();
+  const TType* x = this->GetPlane(0);
+  const TType* y = this->GetPlane(1);
+  const TType* z = this->GetPlane(2);
+
+  TIndex i = 0;
+#ifdef MATH_ENABLE_SIMD
+  if constexpr (std::is_same_v<TType, TF32> && sizeof(DVector3<TF32>) == sizeof(TF32) * 3)
+  {
+    // Transpose 4 vectors of planes into (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3).
+    for (; i + 4 <= count; i += 4)
+    {
+      const __m128 vx = _mm_load_ps(x + i);
+      const __m128 vy = _mm_load_ps(y + i);
+      const __m128 vz = _mm_load_ps(z + i);
+
+      TF32* dst = &oValues[i].X;
+      _mm_storeu_ps(dst, _mm_shuffle_ps(
+        _mm_shuffle_ps(vx, vy, _MM_SHUFFLE(0, 0, 0, 0)),
+        _mm_shuffle_ps(vz, vx, _MM_SHUFFLE(1, 1, 0, 0)),
+        _MM_SHUFFLE(2, 0, 2, 0)));
+      _mm_storeu_ps(dst + 4, _mm_shuffle_ps(
+        _mm_shuffle_ps(vy, vz, _MM_SHUFFLE(1, 1, 1, 1)),
+        _mm_shuffle_ps(vx, vy, _MM_SHUFFLE(2, 2, 2, 2)),
+        _MM_SHUFFLE(2, 0, 2, 0)));
+      _mm_storeu_ps(dst + 8, _mm_shuffle_ps(
+        _mm_shuffle_ps(vz, vx, _MM_SHUFFLE(3, 3, 2, 2)),
+        _mm_shuffle_ps(vy, vz, _MM_SHUFFLE(3, 3, 3, 3)),
+        _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    oValues[i] = {x[i], y[i], z[i]};
+  }
+}
+
+} /// ::dy::math namespace
@@ -16,32 +16,32 @@ namespace dy::math
 {
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept
   : X{x}, Y{y}, Z{z}, W{w}
 { }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::DVector4(TValueType value) noexcept
   : X{value}, Y{value}, Z{value}, W{value}
 { }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::DVector4(const DVector2<TValueType>& value, TValueType z, TValueType w) noexcept
   : X{value.X}, Y{value.Y}, Z{z}, W{w} 
 { }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::DVector4(const DVector3<TValueType>& value, TValueType w) noexcept
   : X{value.X}, Y{value.Y}, Z{value.Z}, W{w}
 { }
 
 template <typename TType>
 template <typename TAnotherType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator DVector4<TAnotherType>() const noexcept
 {
   using AnotherType = typename DVector4<
@@ -58,21 +58,21 @@ DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator DVector2<TType>() const noexcept
 {
   return DVector2<TType>{this->X, this->Y};
 }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator DVector3<TType>() const noexcept
 {
   return DVector3<TType>{this->X, this->Y, this->Z};
 }
 
 template <typename TType>
-typename DVector4<TType, std::enable_if_t<kIsRealType<TType>>>::TValueType& 
+constexpr typename DVector4<TType, std::enable_if_t<kIsRealType<TType>>>::TValueType& 
 DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator[](TIndex index)
 {
@@ -88,7 +88,7 @@ DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-const typename DVector4<TType, std::enable_if_t<kIsRealType<TType>>>::TValueType& 
+constexpr const typename DVector4<TType, std::enable_if_t<kIsRealType<TType>>>::TValueType& 
 DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator[](TIndex index) const
 {
@@ -143,8 +143,8 @@ template <typename TType>
 TReal DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::GetHomogeneousLength() const noexcept
 {
-  const auto w = Cast<TReal>(this->W);
-  return DVector3<TReal>{this->X / w, this->Y / w, this->Z / w}.GetLength();
+  const auto w = this->W;
+  return DVector3<TType>{this->X / w, this->Y / w, this->Z / w}.GetLength();
 }
 
 template <typename TType>
@@ -163,7 +163,7 @@ DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>& 
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>& 
 DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator+=(const DVector4& value) noexcept
 {
@@ -172,7 +172,7 @@ DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>& 
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>& 
 DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator-=(const DVector4& value) noexcept
 {
@@ -181,7 +181,7 @@ DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>&
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>&
 DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator*=(TValueType value) noexcept
 {
@@ -190,7 +190,7 @@ DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>& 
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>& 
 DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator*=(const DVector4& value) noexcept
 {
@@ -199,7 +199,7 @@ DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>&
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>&
 DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator/=(TValueType value) noexcept
 {
@@ -208,7 +208,7 @@ DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 }
 
 template <typename TType>
-DVector4<TType, std::enable_if_t<kIsRealType<TType>>>& 
+constexpr DVector4<TType, std::enable_if_t<kIsRealType<TType>>>& 
 DVector4<TType, std::enable_if_t<kIsRealType<TType>>>
 ::operator/=(const DVector4& value) noexcept
 {
@@ -23,11 +23,8 @@ template <>
 struct MATH_NODISCARD DVector4<TF32, void> final
 {
   using TValueType = TF32;
-  union
-  {
-    __m128 __mVal;
-    struct { TValueType X, Y, Z, W; };
-  };
+  alignas(16) TValueType X;
+  TValueType Y, Z, W;
 
   DVector4() = default;
   DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept;
@@ -36,6 +33,11 @@ struct MATH_NODISCARD DVector4<TF32, void> final
   DVector4(const DVector3<TValueType>& value, TValueType w = TValueType{}) noexcept;
   DVector4(__m128 __iSimd) noexcept;
 
+  /// @brief Load values into SIMD register.
+  __m128 __GetSimd() const noexcept;
+  /// @brief Store SIMD register into values.
+  void __SetSimd(__m128 __iSimd) noexcept;
+
   template <typename TAnotherType>
   explicit operator DVector4<TAnotherType>() const noexcept;
   /// @brief Narrow conversion.
@@ -96,28 +98,43 @@ DVector4<TF32, void>::operator DVector4<TAnotherType>() const noexcept
 
 inline DVector4<TF32, void>  // NOLINT
 ::DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept
-  : __mVal{_mm_set_ps(w, z, y, x)}  // NOLINT
-{ }
+{
+  this->__SetSimd(_mm_set_ps(w, z, y, x));
+}
 
 inline DVector4<TF32, void> // NOLINT
 ::DVector4(TValueType value) noexcept
-  : __mVal{_mm_set_ps1(value)}  
-{ }
+{
+  this->__SetSimd(_mm_set_ps1(value));
+}
 
 inline DVector4<TF32, void> // NOLINT
 ::DVector4(const DVector2<TValueType>& value, TValueType z, TValueType w) noexcept
-  : __mVal{_mm_set_ps(w, z, value.Y, value.X)}  
-{ }
+{
+  this->__SetSimd(_mm_set_ps(w, z, value.Y, value.X));
+}
 
 inline DVector4<float, void> // NOLINT
 ::DVector4(const DVector3<TValueType>& value, TValueType w) noexcept
-  : __mVal{_mm_set_ps(w, value.Z, value.Y, value.X)}  
-{ }
+{
+  this->__SetSimd(_mm_set_ps(w, value.Z, value.Y, value.X));
+}
 
 inline DVector4<TF32, void> // NOLINT
 ::DVector4(__m128 __iSimd) noexcept
-  : __mVal{__iSimd}
-{ }
+{
+  this->__SetSimd(__iSimd);
+}
+
+inline __m128 DVector4<TF32, void>::__GetSimd() const noexcept
+{
+  return _mm_load_ps(&this->X);
+}
+
+inline void DVector4<TF32, void>::__SetSimd(__m128 __iSimd) noexcept
+{
+  _mm_store_ps(&this->X, __iSimd);
+}
 
 inline DVector4<TF32>::TValueType& 
 DVector4<TF32, void>::operator[](TIndex index) // NOLINT
@@ -163,7 +180,7 @@ inline TReal
 DVector4<TF32, void>::GetSquareLength() const noexcept
 {
   // Do dot product. (SSE4.1)
-  const auto result = _mm_dp_ps(this->__mVal, this->__mVal, 0xFF);    
+  const auto result = _mm_dp_ps(this->__GetSimd(), this->__GetSimd(), 0xFF);    
   // Store float into values. (SSE)
   TF32 value[4];
   _mm_store_ps(value, result);                        
@@ -179,20 +196,14 @@ DVector4<TF32, void>::GetLength() const noexcept
 inline TReal 
 DVector4<TF32, void>::GetHomogeneousLength() const noexcept
 {
-  TF32 vectorValues[4]; _mm_store_ps(vectorValues, this->__mVal);                        
+  TF32 vectorValues[4]; _mm_store_ps(vectorValues, this->__GetSimd());                        
   // Do dot product. (SSE4.1)
   const auto rejectedWSimd = _mm_set_ps(0, vectorValues[2], vectorValues[1], vectorValues[0]);
   const auto result = _mm_sqrt_ps(_mm_dp_ps(rejectedWSimd, rejectedWSimd, 0xFF));    
 
-#ifndef MATH_USE_REAL_AS_DOUBLE
   // Store float into values. (SSE)
   TF32 value[4]; _mm_store_ps(value, result);                        
   return value[3];
-#else
-  // Store double into values. (SSE)
-  TF64 value[4]; _mm_store_pd(value, _mm_cvtps_pd(result));                        
-  return value[3];
-#endif
 }
 
 inline DVector4<TReal> 
@@ -200,54 +211,53 @@ DVector4<TF32, void>::Normalize() const noexcept
 {
 #ifndef MATH_USE_REAL_AS_DOUBLE
   // Do dot product. (SSE4.1) and sqrt (SSE2) to get length.
-  const auto result = _mm_sqrt_ps(_mm_dp_ps(this->__mVal, this->__mVal, 0xFF));    
-  return DVector4<TReal>{_mm_div_ps(this->__mVal, result)};
+  const auto result = _mm_sqrt_ps(_mm_dp_ps(this->__GetSimd(), this->__GetSimd(), 0xFF));    
+  return DVector4<TReal>{_mm_div_ps(this->__GetSimd(), result)};
 #else
-  // Do dot product. (SSE4.1) and sqrt (SSE2) to get length.
-  const auto result = _mm_sqrt_pd(_mm_dp_pd(this->__mVal, this->__mVal, 0xFF));    
-  return DVector4<TReal>{_mm_div_pd(simd, result)};
+  // Normalize with TReal (TF64) precision, as scalar code does.
+  return static_cast<DVector4<TReal>>(*this).Normalize();
 #endif
 }
 
 inline DVector4<TF32>& 
 DVector4<TF32, void>::operator+=(const DVector4& value) noexcept
 {
-  this->__mVal = _mm_add_ps(this->__mVal, value.__mVal);
+  this->__SetSimd(_mm_add_ps(this->__GetSimd(), value.__GetSimd()));
   return *this;
 }
 
 inline DVector4<TF32>& 
 DVector4<TF32, void>::operator-=(const DVector4& value) noexcept
 {
-  this->__mVal = _mm_sub_ps(this->__mVal, value.__mVal);
+  this->__SetSimd(_mm_sub_ps(this->__GetSimd(), value.__GetSimd()));
   return *this;
 }
 
 inline DVector4<TF32>& 
 DVector4<TF32, void>::operator*=(TValueType value) noexcept
 {
-  this->__mVal = _mm_mul_ps(this->__mVal, _mm_set_ps1(value));
+  this->__SetSimd(_mm_mul_ps(this->__GetSimd(), _mm_set_ps1(value)));
   return *this;
 }
 
 inline DVector4<TF32>& 
 DVector4<float, void>::operator*=(const DVector4& value) noexcept
 {
-  this->__mVal = _mm_mul_ps(this->__mVal, value.__mVal);
+  this->__SetSimd(_mm_mul_ps(this->__GetSimd(), value.__GetSimd()));
   return *this;
 }
 
 inline DVector4<TF32>& 
 DVector4<TF32, void>::operator/=(TValueType value) noexcept
 {
-  this->__mVal = _mm_div_ps(this->__mVal, _mm_set_ps1(value));
+  this->__SetSimd(_mm_div_ps(this->__GetSimd(), _mm_set_ps1(value)));
   return *this;
 }
 
 inline DVector4<TF32>& 
 DVector4<TF32, void>::operator/=(const DVector4& value) noexcept
 {
-  this->__mVal = _mm_div_ps(this->__mVal, value.__mVal);
+  this->__SetSimd(_mm_div_ps(this->__GetSimd(), value.__GetSimd()));
   return *this;
 }
 
@@ -21,19 +21,19 @@ namespace dy::math
 inline DVector4<TF32>
 operator+(const DVector4<TF32>& lhs, const DVector4<TF32>& rhs) noexcept 
 {
-  return {_mm_add_ps(lhs.__mVal, rhs.__mVal)};
+  return {_mm_add_ps(lhs.__GetSimd(), rhs.__GetSimd())};
 }
 
 inline DVector4<TF32>
 operator-(const DVector4<TF32>& lhs, const DVector4<TF32>& rhs) noexcept 
 {
-  return {_mm_sub_ps(lhs.__mVal, rhs.__mVal)};
+  return {_mm_sub_ps(lhs.__GetSimd(), rhs.__GetSimd())};
 }
 
 inline DVector4<TF32>
 operator*(const DVector4<TF32>& lhs, TF32 rhs) noexcept
 {
-  return {_mm_mul_ps(lhs.__mVal, _mm_set_ps1(rhs))};
+  return {_mm_mul_ps(lhs.__GetSimd(), _mm_set_ps1(rhs))};
 }
 
 inline DVector4<TF32>
@@ -45,31 +45,31 @@ operator*(TF32 lhs, const DVector4<TF32>& rhs) noexcept
 inline DVector4<TF32>
 operator*(const DVector4<TF32>& lhs, const DVector4<TF32>& rhs) noexcept 
 {
-  return {_mm_mul_ps(lhs.__mVal, rhs.__mVal)};
+  return {_mm_mul_ps(lhs.__GetSimd(), rhs.__GetSimd())};
 }
 
 inline DVector4<TF32>
 operator/(DVector4<TF32> lhs, TF32 rhs) noexcept 
 {
-  return {_mm_div_ps(lhs.__mVal, _mm_set_ps1(rhs))};
+  return {_mm_div_ps(lhs.__GetSimd(), _mm_set_ps1(rhs))};
 }
 
 inline DVector4<TF32>
 operator/(TF32 lhs, const DVector4<TF32>& rhs) noexcept
 {
-  return {_mm_div_ps(_mm_set_ps1(lhs), rhs.__mVal)};
+  return {_mm_div_ps(_mm_set_ps1(lhs), rhs.__GetSimd())};
 }
 
 inline DVector4<TF32>
 operator/(DVector4<TF32> lhs, const DVector4<TF32>& rhs) noexcept 
 {
-  return {_mm_div_ps(lhs.__mVal, rhs.__mVal)};
+  return {_mm_div_ps(lhs.__GetSimd(), rhs.__GetSimd())};
 }
 
 inline bool 
 operator==(const DVector4<TF32>& lhs, const DVector4<TF32>& rhs) noexcept
 {
-  return !(_mm_movemask_ps(_mm_cmpeq_ps(lhs.__mVal, rhs.__mVal)) != 0xF);
+  return !(_mm_movemask_ps(_mm_cmpeq_ps(lhs.__GetSimd(), rhs.__GetSimd())) != 0xF);
 }
 
 } /// ::dy::math namespace
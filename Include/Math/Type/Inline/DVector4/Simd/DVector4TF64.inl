@@ -0,0 +1,309 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+/// AVX2 specialization of DVector4<TF64>. (X, Y, Z, W) are 32-byte aligned, and loaded into one `__m256d`.
+/// Horizontal sums add lanes from X to W one by one, so lengths are same to scalar path.
+
+#if defined(MATH_ENABLE_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+
+namespace dy::math
+{
+
+template <>
+struct MATH_NODISCARD DVector4<TF64, void> final
+{
+  using TValueType = TF64;
+  alignas(32) TValueType X;
+  TValueType Y, Z, W;
+
+  DVector4() = default;
+  DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept;
+  DVector4(TValueType value) noexcept;
+  DVector4(const DVector2<TValueType>& value, TValueType z = TValueType{}, TValueType w = TValueType{}) noexcept;
+  DVector4(const DVector3<TValueType>& value, TValueType w = TValueType{}) noexcept;
+  DVector4(__m256d __iSimd) noexcept;
+
+  /// @brief Load values into SIMD register.
+  __m256d __GetSimd() const noexcept;
+  /// @brief Store SIMD register into values.
+  void __SetSimd(__m256d __iSimd) noexcept;
+
+  template <typename TAnotherType>
+  explicit operator DVector4<TAnotherType>() const noexcept;
+  /// @brief Narrow conversion.
+  explicit operator DVector2<TValueType>() const noexcept;
+  /// @brief Narrow conversion.
+  explicit operator DVector3<TValueType>() const noexcept;
+
+  /// @brief Get values with index. index must be 0, 1, 2 or 3.
+  TValueType& operator[](TIndex index);
+  /// @brief Get values with index. index must be 0, 1, 2 or 3.
+  const TValueType& operator[](TIndex index) const;
+
+  /// @brief Return data chunk pointer of DVector4.
+  TValueType* Data() noexcept;
+  /// @brief Return data chunk pointer of DVector4.
+  const TValueType* Data() const noexcept;
+
+  /// @brief Return squared length of this vector.
+  TReal GetSquareLength() const noexcept;
+  /// @brief Returns the length of this vector.
+  TReal GetLength() const noexcept;
+  /// @brief Return the length of this vector as homogeneous coordinate position.
+  TReal GetHomogeneousLength() const noexcept;
+
+  /// @brief Return new DVector4 instance of normalized input vector.
+  DVector4<TReal> Normalize() const noexcept;
+
+  /// @brief Check value has NaN.
+  bool HasNaN() const noexcept;
+  /// @brief Check value has Infinity.
+  bool HasInfinity() const noexcept;
+  /// @brief Check values are normal value, neither NaN nor Inf.
+  bool HasOnlyNormal() const noexcept;
+
+  DVector4& operator+=(const DVector4& value) noexcept;
+  DVector4& operator-=(const DVector4& value) noexcept;
+  DVector4& operator*=(TValueType value) noexcept;
+  DVector4& operator*=(const DVector4& value) noexcept;
+  DVector4& operator/=(TValueType value) noexcept;
+  DVector4& operator/=(const DVector4& value) noexcept;
+};
+
+} /// ::dy::math namespace
+
+namespace dy::math::details
+{
+
+/// @brief Return `((v[0] + v[1]) + v[2]) + v[3]`.
+inline TF64 SumLanesOf(__m256d value) noexcept
+{
+  const __m128d low  = _mm256_castpd256_pd128(value);
+  const __m128d high = _mm256_extractf128_pd(value, 1);
+  __m128d sum = _mm_add_sd(low, _mm_unpackhi_pd(low, low));
+  sum = _mm_add_sd(sum, high);
+  sum = _mm_add_sd(sum, _mm_unpackhi_pd(high, high));
+  return _mm_cvtsd_f64(sum);
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+template <typename TAnotherType>
+DVector4<TF64, void>::operator DVector4<TAnotherType>() const noexcept
+{
+  using AnotherType = typename DVector4<
+    TAnotherType,
+    std::enable_if_t<kIsIntegerType<TAnotherType> || kIsRealType<TAnotherType>>>::TValueType;
+
+  return DVector4<TAnotherType>
+  {
+    Cast<AnotherType>(this->X),
+    Cast<AnotherType>(this->Y),
+    Cast<AnotherType>(this->Z),
+    Cast<AnotherType>(this->W)
+  };
+}
+
+inline DVector4<TF64, void>  // NOLINT
+::DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept
+{
+  this->__SetSimd(_mm256_set_pd(w, z, y, x));
+}
+
+inline DVector4<TF64, void> // NOLINT
+::DVector4(TValueType value) noexcept
+{
+  this->__SetSimd(_mm256_set1_pd(value));
+}
+
+inline DVector4<TF64, void> // NOLINT
+::DVector4(const DVector2<TValueType>& value, TValueType z, TValueType w) noexcept
+{
+  this->__SetSimd(_mm256_set_pd(w, z, value.Y, value.X));
+}
+
+inline DVector4<TF64, void> // NOLINT
+::DVector4(const DVector3<TValueType>& value, TValueType w) noexcept
+{
+  this->__SetSimd(_mm256_set_pd(w, value.Z, value.Y, value.X));
+}
+
+inline DVector4<TF64, void> // NOLINT
+::DVector4(__m256d __iSimd) noexcept
+{
+  this->__SetSimd(__iSimd);
+}
+
+inline __m256d DVector4<TF64, void>::__GetSimd() const noexcept
+{
+  return _mm256_load_pd(&this->X);
+}
+
+inline void DVector4<TF64, void>::__SetSimd(__m256d __iSimd) noexcept
+{
+  _mm256_store_pd(&this->X, __iSimd);
+}
+
+inline DVector4<TF64, void>::operator DVector2<TF64>() const noexcept
+{
+  return DVector2<TF64>{this->X, this->Y};
+}
+
+inline DVector4<TF64, void>::operator DVector3<TF64>() const noexcept
+{
+  return DVector3<TF64>{this->X, this->Y, this->Z};
+}
+
+inline DVector4<TF64>::TValueType&
+DVector4<TF64, void>::operator[](TIndex index) // NOLINT
+{
+  switch (index)
+  {
+  case 0: return this->X;
+  case 1: return this->Y;
+  case 2: return this->Z;
+  case 3: return this->W;
+  default:
+    M_ASSERT_OR_THROW(false, "index must be 0, 1, 2 and 3.");
+  }
+}
+
+inline const DVector4<TF64>::TValueType&
+DVector4<TF64, void>::operator[](TIndex index) const // NOLINT
+{
+  switch (index)
+  {
+  case 0: return this->X;
+  case 1: return this->Y;
+  case 2: return this->Z;
+  case 3: return this->W;
+  default:
+    M_ASSERT_OR_THROW(false, "index must be 0, 1, 2 and 3.");
+  }
+}
+
+inline DVector4<TF64>::TValueType*
+DVector4<TF64, void>::Data() noexcept
+{
+  return &this->X;
+}
+
+inline const DVector4<TF64>::TValueType*
+DVector4<TF64, void>::Data() const noexcept
+{
+  return &this->X;
+}
+
+inline TReal
+DVector4<TF64, void>::GetSquareLength() const noexcept
+{
+  return Cast<TReal>(details::SumLanesOf(_mm256_mul_pd(this->__GetSimd(), this->__GetSimd())));
+}
+
+inline TReal
+DVector4<TF64, void>::GetLength() const noexcept
+{
+  return std::sqrt(this->GetSquareLength());
+}
+
+inline TReal
+DVector4<TF64, void>::GetHomogeneousLength() const noexcept
+{
+  // (X / W, Y / W, Z / W, 0) squared.
+  const auto divided = _mm256_div_pd(this->__GetSimd(), _mm256_permute4x64_pd(this->__GetSimd(), 0xFF));
+  const auto masked  = _mm256_blend_pd(divided, _mm256_setzero_pd(), 0b1000);
+  return std::sqrt(Cast<TReal>(details::SumLanesOf(_mm256_mul_pd(masked, masked))));
+}
+
+inline DVector4<TReal>
+DVector4<TF64, void>::Normalize() const noexcept
+{
+  const auto length = this->GetLength();
+#ifdef MATH_USE_REAL_AS_DOUBLE
+  return DVector4<TReal>{_mm256_div_pd(this->__GetSimd(), _mm256_set1_pd(length))};
+#else
+  // Values are divided as TReal (TF32), as scalar code does.
+  return DVector4<TReal>{_mm_div_ps(_mm256_cvtpd_ps(this->__GetSimd()), _mm_set_ps1(length))};
+#endif
+}
+
+inline bool
+DVector4<TF64, void>::HasNaN() const noexcept
+{
+  return _mm256_movemask_pd(_mm256_cmp_pd(this->__GetSimd(), this->__GetSimd(), _CMP_UNORD_Q)) != 0;
+}
+
+inline bool
+DVector4<TF64, void>::HasInfinity() const noexcept
+{
+  const auto absolute = _mm256_andnot_pd(_mm256_set1_pd(-0.0), this->__GetSimd());
+  return _mm256_movemask_pd(_mm256_cmp_pd(absolute, _mm256_set1_pd(kMaxValueOf<TF64>), _CMP_GT_OQ)) != 0;
+}
+
+inline bool
+DVector4<TF64, void>::HasOnlyNormal() const noexcept
+{
+  return std::isnormal(this->X) && std::isnormal(this->Y)
+      && std::isnormal(this->Z) && std::isnormal(this->W);
+}
+
+inline DVector4<TF64>&
+DVector4<TF64, void>::operator+=(const DVector4& value) noexcept
+{
+  this->__SetSimd(_mm256_add_pd(this->__GetSimd(), value.__GetSimd()));
+  return *this;
+}
+
+inline DVector4<TF64>&
+DVector4<TF64, void>::operator-=(const DVector4& value) noexcept
+{
+  this->__SetSimd(_mm256_sub_pd(this->__GetSimd(), value.__GetSimd()));
+  return *this;
+}
+
+inline DVector4<TF64>&
+DVector4<TF64, void>::operator*=(TValueType value) noexcept
+{
+  this->__SetSimd(_mm256_mul_pd(this->__GetSimd(), _mm256_set1_pd(value)));
+  return *this;
+}
+
+inline DVector4<TF64>&
+DVector4<TF64, void>::operator*=(const DVector4& value) noexcept
+{
+  this->__SetSimd(_mm256_mul_pd(this->__GetSimd(), value.__GetSimd()));
+  return *this;
+}
+
+inline DVector4<TF64>&
+DVector4<TF64, void>::operator/=(TValueType value) noexcept
+{
+  this->__SetSimd(_mm256_div_pd(this->__GetSimd(), _mm256_set1_pd(value)));
+  return *this;
+}
+
+inline DVector4<TF64>&
+DVector4<TF64, void>::operator/=(const DVector4& value) noexcept
+{
+  this->__SetSimd(_mm256_div_pd(this->__GetSimd(), value.__GetSimd()));
+  return *this;
+}
+
+} /// ::dy::math namespace
+#include "DVector4TF64Common.inl"
+#endif /// defined(MATH_ENABLE_SIMD) && defined(__AVX2__)
@@ -0,0 +1,76 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#if defined(MATH_ENABLE_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+
+namespace dy::math
+{
+
+inline DVector4<TF64>
+operator+(const DVector4<TF64>& lhs, const DVector4<TF64>& rhs) noexcept
+{
+  return {_mm256_add_pd(lhs.__GetSimd(), rhs.__GetSimd())};
+}
+
+inline DVector4<TF64>
+operator-(const DVector4<TF64>& lhs, const DVector4<TF64>& rhs) noexcept
+{
+  return {_mm256_sub_pd(lhs.__GetSimd(), rhs.__GetSimd())};
+}
+
+inline DVector4<TF64>
+operator*(const DVector4<TF64>& lhs, TF64 rhs) noexcept
+{
+  return {_mm256_mul_pd(lhs.__GetSimd(), _mm256_set1_pd(rhs))};
+}
+
+inline DVector4<TF64>
+operator*(TF64 lhs, const DVector4<TF64>& rhs) noexcept
+{
+  return rhs * lhs;
+}
+
+inline DVector4<TF64>
+operator*(const DVector4<TF64>& lhs, const DVector4<TF64>& rhs) noexcept
+{
+  return {_mm256_mul_pd(lhs.__GetSimd(), rhs.__GetSimd())};
+}
+
+inline DVector4<TF64>
+operator/(DVector4<TF64> lhs, TF64 rhs) noexcept
+{
+  return {_mm256_div_pd(lhs.__GetSimd(), _mm256_set1_pd(rhs))};
+}
+
+inline DVector4<TF64>
+operator/(TF64 lhs, const DVector4<TF64>& rhs) noexcept
+{
+  return {_mm256_div_pd(_mm256_set1_pd(lhs), rhs.__GetSimd())};
+}
+
+inline DVector4<TF64>
+operator/(DVector4<TF64> lhs, const DVector4<TF64>& rhs) noexcept
+{
+  return {_mm256_div_pd(lhs.__GetSimd(), rhs.__GetSimd())};
+}
+
+inline bool
+operator==(const DVector4<TF64>& lhs, const DVector4<TF64>& rhs) noexcept
+{
+  return _mm256_movemask_pd(_mm256_cmp_pd(lhs.__GetSimd(), rhs.__GetSimd(), _CMP_EQ_OQ)) == 0xF;
+}
+
+} /// ::dy::math namespace
+#endif /// defined(MATH_ENABLE_SIMD) && defined(__AVX2__)
@@ -23,11 +23,8 @@ template <>
 struct MATH_NODISCARD DVector4<TI32, void> final
 {
   using TValueType = TI32;
-  union
-  {
-    __m128i __mVal;
-    struct { TValueType X, Y, Z, W; };
-  };
+  alignas(16) TValueType X;
+  TValueType Y, Z, W;
 
   DVector4() = default;
   DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept;
@@ -36,6 +33,11 @@ struct MATH_NODISCARD DVector4<TI32, void> final
   DVector4(const DVector3<TValueType>& value, TValueType w = TValueType{}) noexcept;
   DVector4(__m128i __iSimd) noexcept;
 
+  /// @brief Load values into SIMD register.
+  __m128i __GetSimd() const noexcept;
+  /// @brief Store SIMD register into values.
+  void __SetSimd(__m128i __iSimd) noexcept;
+
   template <typename TAnotherType>
   explicit operator DVector4<TAnotherType>() const noexcept;
   /// @brief Narrow conversion.
@@ -89,26 +91,41 @@ DVector4<TI32, void>::operator DVector4<TAnotherType>() const noexcept
 
 inline DVector4<TI32, void>  // NOLINT
 ::DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept 
-  : __mVal{_mm_set_epi32(w, z, y, x)}
-{ }
+{
+  this->__SetSimd(_mm_set_epi32(w, z, y, x));
+}
 
 inline DVector4<TI32, void>::DVector4(TValueType value) noexcept  // NOLINT
-  : __mVal{_mm_set_epi32(value, value, value, value)}
-{ }
+{
+  this->__SetSimd(_mm_set_epi32(value, value, value, value));
+}
 
 inline DVector4<TI32, void> // NOLINT
 ::DVector4(const DVector2<TValueType>& value, TValueType z, TValueType w) noexcept
-  : __mVal{_mm_set_epi32(w, z, value.Y, value.X)}
-{ }
+{
+  this->__SetSimd(_mm_set_epi32(w, z, value.Y, value.X));
+}
 
 inline DVector4<TI32, void> // NOLINT
 ::DVector4(const DVector3<TValueType>& value, TValueType w) noexcept
-  : __mVal{_mm_set_epi32(w, value.Z, value.Y, value.X)}
-{ }
+{
+  this->__SetSimd(_mm_set_epi32(w, value.Z, value.Y, value.X));
+}
 
 inline DVector4<TI32, void>::DVector4(__m128i __iSimd) noexcept // NOLINT
-  : __mVal{__iSimd}
-{ }
+{
+  this->__SetSimd(__iSimd);
+}
+
+inline __m128i DVector4<TI32, void>::__GetSimd() const noexcept
+{
+  return _mm_load_si128(reinterpret_cast<const __m128i*>(&this->X));
+}
+
+inline void DVector4<TI32, void>::__SetSimd(__m128i __iSimd) noexcept
+{
+  _mm_store_si128(reinterpret_cast<__m128i*>(&this->X), __iSimd);
+}
 
 inline DVector4<TI32>::TValueType& 
 DVector4<TI32, void>::operator[](TIndex index) // NOLINT
@@ -150,61 +167,52 @@ DVector4<TI32, void>::Data() const noexcept
   return &this->X;
 }
 
-TReal DVector4<TI32, void>::GetSquareLength() const noexcept
+inline TReal DVector4<TI32, void>::GetSquareLength() const noexcept
 {
-  TReal value[4];
 #ifndef MATH_USE_REAL_AS_DOUBLE
-  const auto simd   = _mm_cvtepi32_ps(this->__mVal);  // Convert epi32 into ps (SSE2)
+  TReal value[4];
+  const auto simd   = _mm_cvtepi32_ps(this->__GetSimd());  // Convert epi32 into ps (SSE2)
   const auto result = _mm_dp_ps(simd, simd, 0xFF);    // Do dot product. (SSE4.1)
   _mm_store_ps(value, result);                        // Store float into values. (SSE)
   return value[3];
 #else
-  const auto simd   = _mm_cvtepi32_pd(this->__mVal);  // Convert epi32 into ps (SSE2)
-  const auto result = _mm_dp_pd(simd, simd, 0xFF);    // Do dot product. (SSE4.1)
-  _mm_store_pd(value, result);                        // Store float into values. (SSE)
-  return value[3];
+  // Calculate with TReal (TF64) precision, as scalar code does.
+  return static_cast<DVector4<TReal>>(*this).GetSquareLength();
 #endif
 }
 
-TReal DVector4<TI32, void>::GetHomogeneousLength() const noexcept
+inline TReal DVector4<TI32, void>::GetHomogeneousLength() const noexcept
 {
-  TReal value[4];
 #ifndef MATH_USE_REAL_AS_DOUBLE
+  TReal value[4];
   // Reset w using moving instrinct (SSE2) and convert epi32 into ps (SSE2)
-  const auto simd   = _mm_cvtepi32_ps(_mm_bslli_si128(this->__mVal, 4));  
+  const auto simd   = _mm_cvtepi32_ps(_mm_bslli_si128(this->__GetSimd(), 4));  
   // Do dot product. (SSE4.1) and sqrt to __m128 (SSE2)
   const auto result = _mm_sqrt_ps(_mm_dp_ps(simd, simd, 0xFF));    
   // Store float into values. (SSE)
   _mm_store_ps(value, result);                        
   return value[3];
 #else
-  // Reset w using moving instrinct (SSE2) and convert epi32 into ps (SSE2)
-  const auto simd = _mm_cvtepi32_pd(_mm_bslli_si128(this->__mVal, 4));    
-  // Do dot product. (SSE4.1) and sqrt to __m128d (SSE2)
-  const auto result = _mm_sqrt_pd(_mm_dp_pd(simd, simd, 0xFF));    
-  // Store float into values. (SSE)
-  _mm_store_pd(value, result);                        
-  return value[3];
+  // Calculate with TReal (TF64) precision. w is rejected as float path does.
+  return DVector3<TReal>{TReal(this->X), TReal(this->Y), TReal(this->Z)}.GetLength();
 #endif
 }
 
-TReal DVector4<TI32, void>::GetLength() const noexcept
+inline TReal DVector4<TI32, void>::GetLength() const noexcept
 {
   return std::sqrt(this->GetSquareLength());
 }
 
-DVector4<TReal> DVector4<TI32, void>::Normalize() const noexcept
+inline DVector4<TReal> DVector4<TI32, void>::Normalize() const noexcept
 {
 #ifndef MATH_USE_REAL_AS_DOUBLE
-  const auto simd   = _mm_cvtepi32_ps(this->__mVal);  // Convert epi32 into ps (SSE2)
+  const auto simd   = _mm_cvtepi32_ps(this->__GetSimd());  // Convert epi32 into ps (SSE2)
   // Do dot product. (SSE4.1) and sqrt (SSE2) to get length.
   const auto result = _mm_sqrt_ps(_mm_dp_ps(simd, simd, 0xFF));    
   return DVector4<TReal>{_mm_div_ps(simd, result)};
 #else
-  const auto simd   = _mm_cvtepi32_pd(this->__mVal);  // Convert epi32 into ps (SSE2)
-  // Do dot product. (SSE4.1) and sqrt (SSE2) to get length.
-  const auto result = _mm_sqrt_pd(_mm_dp_pd(simd, simd, 0xFF));    
-  return DVector4<TReal>{_mm_div_pd(simd, result)};
+  // Normalize with TReal (TF64) precision, as scalar code does.
+  return static_cast<DVector4<TReal>>(*this).Normalize();
 #endif
 }
 
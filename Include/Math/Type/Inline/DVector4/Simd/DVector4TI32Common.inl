@@ -21,49 +21,49 @@ namespace dy::math
 inline DVector4<TI32> 
 operator+(const DVector4<TI32>& lhs, const DVector4<TI32>& rhs) noexcept 
 {
-  return {_mm_add_epi32(lhs.__mVal, rhs.__mVal)};
+  return {_mm_add_epi32(lhs.__GetSimd(), rhs.__GetSimd())};
 }
 
 inline DVector4<TI32>
 operator-(const DVector4<TI32>& lhs, const DVector4<TI32>& rhs) noexcept 
 {
-  return {_mm_sub_epi32(lhs.__mVal, rhs.__mVal)};
+  return {_mm_sub_epi32(lhs.__GetSimd(), rhs.__GetSimd())};
 }
 
 inline bool 
 operator==(const DVector4<TI32>& lhs, const DVector4<TI32>& rhs) noexcept
 {
   // Do XOR and if not matched, neq has at least '1' value onto 128 bits.
-  const auto neq = _mm_xor_si128(lhs.__mVal, rhs.__mVal);
+  const auto neq = _mm_xor_si128(lhs.__GetSimd(), rhs.__GetSimd());
   return static_cast<bool>(_mm_test_all_zeros(neq, neq));
 }
 
 inline DVector4<TI32>& 
 DVector4<TI32>::operator+=(const DVector4<TI32>& value) noexcept
 {
-  this->__mVal = _mm_add_epi32(this->__mVal, value.__mVal);
+  this->__SetSimd(_mm_add_epi32(this->__GetSimd(), value.__GetSimd()));
   return *this;
 }
 
 inline DVector4<TI32>& 
 DVector4<TI32>::operator-=(const DVector4<TI32>& value) noexcept
 {
-  this->__mVal = _mm_sub_epi32(this->__mVal, value.__mVal);
+  this->__SetSimd(_mm_sub_epi32(this->__GetSimd(), value.__GetSimd()));
   return *this;
 }
 
 inline DVector4<TI32>& 
 DVector4<TI32>::operator*=(const DVector4<TI32>& value) noexcept
 {
-  this->__mVal = _mm_mul_epi32(this->__mVal, value.__mVal);
+  this->__SetSimd(_mm_mul_epi32(this->__GetSimd(), value.__GetSimd()));
   return *this;
 }
 
 inline DVector4<TI32>& 
 DVector4<TI32>::operator*=(TI32 value) noexcept
 {
-  // Mulitply but stores low-bit [31:0] into __mVal.
-  this->__mVal = _mm_mullo_epi32(this->__mVal, _mm_set_epi32(value, value, value, value));
+  // Mulitply but stores low-bit [31:0] into values.
+  this->__SetSimd(_mm_mullo_epi32(this->__GetSimd(), _mm_set_epi32(value, value, value, value)));
   return *this;
 }
 
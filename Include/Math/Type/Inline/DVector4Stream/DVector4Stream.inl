@@ -0,0 +1,183 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cassert>
+#include <type_traits>
+
+#ifdef MATH_ENABLE_SIMD
+#include <emmintrin.h>
+#include <smmintrin.h>
+#endif
+
+namespace dy::math
+{
+
+template <typename TType>
+DVector4Stream<TType>::DVector4Stream(TIndex size)
+{
+  this->resize(size);
+}
+
+template <typename TType>
+DVector4Stream<TType>::DVector4Stream(const DVector4<TValueType>* iValues, TIndex count)
+{
+  this->Gather(iValues, count);
+}
+
+template <typename TType>
+TIndex DVector4Stream<TType>::size() const noexcept
+{
+  return this->__mPlanes[0].size();
+}
+
+template <typename TType>
+bool DVector4Stream<TType>::empty() const noexcept
+{
+  return this->__mPlanes[0].empty();
+}
+
+template <typename TType>
+void DVector4Stream<TType>::resize(TIndex size)
+{
+  for (auto& plane : this->__mPlanes) { plane.resize(size); }
+}
+
+template <typename TType>
+void DVector4Stream<TType>::reserve(TIndex capacity)
+{
+  for (auto& plane : this->__mPlanes) { plane.reserve(capacity); }
+}
+
+template <typename TType>
+void DVector4Stream<TType>::clear() noexcept
+{
+  for (auto& plane : this->__mPlanes) { plane.clear(); }
+}
+
+template <typename TType>
+void DVector4Stream<TType>::push_back(const DVector4<TValueType>& value)
+{
+  this->__mPlanes[0].push_back(value.X);
+  this->__mPlanes[1].push_back(value.Y);
+  this->__mPlanes[2].push_back(value.Z);
+  this->__mPlanes[3].push_back(value.W);
+}
+
+template <typename TType>
+DVector4<TType> DVector4Stream<TType>::Get(TIndex index) const noexcept
+{
+  assert(index < this->size());
+  return
+  {
+    this->__mPlanes[0][index], this->__mPlanes[1][index],
+    this->__mPlanes[2][index], this->__mPlanes[3][index]
+  };
+}
+
+template <typename TType>
+void DVector4Stream<TType>::Set(TIndex index, const DVector4<TValueType>& value) noexcept
+{
+  assert(index < this->size());
+  this->__mPlanes[0][index] = value.X;
+  this->__mPlanes[1][index] = value.Y;
+  this->__mPlanes[2][index] = value.Z;
+  this->__mPlanes[3][index] = value.W;
+}
+
+template <typename TType>
+TType* DVector4Stream<TType>::GetPlane(TIndex axis) noexcept
+{
+  return this->__mPlanes[axis].data();
+}
+
+template <typename TType>
+const TType* DVector4Stream<TType>::GetPlane(TIndex axis) const noexcept
+{
+  return this->__mPlanes[axis].data();
+}
+
+template <typename TType>
+void DVector4Stream<TType>::Gather(const DVector4<TValueType>* iValues, TIndex count)
+{
+  this->resize(count);
+  TType* x = this->GetPlane(0);
+  TType* y = this->GetPlane(1);
+  TType* z = this->GetPlane(2);
+  TType* w = this->GetPlane(3);
+
+  TIndex i = 0;
+#ifdef MATH_ENABLE_SIMD
+  if constexpr (std::is_same_v<TType, TF32>)
+  {
+    // Load 4 vectors and transpose them to planes.
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 v0 = _mm_loadu_ps(iValues[i + 0].Data());
+      __m128 v1 = _mm_loadu_ps(iValues[i + 1].Data());
+      __m128 v2 = _mm_loadu_ps(iValues[i + 2].Data());
+      __m128 v3 = _mm_loadu_ps(iValues[i + 3].Data());
+      _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+      _mm_store_ps(x + i, v0);
+      _mm_store_ps(y + i, v1);
+      _mm_store_ps(z + i, v2);
+      _mm_store_ps(w + i, v3);
+    }
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    x[i] = iValues[i].X;
+    y[i] = iValues[i].Y;
+    z[i] = iValues[i].Z;
+    w[i] = iValues[i].W;
+  }
+}
+
+template <typename TType>
+void DVector4Stream<TType>::Scatter(DVector4<TValueType>* oValues) const noexcept
+{
+  const TIndex count = this->size();
+  const TType* x = this->GetPlane(0);
+  const TType* y = this->GetPlane(1);
+  const TType* z = this->GetPlane(2);
+  const TType* w = this->GetPlane(3);
+
+  TIndex i = 0;
+#ifdef MATH_ENABLE_SIMD
+  if constexpr (std::is_same_v<TType, TF32>)
+  {
+    // Transpose 4 vectors of planes and store them.
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 v0 = _mm_load_ps(x + i);
+      __m128 v1 = _mm_load_ps(y + i);
+      __m128 v2 = _mm_load_ps(z + i);
+      __m128 v3 = _mm_load_ps(w + i);
+      _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+      _mm_storeu_ps(oValues[i + 0].Data(), v0);
+      _mm_storeu_ps(oValues[i + 1].Data(), v1);
+      _mm_storeu_ps(oValues[i + 2].Data(), v2);
+      _mm_storeu_ps(oValues[i + 3].Data(), v3);
+    }
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    oValues[i] = {x[i], y[i], z[i], w[i]};
+  }
+}
+
+} /// ::dy::math namespace
@@ -0,0 +1,187 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <Math/Type/Micellanous/DRandomEngine.h>
+#include <Math/Utility/XLowDiscrepancy.h>
+
+namespace dy::math::details
+{
+
+/// @brief Add (or remove) gaussian energy of pixel into energy of all pixels, with wrapped distance.
+/// `kernel` has gaussian of each offset of tile.
+inline void AddBlueNoiseEnergyOf(
+  std::vector<TF64>& ioEnergy, const std::vector<TF64>& kernel, TIndex size, TIndex pixel, TF64 sign) noexcept
+{
+  const TIndex pixelX = pixel % size;
+  const TIndex pixelY = pixel / size;
+  for (TIndex y = 0; y < size; ++y)
+  {
+    const TIndex offsetY = y >= pixelY ? y - pixelY : y + size - pixelY;
+    const TF64* kernelRow = kernel.data() + offsetY * size;
+    TF64* energyRow = ioEnergy.data() + y * size;
+    // Offset of x is `x - pixelX` wrapped, so row is processed in two ranges without modulo.
+    for (TIndex x = 0; x < pixelX; ++x) { energyRow[x] += sign * kernelRow[x + size - pixelX]; }
+    for (TIndex x = pixelX; x < size; ++x) { energyRow[x] += sign * kernelRow[x - pixelX]; }
+  }
+}
+
+/// @brief Find pixel which has the highest (tightest cluster) or lowest (largest void) energy
+/// among pixels which have given value.
+inline TIndex FindBlueNoisePixelOf(
+  const std::vector<TF64>& energy, const std::vector<TU8>& pattern, TU8 value, bool isHighest) noexcept
+{
+  TIndex result = 0;
+  TF64 best = isHighest == true ? -std::numeric_limits<TF64>::infinity() : std::numeric_limits<TF64>::infinity();
+  for (TIndex i = 0, count = static_cast<TIndex>(energy.size()); i < count; ++i)
+  {
+    if (pattern[i] != value) { continue; }
+    if (isHighest == true ? energy[i] > best : energy[i] < best)
+    {
+      best = energy[i];
+      result = i;
+    }
+  }
+  return result;
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+inline DBlueNoiseTile::DBlueNoiseTile(TIndex size, TU64 seed, TReal sigma)
+{
+  this->Generate(size, seed, sigma);
+}
+
+inline void DBlueNoiseTile::Generate(TIndex size, TU64 seed, TReal sigma)
+{
+  assert(size > 0 && size <= 4096);
+  assert(sigma > TReal(0));
+  const TIndex count = size * size;
+  this->mSize = size;
+  this->mRanks.assign(count, 0);
+
+  std::vector<TF64> kernel(count);
+  const TF64 scale = -1.0 / (2.0 * sigma * sigma);
+  for (TIndex y = 0; y < size; ++y)
+  {
+    for (TIndex x = 0; x < size; ++x)
+    {
+      const auto distanceX = static_cast<TF64>(std::min(x, size - x));
+      const auto distanceY = static_cast<TF64>(std::min(y, size - y));
+      kernel[y * size + x] = std::exp((distanceX * distanceX + distanceY * distanceY) * scale);
+    }
+  }
+
+  // Initial binary pattern. About 10% of pixels are set randomly,
+  // and moved from the tightest cluster into the largest void until it is stable.
+  std::vector<TU8> pattern(count, 0);
+  std::vector<TF64> energy(count, 0);
+  const TIndex initialCount = std::max<TIndex>(1, count / 10);
+  DSplitMix64 engine{seed};
+  for (TIndex placed = 0; placed < initialCount;)
+  {
+    const auto pixel = static_cast<TIndex>(((engine() >> 32) * static_cast<TU64>(count)) >> 32);
+    if (pattern[pixel] == 1) { continue; }
+    pattern[pixel] = 1;
+    details::AddBlueNoiseEnergyOf(energy, kernel, size, pixel, 1);
+    ++placed;
+  }
+
+  for (TIndex iteration = 0; iteration < count; ++iteration)
+  {
+    const TIndex cluster = details::FindBlueNoisePixelOf(energy, pattern, 1, true);
+    pattern[cluster] = 0;
+    details::AddBlueNoiseEnergyOf(energy, kernel, size, cluster, -1);
+
+    const TIndex largestVoid = details::FindBlueNoisePixelOf(energy, pattern, 0, false);
+    pattern[largestVoid] = 1;
+    details::AddBlueNoiseEnergyOf(energy, kernel, size, largestVoid, 1);
+    if (largestVoid == cluster) { break; }
+  }
+
+  // Ranks lower than initial pattern are got by removing the tightest cluster.
+  {
+    auto phasePattern = pattern;
+    auto phaseEnergy = energy;
+    for (TIndex rank = initialCount; rank-- > 0;)
+    {
+      const TIndex cluster = details::FindBlueNoisePixelOf(phaseEnergy, phasePattern, 1, true);
+      phasePattern[cluster] = 0;
+      details::AddBlueNoiseEnergyOf(phaseEnergy, kernel, size, cluster, -1);
+      this->mRanks[cluster] = static_cast<TU32>(rank);
+    }
+  }
+
+  // Higher ranks are got by filling the largest void. When more than half are set, this is same to
+  // removing the tightest cluster of unset pixels, because energy of all pixels is constant.
+  for (TIndex rank = initialCount; rank < count; ++rank)
+  {
+    const TIndex largestVoid = details::FindBlueNoisePixelOf(energy, pattern, 0, false);
+    pattern[largestVoid] = 1;
+    details::AddBlueNoiseEnergyOf(energy, kernel, size, largestVoid, 1);
+    this->mRanks[largestVoid] = static_cast<TU32>(rank);
+  }
+}
+
+inline TIndex DBlueNoiseTile::GetSize() const noexcept
+{
+  return this->mSize;
+}
+
+inline TU32 DBlueNoiseTile::GetRankOf(TU32 x, TU32 y) const noexcept
+{
+  assert(this->mSize > 0);
+  const auto size = static_cast<TU32>(this->mSize);
+  return this->mRanks[(y % size) * size + (x % size)];
+}
+
+inline TU32 DBlueNoiseTile::pGetRankBitsOf(TU32 x, TU32 y, TU32 dim) const noexcept
+{
+  // Tile of each dimension is shifted by R2 point of dimension, which is far from shifts of near dimensions.
+  const auto size = static_cast<TU64>(this->mSize);
+  const auto shiftX = static_cast<TU32>(((dim * details::kRdAlphas<2>[0]) >> 32) * size >> 32);
+  const auto shiftY = static_cast<TU32>(((dim * details::kRdAlphas<2>[1]) >> 32) * size >> 32);
+  const TU64 rank = this->GetRankOf(x + shiftX, y + shiftY);
+  return static_cast<TU32>(((2 * rank + 1) << 31) / (size * size));
+}
+
+template <typename TType, typename>
+TType DBlueNoiseTile::Sample(TU32 x, TU32 y, TU32 index, TU32 dim) const noexcept
+{
+  constexpr TU32 kGoldenRatio = 0x9E3779B9u;
+  return details::GetRealOfFixed32<TType>(this->pGetRankBitsOf(x, y, dim) + index * kGoldenRatio);
+}
+
+template <typename TType, typename>
+DVector2<TType> DBlueNoiseTile::GetVector2(TU32 x, TU32 y, TU32 index, TU32 dim) const noexcept
+{
+  return {this->Sample<TType>(x, y, index, dim), this->Sample<TType>(x, y, index, dim + 1)};
+}
+
+template <typename TType, typename>
+DVector3<TType> DBlueNoiseTile::GetVector3(TU32 x, TU32 y, TU32 index, TU32 dim) const noexcept
+{
+  return {
+    this->Sample<TType>(x, y, index, dim), 
+    this->Sample<TType>(x, y, index, dim + 1), 
+    this->Sample<TType>(x, y, index, dim + 2)};
+}
+
+} /// ::dy::math namespace
@@ -0,0 +1,351 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <atomic>
+#include <chrono>
+#include <random>
+
+namespace dy::math::details
+{
+
+/// @brief Advance SplitMix64 state and get next mixed value.
+/// @reference http://prng.di.unimi.it/splitmix64.c
+constexpr TU64 GetNextSplitMix64Of(TU64& ioState) noexcept
+{
+  ioState += 0x9E3779B97F4A7C15ull;
+  TU64 value = ioState;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+  return value ^ (value >> 31);
+}
+
+/// @struct DRandomSeedState
+/// @brief Global seed and the sequence number of next default constructed engine.
+struct DRandomSeedState final
+{
+  std::atomic<TU64> mSeed;
+  std::atomic<TU64> mSequence;
+};
+
+/// @brief Get default global seed from `std::random_device` and clock.
+inline TU64 GetEntropySeed()
+{
+  std::random_device device;
+  const auto clock = static_cast<TU64>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+  return ((TU64(device()) << 32) | device()) ^ clock;
+}
+
+inline DRandomSeedState& GetRandomSeedState()
+{
+  static DRandomSeedState state{{GetEntropySeed()}, {0}};
+  return state;
+}
+
+/// @brief Get seed of engine of given sequence number. Sequences of near numbers are decorrelated by SplitMix64.
+inline TU64 GetSequenceSeedOf(TU64 seed, TU64 sequence) noexcept
+{
+  TU64 state = seed ^ (sequence * 0xD1B54A32D192ED03ull);
+  return GetNextSplitMix64Of(state);
+}
+
+/// @brief Get seed of default constructed engine, from global seed and next sequence number.
+inline TU64 GetNextSequenceSeed()
+{
+  auto& state = GetRandomSeedState();
+  const auto sequence = state.mSequence.fetch_add(1, std::memory_order_relaxed);
+  return GetSequenceSeedOf(state.mSeed.load(std::memory_order_relaxed), sequence);
+}
+
+/// @brief Jump xoshiro256 engine with polynomial of jump. `ioState` is state of `engine`.
+/// @reference http://prng.di.unimi.it/xoshiro256starstar.c
+template <typename TEngine>
+void JumpXoshiro256Of(TEngine& engine, TU64 (&ioState)[4], const TU64 (&jump)[4]) noexcept
+{
+  TU64 result[4] = {};
+  for (const TU64 word : jump)
+  {
+    for (TU32 bit = 0; bit < 64; ++bit)
+    {
+      if (word & (TU64(1) << bit))
+      {
+        for (TIndex i = 0; i < 4; ++i) { result[i] ^= ioState[i]; }
+      }
+      engine();
+    }
+  }
+  for (TIndex i = 0; i < 4; ++i) { ioState[i] = result[i]; }
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+inline DSplitMix64::DSplitMix64(TU64 seed) noexcept
+{
+  this->Seed(seed);
+}
+
+inline void DSplitMix64::Seed(TU64 seed) noexcept
+{
+  this->mState = seed;
+}
+
+inline DSplitMix64::result_type DSplitMix64::operator()() noexcept
+{
+  return details::GetNextSplitMix64Of(this->mState);
+}
+
+inline DPcg32::DPcg32(TU64 seed, TU64 stream) noexcept
+{
+  this->Seed(seed, stream);
+}
+
+inline void DPcg32::Seed(TU64 seed, TU64 stream) noexcept
+{
+  this->mState = 0;
+  this->mIncrement = (stream << 1) | 1;
+  (*this)();
+  this->mState += seed;
+  (*this)();
+}
+
+inline void DPcg32::Discard(TU64 count) noexcept
+{
+  // Multiplier and increment of `count` steps of LCG, by squaring.
+  // @reference Brown, Random number generation with arbitrary strides (1994)
+  TU64 multiplier = 6364136223846793005ull;
+  TU64 increment = this->mIncrement;
+  TU64 accumulatedMultiplier = 1;
+  TU64 accumulatedIncrement = 0;
+  for (; count != 0; count >>= 1)
+  {
+    if (count & 1)
+    {
+      accumulatedMultiplier *= multiplier;
+      accumulatedIncrement = accumulatedIncrement * multiplier + increment;
+    }
+    increment = (multiplier + 1) * increment;
+    multiplier *= multiplier;
+  }
+  this->mState = accumulatedMultiplier * this->mState + accumulatedIncrement;
+}
+
+inline DPcg32::result_type DPcg32::operator()() noexcept
+{
+  const TU64 oldState = this->mState;
+  this->mState = oldState * 6364136223846793005ull + this->mIncrement;
+
+  const auto xorShifted = static_cast<TU32>(((oldState >> 18) ^ oldState) >> 27);
+  const auto rotation = static_cast<TU32>(oldState >> 59);
+  return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+}
+
+inline DXoshiro256StarStar::DXoshiro256StarStar(TU64 seed) noexcept
+{
+  this->Seed(seed);
+}
+
+inline void DXoshiro256StarStar::Seed(TU64 seed) noexcept
+{
+  // SplitMix64 does not make all zero state.
+  for (auto& state : this->mState) { state = details::GetNextSplitMix64Of(seed); }
+}
+
+inline DXoshiro256StarStar::result_type DXoshiro256StarStar::operator()() noexcept
+{
+  const auto rotate = [](TU64 value, int count) { return (value << count) | (value >> (64 - count)); };
+  auto& s = this->mState;
+
+  const TU64 result = rotate(s[1] * 5, 7) * 9;
+  const TU64 t = s[1] << 17;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = rotate(s[3], 45);
+  return result;
+}
+
+inline void DXoshiro256StarStar::Jump() noexcept
+{
+  constexpr TU64 kJump[4] = {0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull};
+  details::JumpXoshiro256Of(*this, this->mState, kJump);
+}
+
+inline void DXoshiro256StarStar::LongJump() noexcept
+{
+  constexpr TU64 kLongJump[4] = {0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBAA1Bull};
+  details::JumpXoshiro256Of(*this, this->mState, kLongJump);
+}
+
+inline DPhilox4x32::DPhilox4x32(TU64 seed, TU64 stream) noexcept
+{
+  this->Seed(seed, stream);
+}
+
+inline void DPhilox4x32::Seed(TU64 seed, TU64 stream) noexcept
+{
+  this->mSeed = seed;
+  this->mStream = stream;
+  this->SetPosition(0);
+}
+
+inline void DPhilox4x32::Discard(TU64 count) noexcept
+{
+  this->SetPosition(this->mPosition + count);
+}
+
+inline void DPhilox4x32::SetPosition(TU64 position) noexcept
+{
+  this->mPosition = position;
+  // Block is made when first value of block is used, so only block of middle position is made here.
+  if ((position & 3) != 0) { this->mBlock = GetBlockOf(this->mSeed, this->mStream, position >> 2); }
+}
+
+inline TU64 DPhilox4x32::GetPosition() const noexcept
+{
+  return this->mPosition;
+}
+
+inline DPhilox4x32::result_type DPhilox4x32::operator()() noexcept
+{
+  const auto index = static_cast<TIndex>(this->mPosition & 3);
+  if (index == 0) { this->mBlock = GetBlockOf(this->mSeed, this->mStream, this->mPosition >> 2); }
+  ++this->mPosition;
+  return this->mBlock[index];
+}
+
+inline DPhilox4x32::TBlock DPhilox4x32::GetBlockOf(TU64 seed, TU64 stream, TU64 block) noexcept
+{
+  TBlock counter = {
+    static_cast<TU32>(block), static_cast<TU32>(block >> 32), 
+    static_cast<TU32>(stream), static_cast<TU32>(stream >> 32)};
+  TU32 key[2] = {static_cast<TU32>(seed), static_cast<TU32>(seed >> 32)};
+  for (TIndex round = 0; round < 10; ++round)
+  {
+    const TU64 product0 = TU64(0xD2511F53u) * counter[0];
+    const TU64 product1 = TU64(0xCD9E8D57u) * counter[2];
+    counter = {
+      static_cast<TU32>(product1 >> 32) ^ counter[1] ^ key[0], static_cast<TU32>(product1),
+      static_cast<TU32>(product0 >> 32) ^ counter[3] ^ key[1], static_cast<TU32>(product0)};
+    key[0] += 0x9E3779B9u;
+    key[1] += 0xBB67AE85u;
+  }
+  return counter;
+}
+
+inline DRandomEngine::DRandomEngine()
+{
+  this->Seed(details::GetNextSequenceSeed());
+}
+
+inline DRandomEngine::DRandomEngine(TU64 seed) noexcept
+{
+  this->Seed(seed);
+}
+
+inline DRandomEngine::DRandomEngine(TU64 seed, TU64 stream) noexcept
+{
+  this->Seed(details::GetSequenceSeedOf(seed, stream));
+}
+
+inline void DRandomEngine::Seed(TU64 seed) noexcept
+{
+  this->mGenerator.Seed(seed);
+}
+
+inline DRandomEngine::result_type DRandomEngine::operator()() noexcept
+{
+  return this->mGenerator();
+}
+
+inline DRandomLaneEngine::DRandomLaneEngine()
+{
+  this->Seed(details::GetNextSequenceSeed());
+}
+
+inline DRandomLaneEngine::DRandomLaneEngine(TU64 seed) noexcept
+{
+  this->Seed(seed);
+}
+
+inline DRandomLaneEngine::DRandomLaneEngine(TU64 seed, TU64 stream) noexcept
+{
+  this->Seed(details::GetSequenceSeedOf(seed, stream));
+}
+
+inline void DRandomLaneEngine::Seed(TU64 seed) noexcept
+{
+  for (TIndex lane = 0; lane < kLanes; ++lane)
+  {
+    for (TIndex i = 0; i < 4; i += 2)
+    {
+      const auto value = details::GetNextSplitMix64Of(seed);
+      this->mStates[i][lane] = static_cast<TU32>(value);
+      this->mStates[i + 1][lane] = static_cast<TU32>(value >> 32);
+    }
+  }
+}
+
+inline void DRandomLaneEngine::Next(TU32* oBits) noexcept
+{
+  auto& s = this->mStates;
+  for (TIndex lane = 0; lane < kLanes; ++lane)
+  {
+    // `x * 5` and `x * 9` are written as shifts, because SSE2 does not have 32-bit multiplication.
+    const TU32 x = (s[1][lane] << 2) + s[1][lane];
+    const TU32 rotated = (x << 7) | (x >> 25);
+    oBits[lane] = (rotated << 3) + rotated;
+
+    const TU32 t = s[1][lane] << 9;
+    s[2][lane] ^= s[0][lane];
+    s[3][lane] ^= s[1][lane];
+    s[1][lane] ^= s[2][lane];
+    s[0][lane] ^= s[3][lane];
+    s[2][lane] ^= t;
+    s[3][lane] = (s[3][lane] << 11) | (s[3][lane] >> 21);
+  }
+}
+
+inline void SetRandomSeed(TU64 seed) noexcept
+{
+  auto& engine = GetThreadRandomEngine();
+  auto& laneEngine = GetThreadRandomLaneEngine();
+  auto& state = details::GetRandomSeedState();
+  state.mSeed.store(seed, std::memory_order_relaxed);
+  state.mSequence.store(2, std::memory_order_relaxed);
+  engine.Seed(details::GetSequenceSeedOf(seed, 0));
+  laneEngine.Seed(details::GetSequenceSeedOf(seed, 1));
+}
+
+inline TU64 GetRandomSeed() noexcept
+{
+  return details::GetRandomSeedState().mSeed.load(std::memory_order_relaxed);
+}
+
+inline DRandomEngine& GetThreadRandomEngine() noexcept
+{
+  thread_local DRandomEngine engine;
+  return engine;
+}
+
+inline DRandomLaneEngine& GetThreadRandomLaneEngine() noexcept
+{
+  thread_local DRandomLaneEngine engine;
+  return engine;
+}
+
+} /// ::dy::math namespace
@@ -0,0 +1,165 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+
+#include <algorithm>
+#include <cassert>
+#include <Math/Type/Micellanous/DRootSet.h>
+
+namespace dy::math
+{
+
+template <typename TType, TIndex TCapacity>
+DRootSet<TType, TCapacity>::DRootSet(std::initializer_list<TValueType> list) noexcept
+{
+  for (const auto& value : list) { this->push_back(value); }
+}
+
+template <typename TType, TIndex TCapacity>
+template <TIndex TOtherCapacity>
+DRootSet<TType, TCapacity>::DRootSet(const DRootSet<TValueType, TOtherCapacity>& other) noexcept
+{
+  for (const auto& value : other) { this->push_back(value); }
+}
+
+template <typename TType, TIndex TCapacity>
+void DRootSet<TType, TCapacity>::push_back(TValueType value) noexcept
+{
+  assert(this->__mSize < TCapacity);
+  this->__mValues[this->__mSize] = value;
+  this->__mSize += 1;
+}
+
+template <typename TType, TIndex TCapacity>
+void DRootSet<TType, TCapacity>::emplace_back(TValueType value) noexcept
+{
+  this->push_back(value);
+}
+
+template <typename TType, TIndex TCapacity>
+void DRootSet<TType, TCapacity>::clear() noexcept
+{
+  this->__mSize = 0;
+}
+
+template <typename TType, TIndex TCapacity>
+typename DRootSet<TType, TCapacity>::iterator 
+DRootSet<TType, TCapacity>::erase(const_iterator first, const_iterator last) noexcept
+{
+  // Move [last, end()) to first, and shrink size.
+  auto* const dest = this->begin() + (first - this->cbegin());
+  auto* const newEnd = std::copy(last, this->cend(), dest);
+  this->__mSize = static_cast<TIndex>(newEnd - this->begin());
+  return dest;
+}
+
+template <typename TType, TIndex TCapacity>
+void DRootSet<TType, TCapacity>::Sort() noexcept
+{
+  for (TIndex i = 1; i < this->__mSize; ++i)
+  {
+    const auto value = this->__mValues[i];
+    TIndex j = i;
+    for (; j > 0 && value < this->__mValues[j - 1]; --j) { this->__mValues[j] = this->__mValues[j - 1]; }
+    this->__mValues[j] = value;
+  }
+}
+
+template <typename TType, TIndex TCapacity>
+TIndex DRootSet<TType, TCapacity>::size() const noexcept
+{
+  return this->__mSize;
+}
+
+template <typename TType, TIndex TCapacity>
+bool DRootSet<TType, TCapacity>::empty() const noexcept
+{
+  return this->__mSize == 0;
+}
+
+template <typename TType, TIndex TCapacity>
+TType& DRootSet<TType, TCapacity>::operator[](TIndex index) noexcept
+{
+  return this->__mValues[index];
+}
+
+template <typename TType, TIndex TCapacity>
+const TType& DRootSet<TType, TCapacity>::operator[](TIndex index) const noexcept
+{
+  return this->__mValues[index];
+}
+
+template <typename TType, TIndex TCapacity>
+const TType& DRootSet<TType, TCapacity>::front() const noexcept
+{
+  assert(this->__mSize > 0);
+  return this->__mValues[0];
+}
+
+template <typename TType, TIndex TCapacity>
+const TType& DRootSet<TType, TCapacity>::back() const noexcept
+{
+  assert(this->__mSize > 0);
+  return this->__mValues[this->__mSize - 1];
+}
+
+template <typename TType, TIndex TCapacity>
+TType* DRootSet<TType, TCapacity>::data() noexcept
+{
+  return this->__mValues.data();
+}
+
+template <typename TType, TIndex TCapacity>
+const TType* DRootSet<TType, TCapacity>::data() const noexcept
+{
+  return this->__mValues.data();
+}
+
+template <typename TType, TIndex TCapacity>
+typename DRootSet<TType, TCapacity>::iterator DRootSet<TType, TCapacity>::begin() noexcept
+{
+  return this->__mValues.data();
+}
+
+template <typename TType, TIndex TCapacity>
+typename DRootSet<TType, TCapacity>::iterator DRootSet<TType, TCapacity>::end() noexcept
+{
+  return this->__mValues.data() + this->__mSize;
+}
+
+template <typename TType, TIndex TCapacity>
+typename DRootSet<TType, TCapacity>::const_iterator DRootSet<TType, TCapacity>::begin() const noexcept
+{
+  return this->__mValues.data();
+}
+
+template <typename TType, TIndex TCapacity>
+typename DRootSet<TType, TCapacity>::const_iterator DRootSet<TType, TCapacity>::end() const noexcept
+{
+  return this->__mValues.data() + this->__mSize;
+}
+
+template <typename TType, TIndex TCapacity>
+typename DRootSet<TType, TCapacity>::const_iterator DRootSet<TType, TCapacity>::cbegin() const noexcept
+{
+  return this->begin();
+}
+
+template <typename TType, TIndex TCapacity>
+typename DRootSet<TType, TCapacity>::const_iterator DRootSet<TType, TCapacity>::cend() const noexcept
+{
+  return this->end();
+}
+
+} /// ::dy::math namespace
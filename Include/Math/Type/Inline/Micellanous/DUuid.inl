@@ -0,0 +1,86 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstring>
+
+namespace dy::math
+{
+
+inline DUuid::DUuid(const std::array<uint8_t, 16>& iBytes) noexcept
+{
+  std::memcpy(this->mValue, iBytes.data(), sizeof(this->mValue));
+}
+
+inline bool DUuid::HasValue() const noexcept
+{
+  return (this->pGetLow() | this->pGetHigh()) != 0;
+}
+
+inline DUuid::iterator DUuid::begin() noexcept
+{
+  return this->mValue;
+}
+
+inline DUuid::iterator DUuid::end() noexcept
+{
+  return this->mValue + sizeof(this->mValue);
+}
+
+inline DUuid::const_iterator DUuid::begin() const noexcept
+{
+  return this->mValue;
+}
+
+inline DUuid::const_iterator DUuid::end() const noexcept
+{
+  return this->mValue + sizeof(this->mValue);
+}
+
+inline uint64_t DUuid::pGetLow() const noexcept
+{
+  uint64_t result;
+  std::memcpy(&result, this->mValue, sizeof(result));
+  return result;
+}
+
+inline uint64_t DUuid::pGetHigh() const noexcept
+{
+  uint64_t result;
+  std::memcpy(&result, this->mValue + sizeof(result), sizeof(result));
+  return result;
+}
+
+inline bool operator==(const DUuid& lhs, const DUuid& rhs) noexcept
+{
+  // Compare two 8 bytes without branch of each byte.
+  return ((lhs.pGetLow() ^ rhs.pGetLow()) | (lhs.pGetHigh() ^ rhs.pGetHigh())) == 0;
+}
+
+inline bool operator!=(const DUuid& lhs, const DUuid& rhs) noexcept
+{
+  return (lhs == rhs) == false;
+}
+
+} /// ::dy::math namespace
+
+inline std::hash<dy::math::DUuid>::result_type 
+std::hash<dy::math::DUuid>::operator()(const argument_type& s) const noexcept
+{
+  // Most bits of generated uuid are random, but uuids from other sources (e.g. sequential or time-based)
+  // are not, so mix both halves with finalizer of SplitMix64.
+  uint64_t value = s.pGetLow() ^ (s.pGetHigh() * 0x9E3779B97F4A7C15ull);
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+  return static_cast<result_type>(value ^ (value >> 31));
+}
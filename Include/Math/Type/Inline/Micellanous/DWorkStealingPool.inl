@@ -0,0 +1,112 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <thread>
+
+namespace dy::math
+{
+
+inline DWorkStealingPool::DWorkStealingPool(TIndex threadCount)
+{
+  if (threadCount == 0)
+  {
+    threadCount = std::max<TIndex>(std::thread::hardware_concurrency(), 1);
+  }
+
+  this->mQueues.reserve(threadCount);
+  for (TIndex i = 0; i < threadCount; ++i)
+  {
+    this->mQueues.emplace_back(std::make_unique<DQueue>());
+  }
+}
+
+inline TIndex DWorkStealingPool::GetThreadCount() const noexcept
+{
+  return this->mQueues.size();
+}
+
+inline void DWorkStealingPool::Run(TTask task)
+{
+  this->Push(0, std::move(task));
+
+  std::vector<std::thread> threads;
+  threads.reserve(this->mQueues.size() - 1);
+  for (TIndex i = 1, size = this->mQueues.size(); i < size; ++i)
+  {
+    threads.emplace_back([this, i]() { this->pWork(i); });
+  }
+
+  this->pWork(0);
+  for (auto& thread : threads) { thread.join(); }
+}
+
+inline void DWorkStealingPool::Push(TIndex workerIndex, TTask task)
+{
+  auto& queue = *this->mQueues[workerIndex];
+  this->mPendingCount.fetch_add(1, std::memory_order_relaxed);
+
+  std::lock_guard<std::mutex> lock{queue.mMutex};
+  queue.mTasks.emplace_back(std::move(task));
+}
+
+inline bool DWorkStealingPool::pTryPop(TIndex workerIndex, TTask& oTask)
+{
+  auto& queue = *this->mQueues[workerIndex];
+
+  std::lock_guard<std::mutex> lock{queue.mMutex};
+  if (queue.mTasks.empty() == true) { return false; }
+
+  oTask = std::move(queue.mTasks.back());
+  queue.mTasks.pop_back();
+  return true;
+}
+
+inline bool DWorkStealingPool::pTrySteal(TIndex workerIndex, TTask& oTask)
+{
+  const auto size = this->mQueues.size();
+  for (TIndex offset = 1; offset < size; ++offset)
+  {
+    auto& queue = *this->mQueues[(workerIndex + offset) % size];
+
+    std::unique_lock<std::mutex> lock{queue.mMutex, std::try_to_lock};
+    if (lock.owns_lock() == false || queue.mTasks.empty() == true) { continue; }
+
+    oTask = std::move(queue.mTasks.front());
+    queue.mTasks.pop_front();
+    return true;
+  }
+
+  return false;
+}
+
+inline void DWorkStealingPool::pWork(TIndex workerIndex)
+{
+  TTask task;
+  while (this->mPendingCount.load(std::memory_order_acquire) > 0)
+  {
+    if (this->pTryPop(workerIndex, task) == true || this->pTrySteal(workerIndex, task) == true)
+    {
+      task(workerIndex);
+      task = nullptr;
+      // Decrease after running, so tasks pushed by this task are counted before.
+      this->mPendingCount.fetch_sub(1, std::memory_order_acq_rel);
+      continue;
+    }
+
+    std::this_thread::yield();
+  }
+}
+
+} /// ::dy::math namespace
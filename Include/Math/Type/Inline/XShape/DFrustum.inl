@@ -0,0 +1,288 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <Math/Common/XSimdDispatch.h>
+#include <Math/Utility/XTransformMath.h>
+
+MATH_SIMD_KERNEL_REGION_BEGIN
+
+namespace dy::math::details
+{
+
+/// @brief Volume of frustum test. Bounds and box use `mExtent` as half length of each axis,
+/// and sphere uses `mExtent.X` as radius.
+template <typename TType>
+struct DFrustumVolume final
+{
+  DVector3<TType> mCenter;
+  DVector3<TType> mExtent;
+};
+
+template <typename TType>
+DFrustumVolume<TType> GetFrustumVolumeOf(const DBounds3D<TType>& bounds) noexcept
+{
+  const auto& min = bounds.GetMin();
+  const auto& max = bounds.GetMax();
+  // Infinite bounds has infinite extent, so it is never culled.
+  return {(min + max) * TType(0.5), (max - min) * TType(0.5)};
+}
+
+template <typename TType>
+DFrustumVolume<TType> GetFrustumVolumeOf(const DSphere<TType>& sphere) noexcept
+{
+  return {sphere.GetOrigin(), DVector3<TType>{sphere.GetRadius(), 0, 0}};
+}
+
+template <typename TType>
+DFrustumVolume<TType> GetFrustumVolumeOf(const DBox<TType>& box) noexcept
+{
+  return GetFrustumVolumeOf(DBounds3D<TType>{box.GetMinPos(), box.GetMaxPos()});
+}
+
+/// @brief Write visibility bits of `count` volumes into `oMasks`. `isVisible(i)` tests i-th volume.
+template <typename TFunction>
+MATH_SIMD_INLINE inline void WriteVisibleMasksOf(TIndex count, TU32* oMasks, TFunction&& isVisible)
+{
+  for (TIndex base = 0; base < count; base += 32)
+  {
+    const TIndex end = std::min(count, base + 32);
+    TU32 mask = 0;
+    for (TIndex i = base; i < end; ++i)
+    {
+      if (isVisible(i) == true) { mask |= TU32(1) << (i - base); }
+    }
+    oMasks[base / 32] = mask;
+  }
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+template <typename TType>
+template <EMatMajor TMajor>
+DFrustum<TType>::DFrustum(const DMatrix4<TValueType, TMajor>& matrix, EGraphics graphics)
+{
+  // Clip position is `(r0 * v, r1 * v, r2 * v, r3 * v)`, and visible when `-w <= x <= w`...
+  const auto rows = details::GetRowsOf(matrix);
+  this->pSetPlane(EFrustumPlane::Left,   rows[3] + rows[0]);
+  this->pSetPlane(EFrustumPlane::Right,  rows[3] - rows[0]);
+  this->pSetPlane(EFrustumPlane::Bottom, rows[3] + rows[1]);
+  this->pSetPlane(EFrustumPlane::Top,    rows[3] - rows[1]);
+  // Near plane is `-w <= z` of OpenGL, and `0 <= z` of DirectX.
+  this->pSetPlane(EFrustumPlane::Near,   graphics == EGraphics::DirectX ? rows[2] : rows[3] + rows[2]);
+  this->pSetPlane(EFrustumPlane::Far,    rows[3] - rows[2]);
+}
+
+template <typename TType>
+void DFrustum<TType>::pSetPlane(EFrustumPlane plane, const DVector4<TValueType>& coefficients)
+{
+  const auto index = static_cast<TIndex>(plane);
+  this->mPlanes[index] = DPlane<TValueType>{coefficients.X, coefficients.Y, coefficients.Z, coefficients.W};
+
+  const auto normal = this->mPlanes[index].GetNormal();
+  this->mNormalX[index] = normal.X;
+  this->mNormalY[index] = normal.Y;
+  this->mNormalZ[index] = normal.Z;
+  this->mD[index] = this->mPlanes[index].GetD();
+}
+
+template <typename TType>
+const DPlane<typename DFrustum<TType>::TValueType>&
+DFrustum<TType>::GetPlane(EFrustumPlane plane) const noexcept
+{
+  return this->mPlanes[static_cast<TIndex>(plane)];
+}
+
+template <typename TType>
+const std::array<DPlane<typename DFrustum<TType>::TValueType>, DFrustum<TType>::kPlaneCount>&
+DFrustum<TType>::GetPlanes() const noexcept
+{
+  return this->mPlanes;
+}
+
+template <typename TType>
+bool DFrustum<TType>::IsVisible(const DVector3<TValueType>& point) const noexcept
+{
+  for (TIndex i = 0; i < kPlaneCount; ++i)
+  {
+    const auto distance = this->mNormalX[i] * point.X + this->mNormalY[i] * point.Y + this->mNormalZ[i] * point.Z + this->mD[i];
+    if (distance < 0) { return false; }
+  }
+  return true;
+}
+
+template <typename TType>
+bool DFrustum<TType>::IsVisible(const DBounds3D<TValueType>& bounds) const noexcept
+{
+  TU32 planeMask = kAllPlaneMask;
+  TU32 lastPlane = 0;
+  return this->Test(bounds, planeMask, lastPlane) != EFrustumTest::Outside;
+}
+
+template <typename TType>
+bool DFrustum<TType>::IsVisible(const DSphere<TValueType>& sphere) const noexcept
+{
+  TU32 planeMask = kAllPlaneMask;
+  TU32 lastPlane = 0;
+  return this->Test(sphere, planeMask, lastPlane) != EFrustumTest::Outside;
+}
+
+template <typename TType>
+bool DFrustum<TType>::IsVisible(const DBox<TValueType>& box) const noexcept
+{
+  return this->IsVisible(DBounds3D<TValueType>{box.GetMinPos(), box.GetMaxPos()});
+}
+
+template <typename TType>
+EFrustumTest DFrustum<TType>::Test(
+  const DBounds3D<TValueType>& bounds, TU32& ioPlaneMask, TU32& ioLastPlane) const noexcept
+{
+  const auto volume = details::GetFrustumVolumeOf(bounds);
+  const auto& c = volume.mCenter;
+  const auto& e = volume.mExtent;
+
+  // Returns true when volume is outside of plane `i`. Operation order is same to SIMD kernel.
+  const auto IsOutsideOf = [&](TIndex i)
+  {
+    const auto distance = this->mNormalX[i] * c.X + this->mNormalY[i] * c.Y + this->mNormalZ[i] * c.Z + this->mD[i];
+    const auto radius = std::abs(this->mNormalX[i]) * e.X + std::abs(this->mNormalY[i]) * e.Y + std::abs(this->mNormalZ[i]) * e.Z;
+    if (distance + radius < 0) { return true; }
+    if (distance - radius >= 0) { ioPlaneMask &= ~(TU32(1) << i); }
+    return false;
+  };
+
+  if (ioLastPlane < kPlaneCount && (ioPlaneMask & (TU32(1) << ioLastPlane)) != 0 && IsOutsideOf(ioLastPlane) == true)
+  {
+    return EFrustumTest::Outside;
+  }
+  for (TIndex i = 0; i < kPlaneCount; ++i)
+  {
+    if (i == ioLastPlane || (ioPlaneMask & (TU32(1) << i)) == 0) { continue; }
+    if (IsOutsideOf(i) == true)
+    {
+      ioLastPlane = static_cast<TU32>(i);
+      return EFrustumTest::Outside;
+    }
+  }
+  return ioPlaneMask == 0 ? EFrustumTest::Inside : EFrustumTest::Intersected;
+}
+
+template <typename TType>
+EFrustumTest DFrustum<TType>::Test(
+  const DSphere<TValueType>& sphere, TU32& ioPlaneMask, TU32& ioLastPlane) const noexcept
+{
+  const auto& c = sphere.GetOrigin();
+  const auto radius = sphere.GetRadius();
+
+  const auto IsOutsideOf = [&](TIndex i)
+  {
+    const auto distance = this->mNormalX[i] * c.X + this->mNormalY[i] * c.Y + this->mNormalZ[i] * c.Z + this->mD[i];
+    if (distance + radius < 0) { return true; }
+    if (distance - radius >= 0) { ioPlaneMask &= ~(TU32(1) << i); }
+    return false;
+  };
+
+  if (ioLastPlane < kPlaneCount && (ioPlaneMask & (TU32(1) << ioLastPlane)) != 0 && IsOutsideOf(ioLastPlane) == true)
+  {
+    return EFrustumTest::Outside;
+  }
+  for (TIndex i = 0; i < kPlaneCount; ++i)
+  {
+    if (i == ioLastPlane || (ioPlaneMask & (TU32(1) << i)) == 0) { continue; }
+    if (IsOutsideOf(i) == true)
+    {
+      ioLastPlane = static_cast<TU32>(i);
+      return EFrustumTest::Outside;
+    }
+  }
+  return ioPlaneMask == 0 ? EFrustumTest::Inside : EFrustumTest::Intersected;
+}
+
+template <typename TType>
+template <bool TIsSphere, typename TVolume>
+void DFrustum<TType>::pGetVisibleMasksOf(const TVolume* volumes, TIndex count, TU32* oMasks) const noexcept
+{
+#ifdef MATH_SIMD_KERNELS
+  if constexpr (std::is_same_v<TValueType, TF32> == true)
+  {
+    // Planes are tested at once with lanes. (SSE uses two registers)
+    const bool isDispatched = details::DispatchSimdF32<8>([&](auto simd) MATH_SIMD_INLINE
+    {
+      using S = decltype(simd);
+      constexpr TIndex kChunks = 8 / S::kLanes;
+      typename S::TReg nx[kChunks], ny[kChunks], nz[kChunks], d[kChunks];
+      for (TIndex k = 0; k < kChunks; ++k)
+      {
+        nx[k] = S::Load(this->mNormalX.data() + k * S::kLanes);
+        ny[k] = S::Load(this->mNormalY.data() + k * S::kLanes);
+        nz[k] = S::Load(this->mNormalZ.data() + k * S::kLanes);
+        d[k]  = S::Load(this->mD.data() + k * S::kLanes);
+      }
+      const auto zero = S::Set1(0.0f);
+
+      details::WriteVisibleMasksOf(count, oMasks, [&](TIndex i) MATH_SIMD_INLINE
+      {
+        const auto volume = details::GetFrustumVolumeOf(volumes[i]);
+        const auto cx = S::Set1(volume.mCenter.X);
+        const auto cy = S::Set1(volume.mCenter.Y);
+        const auto cz = S::Set1(volume.mCenter.Z);
+        TU32 outside = 0;
+        for (TIndex k = 0; k < kChunks; ++k)
+        {
+          const auto distance = S::Add(S::Add(S::Add(S::Mul(nx[k], cx), S::Mul(ny[k], cy)), S::Mul(nz[k], cz)), d[k]);
+          auto radius = S::Set1(volume.mExtent.X);
+          if constexpr (TIsSphere == false)
+          {
+            radius = S::Add(
+              S::Add(S::Mul(S::Abs(nx[k]), radius), S::Mul(S::Abs(ny[k]), S::Set1(volume.mExtent.Y))),
+              S::Mul(S::Abs(nz[k]), S::Set1(volume.mExtent.Z)));
+          }
+          outside |= S::MoveMask(S::CmpLt(S::Add(distance, radius), zero));
+        }
+        return outside == 0;
+      });
+    });
+    if (isDispatched == true) { return; }
+  }
+#endif
+
+  details::WriteVisibleMasksOf(count, oMasks, [this, volumes](TIndex i) { return this->IsVisible(volumes[i]); });
+}
+
+template <typename TType>
+void DFrustum<TType>::GetVisibleMasksOf(const DBounds3D<TValueType>* bounds, TIndex count, TU32* oMasks) const noexcept
+{
+  this->template pGetVisibleMasksOf<false>(bounds, count, oMasks);
+}
+
+template <typename TType>
+void DFrustum<TType>::GetVisibleMasksOf(const DSphere<TValueType>* spheres, TIndex count, TU32* oMasks) const noexcept
+{
+  this->template pGetVisibleMasksOf<true>(spheres, count, oMasks);
+}
+
+template <typename TType>
+void DFrustum<TType>::GetVisibleMasksOf(const DBox<TValueType>* boxes, TIndex count, TU32* oMasks) const noexcept
+{
+  this->template pGetVisibleMasksOf<false>(boxes, count, oMasks);
+}
+
+} /// ::dy::math namespace
+
+MATH_SIMD_KERNEL_REGION_END
@@ -0,0 +1,110 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <array>
+#include <Math/Type/Math/DVector3.h>
+#include <Math/Type/Math/DVector4.h>
+#include <Math/Type/Math/DMatrix3.h>
+#include <Math/Type/Math/DMatrix4.h>
+#include <Math/Common/TGlobalTypes.h>
+
+namespace dy::math
+{
+
+/// @class DAffineMatrix4
+/// @brief Affine transform matrix type, which is 4x4 matrix with implicit last row `(0, 0, 0, 1)`.
+/// Only upper 3x4 rows (3x3 rotation-scale block and translation column) are stored,
+/// so inverse and composition skip the general 4x4 cofactor expansion.
+/// Matrix type only support Real type.
+template <typename TType>
+struct MATH_NODISCARD DAffineMatrix4 final
+{
+private:
+  static_assert(
+    kCategoryOf<TType> == EValueCategory::Real,
+    "Failed to make DAffineMatrix4, DAffineMatrix4 only supports Real type.");
+
+public:
+  using TValueType = TType;
+  DAffineMatrix4() = default;
+
+  DAffineMatrix4(
+    TValueType _00, TValueType _01, TValueType _02, TValueType _03,
+    TValueType _10, TValueType _11, TValueType _12, TValueType _13,
+    TValueType _20, TValueType _21, TValueType _22, TValueType _23);
+  DAffineMatrix4(
+    const DVector4<TValueType>& row0,
+    const DVector4<TValueType>& row1,
+    const DVector4<TValueType>& row2);
+  /// @brief Create affine matrix from rotation-scale block and translation.
+  template <EMatMajor TMajor>
+  DAffineMatrix4(const DMatrix3<TValueType, TMajor>& linear, const DVector3<TValueType>& translation);
+  /// @brief Create affine matrix from upper 3x4 rows of matrix.
+  /// Last row of matrix is not checked, and regarded as `(0, 0, 0, 1)`.
+  template <EMatMajor TMajor>
+  explicit DAffineMatrix4(const DMatrix4<TValueType, TMajor>& matrix);
+
+  /// @brief Get row of matrix. index must be 0, 1 or 2.
+  DVector4<TValueType>& operator[](TIndex index) noexcept;
+  /// @brief Get row of matrix. index must be 0, 1 or 2.
+  const DVector4<TValueType>& operator[](TIndex index) const noexcept;
+
+  /// @brief Get inverse matrix of this matrix.
+  /// This inverses 3x3 block and translation only, and does not check determinant is 0 or not.
+  DAffineMatrix4 Inverse() const;
+
+  /// @brief Check this matrix can be inversed.
+  bool IsInvertible() const noexcept;
+  /// @brief Get determinant of matrix, which is same to determinant of 3x3 block.
+  TValueType GetDeterminant() const noexcept;
+
+  /// @brief Get translation of matrix.
+  DVector3<TValueType> GetTranslation() const noexcept;
+  /// @brief Transform position, applying translation.
+  DVector3<TValueType> TransformPoint(const DVector3<TValueType>& point) const noexcept;
+  /// @brief Transform direction, not applying translation.
+  DVector3<TValueType> TransformDirection(const DVector3<TValueType>& direction) const noexcept;
+
+  /// @brief Convert to 4x4 matrix with given major.
+  template <EMatMajor TMajor>
+  DMatrix4<TValueType, TMajor> ToMatrix4() const noexcept;
+
+  /// @brief Get identity matrix.
+  static DAffineMatrix4 Identity() noexcept;
+
+  /// Upper 3 rows of matrix.
+  std::array<DVector4<TValueType>, 3> __mValues;
+};
+
+/// @brief Get inverse matrix of affine 4x4 matrix, using 3x3 block and translation only.
+/// Last row of matrix is not checked, and regarded as `(0, 0, 0, 1)`.
+template <typename TType, EMatMajor TMajor>
+DMatrix4<TType, TMajor> InverseAffine(const DMatrix4<TType, TMajor>& matrix);
+
+/// @brief Multiply two affine 4x4 matrices `lhs * rhs` without the 4th row.
+/// Last rows of matrices are not checked, and regarded as `(0, 0, 0, 1)`.
+template <typename TType, EMatMajor TMajor>
+DMatrix4<TType, TMajor> MultiplyAffine(const DMatrix4<TType, TMajor>& lhs, const DMatrix4<TType, TMajor>& rhs) noexcept;
+
+} /// ::dy::math namespace
+
+namespace dy::math
+{
+
+static_assert(sizeof(DAffineMatrix4<TF32>) == 48);
+static_assert(sizeof(DAffineMatrix4<TF64>) == 96);
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/DAffineMatrix4/DAffineMatrix4Operator.inl>
+#include <Math/Type/Inline/DAffineMatrix4/DAffineMatrix4.inl>
@@ -43,22 +43,22 @@ public:
   using TValueType = TType;
   DMatrix2()  = default;
 
-  DMatrix2(TValueType _00, TValueType _01, TValueType _10, TValueType _11);
-  DMatrix2(const DVector2<TValueType>& _0, const DVector2<TValueType>& _1);
+  constexpr DMatrix2(TValueType _00, TValueType _01, TValueType _10, TValueType _11);
+  constexpr DMatrix2(const DVector2<TValueType>& _0, const DVector2<TValueType>& _1);
 
-  DVector2<TValueType>& operator[](TIndex index) noexcept;
-  const DVector2<TValueType>& operator[](TIndex index) const noexcept;
+  constexpr DVector2<TValueType>& operator[](TIndex index) noexcept;
+  constexpr const DVector2<TValueType>& operator[](TIndex index) const noexcept;
 
   /// @brief Transpose matrix.
-  DMatrix2 Transpose() const noexcept;
+  constexpr DMatrix2 Transpose() const noexcept;
   /// @brief Get inverse matrix of this matrix.
   /// This does not check determinant is 0 or not.
-  DMatrix2 Inverse() const;
+  constexpr DMatrix2 Inverse() const;
 
   /// @brief Check this matrix can be inversed.
-  bool IsInvertible() const noexcept;
+  constexpr bool IsInvertible() const noexcept;
   /// @brief Get determinant of matrix.
-  TValueType GetDeterminant() const noexcept;
+  constexpr TValueType GetDeterminant() const noexcept;
 
   /// @brief Check value has NaN.
   bool HasNaN() const noexcept;
@@ -75,10 +75,10 @@ public:
   /// @brief Convert to vector that has values.
   std::vector<DVector2<TValueType>> ToVector() const noexcept;
   /// @brief Convert to Row Major Matrix.
-  DMatrix2<TType, EMatMajor::Row> ConvertToRowMatrix() const;
+  constexpr DMatrix2<TType, EMatMajor::Row> ConvertToRowMatrix() const;
   
   /// @brief Get identity matrix.
-  static DMatrix2 Identity() noexcept;
+  static constexpr DMatrix2 Identity() noexcept;
 
   /// Column major
   std::array<DVector2<TValueType>, 2> __mValues;
@@ -111,22 +111,22 @@ public:
   using TValueType = TType;
   DMatrix2()  = default;
 
-  DMatrix2(TValueType _00, TValueType _01, TValueType _10, TValueType _11);
-  DMatrix2(const DVector2<TValueType>& _0, const DVector2<TValueType>& _1);
+  constexpr DMatrix2(TValueType _00, TValueType _01, TValueType _10, TValueType _11);
+  constexpr DMatrix2(const DVector2<TValueType>& _0, const DVector2<TValueType>& _1);
 
-  DVector2<TValueType>& operator[](TIndex index) noexcept;
-  const DVector2<TValueType>& operator[](TIndex index) const noexcept;
+  constexpr DVector2<TValueType>& operator[](TIndex index) noexcept;
+  constexpr const DVector2<TValueType>& operator[](TIndex index) const noexcept;
 
   /// @brief Transpose matrix.
-  DMatrix2 Transpose() const noexcept;
+  constexpr DMatrix2 Transpose() const noexcept;
   /// @brief Get inverse matrix of this matrix.
   /// This does not check determinant is 0 or not.
-  DMatrix2 Inverse() const;
+  constexpr DMatrix2 Inverse() const;
 
   /// @brief Check this matrix can be inversed.
-  bool IsInvertible() const noexcept;
+  constexpr bool IsInvertible() const noexcept;
   /// @brief Get determinant of matrix.
-  TValueType GetDeterminant() const noexcept;
+  constexpr TValueType GetDeterminant() const noexcept;
 
   /// @brief Check value has NaN.
   bool HasNaN() const noexcept;
@@ -143,10 +143,10 @@ public:
   /// @brief Convert to vector that has values.
   std::vector<DVector2<TValueType>> ToVector() const noexcept;
   /// @brief Convert to Row Major Matrix.
-  DMatrix2<TType, EMatMajor::Column> ConvertToColumnMatrix() const;
+  constexpr DMatrix2<TType, EMatMajor::Column> ConvertToColumnMatrix() const;
 
   /// @brief Get identity matrix.
-  static DMatrix2 Identity() noexcept;
+  static constexpr DMatrix2 Identity() noexcept;
   
   /// Column major
   std::array<DVector2<TValueType>, 2> __mValues;
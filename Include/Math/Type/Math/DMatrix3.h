@@ -13,6 +13,7 @@
 ///
 
 #include <array>
+#include <vector>
 #include <Math/Type/Math/DVector3.h>
 #include <Math/Common/TGlobalTypes.h>
 #include <Math/Common/XRttrEntry.h>
@@ -43,28 +44,28 @@ public:
   using TValueType = TType;
   DMatrix3()  = default;
 
-  DMatrix3(
+  constexpr DMatrix3(
     TValueType _00, TValueType _01, TValueType _02, 
     TValueType _10, TValueType _11, TValueType _12, 
     TValueType _20, TValueType _21, TValueType _22);
-  DMatrix3(
+  constexpr DMatrix3(
     const DVector3<TValueType>& col0, 
     const DVector3<TValueType>& col1,
     const DVector3<TValueType>& col2);
 
-  DVector3<TValueType>& operator[](TIndex index) noexcept;
-  const DVector3<TValueType>& operator[](TIndex index) const noexcept;
+  constexpr DVector3<TValueType>& operator[](TIndex index) noexcept;
+  constexpr const DVector3<TValueType>& operator[](TIndex index) const noexcept;
 
   /// @brief Transpose matrix.
-  DMatrix3 Transpose() const noexcept;
+  constexpr DMatrix3 Transpose() const noexcept;
   /// @brief Get inverse matrix of this matrix.
   /// This does not check determinant is 0 or not.
-  DMatrix3 Inverse() const;
+  constexpr DMatrix3 Inverse() const;
 
   /// @brief Check this matrix can be inversed.
-  bool IsInvertible() const noexcept;
+  constexpr bool IsInvertible() const noexcept;
   /// @brief Get determinant of matrix.
-  TValueType GetDeterminant() const noexcept;
+  constexpr TValueType GetDeterminant() const noexcept;
 
   /// @brief Check value has NaN.
   bool HasNaN() const noexcept;
@@ -81,10 +82,10 @@ public:
   /// @brief Convert to vector that has values.
   std::vector<DVector3<TValueType>> ToVector() const noexcept;
   /// @brief Convert to Row Major Matrix.
-  DMatrix3<TType, EMatMajor::Row> ConvertToRowMatrix() const;
+  constexpr DMatrix3<TType, EMatMajor::Row> ConvertToRowMatrix() const;
 
   /// @brief Get identity matrix.
-  static DMatrix3 Identity() noexcept;
+  static constexpr DMatrix3 Identity() noexcept;
   
   /// Column major
   std::array<DVector3<TValueType>, 3> __mValues;
@@ -117,28 +118,28 @@ public:
   using TValueType = TType;
   DMatrix3()  = default;
 
-  DMatrix3(
+  constexpr DMatrix3(
     TValueType _00, TValueType _01, TValueType _02, 
     TValueType _10, TValueType _11, TValueType _12, 
     TValueType _20, TValueType _21, TValueType _22);
-  DMatrix3(
+  constexpr DMatrix3(
     const DVector3<TValueType>& col0, 
     const DVector3<TValueType>& col1,
     const DVector3<TValueType>& col2);
 
-  DVector3<TValueType>& operator[](TIndex index) noexcept;
-  const DVector3<TValueType>& operator[](TIndex index) const noexcept;
+  constexpr DVector3<TValueType>& operator[](TIndex index) noexcept;
+  constexpr const DVector3<TValueType>& operator[](TIndex index) const noexcept;
 
   /// @brief Transpose matrix.
-  DMatrix3 Transpose() const noexcept;
+  constexpr DMatrix3 Transpose() const noexcept;
   /// @brief Get inverse matrix of this matrix.
   /// This does not check determinant is 0 or not.
-  DMatrix3 Inverse() const;
+  constexpr DMatrix3 Inverse() const;
 
   /// @brief Check this matrix can be inversed.
-  bool IsInvertible() const noexcept;
+  constexpr bool IsInvertible() const noexcept;
   /// @brief Get determinant of matrix.
-  TValueType GetDeterminant() const noexcept;
+  constexpr TValueType GetDeterminant() const noexcept;
 
   /// @brief Check value has NaN.
   bool HasNaN() const noexcept;
@@ -155,10 +156,10 @@ public:
   /// @brief Convert to vector that has values.
   std::vector<DVector3<TValueType>> ToVector() const noexcept;
   /// @brief Convert to Row Major Matrix.
-  DMatrix3<TType, EMatMajor::Column> ConvertToColumnMatrix() const;
+  constexpr DMatrix3<TType, EMatMajor::Column> ConvertToColumnMatrix() const;
 
   /// @brief Get identity matrix.
-  static DMatrix3 Identity() noexcept;
+  static constexpr DMatrix3 Identity() noexcept;
   
   /// Row major
   std::array<DVector3<TValueType>, 3> __mValues;
@@ -44,30 +44,30 @@ public:
   using TValueType = TType;
   DMatrix4()  = default;
 
-  DMatrix4(
+  constexpr DMatrix4(
     TValueType _00, TValueType _01, TValueType _02, TValueType _03,
     TValueType _10, TValueType _11, TValueType _12, TValueType _13,
     TValueType _20, TValueType _21, TValueType _22, TValueType _23,
     TValueType _30, TValueType _31, TValueType _32, TValueType _33);
-  DMatrix4(
+  constexpr DMatrix4(
     const DVector4<TValueType>& col0, 
     const DVector4<TValueType>& col1,
     const DVector4<TValueType>& col2,
     const DVector4<TValueType>& col3);
 
-  DVector4<TValueType>& operator[](TIndex index) noexcept;
-  const DVector4<TValueType>& operator[](TIndex index) const noexcept;
+  constexpr DVector4<TValueType>& operator[](TIndex index) noexcept;
+  constexpr const DVector4<TValueType>& operator[](TIndex index) const noexcept;
 
   /// @brief Transpose matrix.
-  DMatrix4 Transpose() const noexcept;
+  constexpr DMatrix4 Transpose() const noexcept;
   /// @brief Get inverse matrix of this matrix.
   /// This does not check determinant is 0 or not.
-  DMatrix4 Inverse() const;
+  constexpr DMatrix4 Inverse() const;
 
   /// @brief Check this matrix can be inversed.
-  bool IsInvertible() const noexcept;
+  constexpr bool IsInvertible() const noexcept;
   /// @brief Get determinant of matrix.
-  TValueType GetDeterminant() const noexcept;
+  constexpr TValueType GetDeterminant() const noexcept;
 
   /// @brief Check value has NaN.
   bool HasNaN() const noexcept;
@@ -84,10 +84,10 @@ public:
   /// @brief Convert to vector that has values.
   std::vector<DVector4<TValueType>> ToVector() const noexcept;
   /// @brief Convert to Row Major Matrix.
-  DMatrix4<TType, EMatMajor::Row> ConvertToRowMatrix() const;
+  constexpr DMatrix4<TType, EMatMajor::Row> ConvertToRowMatrix() const;
 
   /// @brief Get identity matrix.
-  static DMatrix4 Identity() noexcept;
+  static constexpr DMatrix4 Identity() noexcept;
   
   /// Column major
   std::array<DVector4<TValueType>, 4> __mValues;
@@ -120,30 +120,30 @@ public:
   using TValueType = TType;
   DMatrix4()  = default;
 
-  DMatrix4(
+  constexpr DMatrix4(
     TValueType _00, TValueType _01, TValueType _02, TValueType _03,
     TValueType _10, TValueType _11, TValueType _12, TValueType _13,
     TValueType _20, TValueType _21, TValueType _22, TValueType _23,
     TValueType _30, TValueType _31, TValueType _32, TValueType _33);
-  DMatrix4(
+  constexpr DMatrix4(
     const DVector4<TValueType>& col0, 
     const DVector4<TValueType>& col1,
     const DVector4<TValueType>& col2,
     const DVector4<TValueType>& col3);
 
-  DVector4<TValueType>& operator[](TIndex index) noexcept;
-  const DVector4<TValueType>& operator[](TIndex index) const noexcept;
+  constexpr DVector4<TValueType>& operator[](TIndex index) noexcept;
+  constexpr const DVector4<TValueType>& operator[](TIndex index) const noexcept;
 
   /// @brief Transpose matrix.
-  DMatrix4 Transpose() const noexcept;
+  constexpr DMatrix4 Transpose() const noexcept;
   /// @brief Get inverse matrix of this matrix.
   /// This does not check determinant is 0 or not.
-  DMatrix4 Inverse() const;
+  constexpr DMatrix4 Inverse() const;
 
   /// @brief Check this matrix can be inversed.
-  bool IsInvertible() const noexcept;
+  constexpr bool IsInvertible() const noexcept;
   /// @brief Get determinant of matrix.
-  TValueType GetDeterminant() const noexcept;
+  constexpr TValueType GetDeterminant() const noexcept;
 
   /// @brief Check value has NaN.
   bool HasNaN() const noexcept;
@@ -160,10 +160,10 @@ public:
   /// @brief Convert to vector that has values.
   std::vector<DVector4<TValueType>> ToVector() const noexcept;
   /// @brief Convert to Column Major Matrix.
-  DMatrix4<TType, EMatMajor::Column> ConvertToColumnMatrix() const;
+  constexpr DMatrix4<TType, EMatMajor::Column> ConvertToColumnMatrix() const;
 
   /// @brief Get identity matrix.
-  static DMatrix4 Identity() noexcept;
+  static constexpr DMatrix4 Identity() noexcept;
   
   /// Row major
   std::array<DVector4<TValueType>, 4> __mValues;
@@ -189,3 +189,5 @@ static_assert(sizeof(DMatrix4<TF64, EMatMajor::Column>) == 128);
 } /// ::dy::math namespace
 #include <Math/Type/Inline/DMatrix4/DMatrix4Operator.inl>
 #include <Math/Type/Inline/DMatrix4/DMatrix4.inl>
+#include <Math/Type/Inline/DMatrix4/Simd/DMatrix4TF32.inl>
+#include <Math/Type/Inline/DMatrix4/Simd/DMatrix4TF64.inl>
@@ -38,19 +38,19 @@ public:
   DQuaternion() = default;
   /// @brief Contsructor for eulerAngle, pitch, yaw and roll.
   DQuaternion(const DVector3<TValueType>& eulerAngle, bool isDegree = true);
-  DQuaternion(TValueType x, TValueType y, TValueType z, TValueType w);
+  constexpr DQuaternion(TValueType x, TValueType y, TValueType z, TValueType w);
 
-  TValueType& operator[](TIndex index);
-  const TValueType& operator[](TIndex index) const;
+  constexpr TValueType& operator[](TIndex index);
+  constexpr const TValueType& operator[](TIndex index) const;
 
   /// @brief Get rotation matrix (3x3) from quaternion.
   template <EMatMajor TMajor>
-  DMatrix3<TValueType, TMajor> ToMatrix3() const noexcept;
+  constexpr DMatrix3<TValueType, TMajor> ToMatrix3() const noexcept;
   /// @brief Get rotation matrix (4x4) from quaternion.
   template <EMatMajor TMajor>
-  DMatrix4<TValueType, TMajor> ToMatrix4() const noexcept;
+  constexpr DMatrix4<TValueType, TMajor> ToMatrix4() const noexcept;
   /// @brief Get inverse quaternion of this quaternion.
-  DQuaternion Inverse() const;
+  constexpr DQuaternion Inverse() const;
 
   /// @brief Return euler rotation angle (degrees) (x, y, z).
   /// Note that Quaternion to euler angle does not guarantee precise degree euler angle.
@@ -84,10 +84,10 @@ public:
   /// @brief Get start pointer of matrix sequence.
   const TValueType* Data() const noexcept;
 
-  TValueType X() const noexcept;
-  TValueType Y() const noexcept;
-  TValueType Z() const noexcept;
-  TValueType W() const noexcept;
+  constexpr TValueType X() const noexcept;
+  constexpr TValueType Y() const noexcept;
+  constexpr TValueType Z() const noexcept;
+  constexpr TValueType W() const noexcept;
 
   TValueType mX = 0, mY = 0, mZ = 0, mW = TValueType(1);
 
@@ -97,13 +97,13 @@ public:
 };
 
 template<typename TType>
-DQuaternion<TType> operator+(const DQuaternion<TType>& q, const DQuaternion<TType>& p)
+constexpr DQuaternion<TType> operator+(const DQuaternion<TType>& q, const DQuaternion<TType>& p)
 {
   return { q.X() + p.X(), q.Y() + p.Y(), q.Z() + p.Z(), q.W() + p.W() };
 }
 
 template<typename TType>
-DQuaternion<TType> operator*(const DQuaternion<TType>& q, const DQuaternion<TType>& p)
+constexpr DQuaternion<TType> operator*(const DQuaternion<TType>& q, const DQuaternion<TType>& p)
 {
   return 
   {
@@ -115,19 +115,19 @@ DQuaternion<TType> operator*(const DQuaternion<TType>& q, const DQuaternion<TTyp
 }
 
 template<typename TType>
-DQuaternion<TType> operator*(const DQuaternion<TType>& q, const TType& p)
+constexpr DQuaternion<TType> operator*(const DQuaternion<TType>& q, const TType& p)
 {
   return { q.X() * p, q.Y() * p, q.Z() * p, q.W() * p };
 }
 
 template<typename TType>
-DQuaternion<TType> operator*(const TType& p, const DQuaternion<TType>& q)
+constexpr DQuaternion<TType> operator*(const TType& p, const DQuaternion<TType>& q)
 {
   return q * p;
 }
 
 template<typename TType>
-DQuaternion<TType> operator/(const DQuaternion<TType>& q, const TType& p)
+constexpr DQuaternion<TType> operator/(const DQuaternion<TType>& q, const TType& p)
 {
   return { q.X() / p, q.Y() / p, q.Z() / p, q.W() / p };
 }
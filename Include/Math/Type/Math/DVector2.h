@@ -50,16 +50,16 @@ struct MATH_NODISCARD DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>> f
   TValueType X, Y;
 
   DVector2() = default;
-  DVector2(TValueType x, TValueType y) noexcept;
-  DVector2(TValueType value) noexcept;
+  constexpr DVector2(TValueType x, TValueType y) noexcept;
+  constexpr DVector2(TValueType value) noexcept;
 
   template <typename TAnotherType>
-  explicit operator DVector2<TAnotherType>() const noexcept;
+  constexpr explicit operator DVector2<TAnotherType>() const noexcept;
 
   /// @brief Get values with index. index must be 0 or 1.
-  TValueType& operator[](TIndex index);
+  constexpr TValueType& operator[](TIndex index);
   /// @brief Get values with index. index must be 0 or 1.
-  const TValueType& operator[](TIndex index) const;
+  constexpr const TValueType& operator[](TIndex index) const;
 
   /// @brief Return data chunk pointer of DVector2.
   TValueType* Data() noexcept;
@@ -75,12 +75,12 @@ struct MATH_NODISCARD DVector2<TType, std::enable_if_t<kIsIntegerType<TType>>> f
   /// @return Normalized DVector2 vector.
   DVector2<TReal> Normalize() const noexcept;
 
-  DVector2& operator+=(const DVector2& value) noexcept;
-  DVector2& operator-=(const DVector2& value) noexcept;
-  DVector2& operator*=(TValueType value) noexcept;
-  DVector2& operator*=(const DVector2& value) noexcept;
-  DVector2& operator/=(TValueType value);
-  DVector2& operator/=(const DVector2& value);
+  constexpr DVector2& operator+=(const DVector2& value) noexcept;
+  constexpr DVector2& operator-=(const DVector2& value) noexcept;
+  constexpr DVector2& operator*=(TValueType value) noexcept;
+  constexpr DVector2& operator*=(const DVector2& value) noexcept;
+  constexpr DVector2& operator/=(TValueType value);
+  constexpr DVector2& operator/=(const DVector2& value);
 
 #ifdef MATH_ENABLE_RTTR
   EXPR_BIND_REFLECTION();
@@ -94,16 +94,16 @@ struct MATH_NODISCARD DVector2<TType, std::enable_if_t<kIsRealType<TType>>> fina
   TValueType X, Y;
 
   DVector2() = default;
-  DVector2(TValueType x, TValueType y) noexcept;
-  DVector2(TValueType value) noexcept;
+  constexpr DVector2(TValueType x, TValueType y) noexcept;
+  constexpr DVector2(TValueType value) noexcept;
 
   template <typename TAnotherType>
-  explicit operator DVector2<TAnotherType>() const noexcept;
+  constexpr explicit operator DVector2<TAnotherType>() const noexcept;
 
   /// @brief Get values with index. index must be 0 or 1.
-  TValueType& operator[](TIndex index);
+  constexpr TValueType& operator[](TIndex index);
   /// @brief Get values with index. index must be 0 or 1.
-  const TValueType& operator[](TIndex index) const;
+  constexpr const TValueType& operator[](TIndex index) const;
 
   /// @brief Return data chunk pointer of DVector2.
   TValueType* Data() noexcept;
@@ -126,12 +126,12 @@ struct MATH_NODISCARD DVector2<TType, std::enable_if_t<kIsRealType<TType>>> fina
   /// @brief Check values are normal value, neither NaN nor Inf.
   bool HasOnlyNormal() const noexcept;
 
-  DVector2& operator+=(const DVector2& value) noexcept;
-  DVector2& operator-=(const DVector2& value) noexcept;
-  DVector2& operator*=(TValueType value) noexcept;
-  DVector2& operator*=(const DVector2& value) noexcept;
-  DVector2& operator/=(TValueType value);
-  DVector2& operator/=(const DVector2& value);
+  constexpr DVector2& operator+=(const DVector2& value) noexcept;
+  constexpr DVector2& operator-=(const DVector2& value) noexcept;
+  constexpr DVector2& operator*=(TValueType value) noexcept;
+  constexpr DVector2& operator*=(const DVector2& value) noexcept;
+  constexpr DVector2& operator/=(TValueType value);
+  constexpr DVector2& operator/=(const DVector2& value);
 
 #ifdef MATH_ENABLE_RTTR
   EXPR_BIND_REFLECTION();
@@ -51,22 +51,22 @@ struct MATH_NODISCARD DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>> f
   TValueType X, Y, Z;
 
   DVector3() = default;
-  DVector3(TValueType x, TValueType y, TValueType z) noexcept;
-  DVector3(TValueType value) noexcept; 
-  DVector3(const DVector2<TValueType>& value) noexcept;
+  constexpr DVector3(TValueType x, TValueType y, TValueType z) noexcept;
+  constexpr DVector3(TValueType value) noexcept; 
+  constexpr DVector3(const DVector2<TValueType>& value) noexcept;
 
   template <typename TAnotherType>
-  explicit operator DVector3<TAnotherType>() const noexcept;
+  constexpr explicit operator DVector3<TAnotherType>() const noexcept;
 
   /// @brief Narrow conversion.
-  explicit operator DVector2<
+  constexpr explicit operator DVector2<
     TValueType,
     std::enable_if_t<kIsIntegerType<TType>>>() const noexcept;
 
   /// @brief Get values with index. index must be 0, 1 or 2.
-  TValueType& operator[](TIndex index);
+  constexpr TValueType& operator[](TIndex index);
   /// @brief Get values with index. index must be 0, 1 or 2.
-  const TValueType& operator[](TIndex index) const;
+  constexpr const TValueType& operator[](TIndex index) const;
 
   /// @brief Return data chunk pointer of DVector3.
   TValueType* Data() noexcept;
@@ -81,19 +81,19 @@ struct MATH_NODISCARD DVector3<TType, std::enable_if_t<kIsIntegerType<TType>>> f
   /// @brief Return new DVector3 instance of normalized input vector.
   DVector3<TReal> Normalize() const noexcept;
 
-  DVector3& operator+=(const DVector3& value) noexcept;
-  DVector3& operator-=(const DVector3& value) noexcept;
-  DVector3& operator*=(TValueType value) noexcept;
-  DVector3& operator*=(const DVector3& value) noexcept;
-  DVector3& operator/=(TValueType value) noexcept;
-  DVector3& operator/=(const DVector3& value) noexcept;
+  constexpr DVector3& operator+=(const DVector3& value) noexcept;
+  constexpr DVector3& operator-=(const DVector3& value) noexcept;
+  constexpr DVector3& operator*=(TValueType value) noexcept;
+  constexpr DVector3& operator*=(const DVector3& value) noexcept;
+  constexpr DVector3& operator/=(TValueType value) noexcept;
+  constexpr DVector3& operator/=(const DVector3& value) noexcept;
 
   /// @brief Return {1, 0, 0} right DVector3 vector.
-  static DVector3 UnitX() noexcept;
+  static constexpr DVector3 UnitX() noexcept;
   /// @brief Return {0, 1, 0} up DVector3 vector.
-  static DVector3 UnitY() noexcept;
+  static constexpr DVector3 UnitY() noexcept;
   /// @brief Return {0, 0, 1} front DVector3 vector.
-  static DVector3 UnitZ() noexcept;
+  static constexpr DVector3 UnitZ() noexcept;
 
 #ifdef MATH_ENABLE_RTTR
   EXPR_BIND_REFLECTION();
@@ -107,20 +107,20 @@ struct MATH_NODISCARD DVector3<TType, std::enable_if_t<kIsRealType<TType>>> fina
   TValueType X, Y, Z;
 
   DVector3() = default;
-  DVector3(TValueType x, TValueType y, TValueType z) noexcept;
-  DVector3(TValueType value) noexcept; 
-  DVector3(const DVector2<TValueType>& value) noexcept;
+  constexpr DVector3(TValueType x, TValueType y, TValueType z) noexcept;
+  constexpr DVector3(TValueType value) noexcept; 
+  constexpr DVector3(const DVector2<TValueType>& value) noexcept;
 
   template <typename TAnotherType>
-  explicit operator DVector3<TAnotherType>() const noexcept;
+  constexpr explicit operator DVector3<TAnotherType>() const noexcept;
 
   /// @brief Narrow conversion.
-  explicit operator DVector2<TValueType>() const noexcept;
+  constexpr explicit operator DVector2<TValueType>() const noexcept;
 
   /// @brief Get values with index. index must be 0, 1 or 2.
-  TValueType& operator[](TIndex index);
+  constexpr TValueType& operator[](TIndex index);
   /// @brief Get values with index. index must be 0, 1 or 2.
-  const TValueType& operator[](TIndex index) const;
+  constexpr const TValueType& operator[](TIndex index) const;
 
   /// @brief Return data chunk pointer of DVector3.
   TValueType* Data() noexcept;
@@ -142,19 +142,19 @@ struct MATH_NODISCARD DVector3<TType, std::enable_if_t<kIsRealType<TType>>> fina
   /// @brief Check values are normal value, neither NaN nor Inf.
   bool HasOnlyNormal() const noexcept;
 
-  DVector3& operator+=(const DVector3& value) noexcept;
-  DVector3& operator-=(const DVector3& value) noexcept;
-  DVector3& operator*=(TValueType value) noexcept;
-  DVector3& operator*=(const DVector3& value) noexcept;
-  DVector3& operator/=(TValueType value) noexcept;
-  DVector3& operator/=(const DVector3& value) noexcept;
+  constexpr DVector3& operator+=(const DVector3& value) noexcept;
+  constexpr DVector3& operator-=(const DVector3& value) noexcept;
+  constexpr DVector3& operator*=(TValueType value) noexcept;
+  constexpr DVector3& operator*=(const DVector3& value) noexcept;
+  constexpr DVector3& operator/=(TValueType value) noexcept;
+  constexpr DVector3& operator/=(const DVector3& value) noexcept;
 
   /// @brief Return {1, 0, 0} right DVector3 vector.
-  static DVector3 UnitX() noexcept;
+  static constexpr DVector3 UnitX() noexcept;
   /// @brief Return {0, 1, 0} up DVector3 vector.
-  static DVector3 UnitY() noexcept;
+  static constexpr DVector3 UnitY() noexcept;
   /// @brief Return {0, 0, 1} front DVector3 vector.
-  static DVector3 UnitZ() noexcept;
+  static constexpr DVector3 UnitZ() noexcept;
 
 #ifdef MATH_ENABLE_RTTR
   EXPR_BIND_REFLECTION();
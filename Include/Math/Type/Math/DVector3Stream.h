@@ -0,0 +1,78 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <array>
+#include <vector>
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Type/Math/DVector3.h>
+#include <Math/Type/Micellanous/DAlignedAllocator.h>
+
+namespace dy::math
+{
+
+/// @class DVector3Stream
+/// @brief Structure-of-arrays container of (x, y, z) vectors.
+/// Each axis is stored in own `kStreamAlignment`-aligned plane, so bulk kernels of `XStreamMath.h`
+/// can load values of same axis with aligned SIMD instructions.
+/// Use `Gather` and `Scatter` to convert from / to array-of-structures `DVector3` buffer.
+/// @tparam TType Real type.
+template <typename TType>
+struct MATH_NODISCARD DVector3Stream final
+{
+  static_assert(kIsRealType<TType> == true, "DVector3Stream only supports real type.");
+
+  using TValueType = TType;
+  using TPlane = std::vector<TType, DAlignedAllocator<TType, kStreamAlignment>>;
+  static constexpr TIndex kDimension = 3;
+
+  DVector3Stream() = default;
+  /// @brief Create stream with `size` zero vectors.
+  explicit DVector3Stream(TIndex size);
+  /// @brief Create stream from array-of-structures buffer.
+  DVector3Stream(const DVector3<TValueType>* iValues, TIndex count);
+
+  /// @brief Get the number of vectors.
+  TIndex size() const noexcept;
+  /// @brief Check stream has no vector.
+  bool empty() const noexcept;
+  /// @brief Resize all planes. New vectors are zero.
+  void resize(TIndex size);
+  /// @brief Reserve all planes.
+  void reserve(TIndex capacity);
+  /// @brief Remove all vectors.
+  void clear() noexcept;
+  /// @brief Append vector to the end of stream.
+  void push_back(const DVector3<TValueType>& value);
+
+  /// @brief Get vector of index.
+  DVector3<TValueType> Get(TIndex index) const noexcept;
+  /// @brief Set vector of index.
+  void Set(TIndex index, const DVector3<TValueType>& value) noexcept;
+
+  /// @brief Get start pointer of axis plane. axis must be 0, 1 or 2.
+  TValueType* GetPlane(TIndex axis) noexcept;
+  /// @brief Get start pointer of axis plane. axis must be 0, 1 or 2.
+  const TValueType* GetPlane(TIndex axis) const noexcept;
+
+  /// @brief Resize stream to `count` and convert array-of-structures `iValues` into planes.
+  void Gather(const DVector3<TValueType>* iValues, TIndex count);
+  /// @brief Convert planes into array-of-structures `oValues`, which must have `size()` vectors.
+  void Scatter(DVector3<TValueType>* oValues) const noexcept;
+
+  /// X, Y and Z plane.
+  std::array<TPlane, kDimension> __mPlanes;
+};
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/DVector3Stream/DVector3Stream.inl>
@@ -52,27 +52,27 @@ struct MATH_NODISCARD DVector4<TType, std::enable_if_t<kIsIntegerType<TType>>> f
   TValueType X, Y, Z, W;
 
   DVector4() = default;
-  DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept;
-  DVector4(TValueType value) noexcept; 
-  DVector4(const DVector2<TValueType>& value, TValueType z = TValueType{}, TValueType w = TValueType{}) noexcept;
-  DVector4(const DVector3<TValueType>& value, TValueType w = TValueType{}) noexcept;
+  constexpr DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept;
+  constexpr DVector4(TValueType value) noexcept; 
+  constexpr DVector4(const DVector2<TValueType>& value, TValueType z = TValueType{}, TValueType w = TValueType{}) noexcept;
+  constexpr DVector4(const DVector3<TValueType>& value, TValueType w = TValueType{}) noexcept;
 
   template <typename TAnotherType>
-  explicit operator DVector4<TAnotherType>() const noexcept;
+  constexpr explicit operator DVector4<TAnotherType>() const noexcept;
 
   /// @brief Narrow conversion.
-  explicit operator DVector2<
+  constexpr explicit operator DVector2<
     TValueType,
     std::enable_if_t<kIsIntegerType<TType>>>() const noexcept;
   /// @brief Narrow conversion.
-  explicit operator DVector3<
+  constexpr explicit operator DVector3<
     TValueType, 
     std::enable_if_t<kIsIntegerType<TType>>>() const noexcept;
 
   /// @brief Get values with index. index must be 0, 1 or 2.
-  TValueType& operator[](TIndex index);
+  constexpr TValueType& operator[](TIndex index);
   /// @brief Get values with index. index must be 0, 1 or 2.
-  const TValueType& operator[](TIndex index) const;
+  constexpr const TValueType& operator[](TIndex index) const;
 
   /// @brief Return data chunk pointer of DVector4.
   TValueType* Data() noexcept;
@@ -89,12 +89,12 @@ struct MATH_NODISCARD DVector4<TType, std::enable_if_t<kIsIntegerType<TType>>> f
   /// @brief Return new DVector4 instance of normalized input vector.
   DVector4<TReal> Normalize() const noexcept;
 
-  DVector4& operator+=(const DVector4& value) noexcept;
-  DVector4& operator-=(const DVector4& value) noexcept;
-  DVector4& operator*=(TValueType value) noexcept;
-  DVector4& operator*=(const DVector4& value) noexcept;
-  DVector4& operator/=(TValueType value) noexcept;
-  DVector4& operator/=(const DVector4& value) noexcept;
+  constexpr DVector4& operator+=(const DVector4& value) noexcept;
+  constexpr DVector4& operator-=(const DVector4& value) noexcept;
+  constexpr DVector4& operator*=(TValueType value) noexcept;
+  constexpr DVector4& operator*=(const DVector4& value) noexcept;
+  constexpr DVector4& operator/=(TValueType value) noexcept;
+  constexpr DVector4& operator/=(const DVector4& value) noexcept;
 
 #ifdef MATH_ENABLE_RTTR
   EXPR_BIND_REFLECTION();
@@ -108,23 +108,23 @@ struct MATH_NODISCARD DVector4<TType, std::enable_if_t<kIsRealType<TType>>> fina
   TValueType X, Y, Z, W;
 
   DVector4() = default;
-  DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept;
-  DVector4(TValueType value) noexcept; 
-  DVector4(const DVector2<TValueType>& value, TValueType z = TValueType{}, TValueType w = TValueType{}) noexcept;
-  DVector4(const DVector3<TValueType>& value, TValueType w = TValueType{}) noexcept;
+  constexpr DVector4(TValueType x, TValueType y, TValueType z, TValueType w) noexcept;
+  constexpr DVector4(TValueType value) noexcept; 
+  constexpr DVector4(const DVector2<TValueType>& value, TValueType z = TValueType{}, TValueType w = TValueType{}) noexcept;
+  constexpr DVector4(const DVector3<TValueType>& value, TValueType w = TValueType{}) noexcept;
 
   template <typename TAnotherType>
-  explicit operator DVector4<TAnotherType>() const noexcept;
+  constexpr explicit operator DVector4<TAnotherType>() const noexcept;
   
   /// @brief Narrow conversion.
-  explicit operator DVector2<TValueType>() const noexcept;
+  constexpr explicit operator DVector2<TValueType>() const noexcept;
   /// @brief Narrow conversion.
-  explicit operator DVector3<TValueType>() const noexcept;
+  constexpr explicit operator DVector3<TValueType>() const noexcept;
 
   /// @brief Get values with index. index must be 0, 1 or 2.
-  TValueType& operator[](TIndex index);
+  constexpr TValueType& operator[](TIndex index);
   /// @brief Get values with index. index must be 0, 1 or 2.
-  const TValueType& operator[](TIndex index) const;
+  constexpr const TValueType& operator[](TIndex index) const;
 
   /// @brief Return data chunk pointer of DVector4.
   TValueType* Data() noexcept;
@@ -148,12 +148,12 @@ struct MATH_NODISCARD DVector4<TType, std::enable_if_t<kIsRealType<TType>>> fina
   /// @brief Check values are normal value, neither NaN nor Inf.
   bool HasOnlyNormal() const noexcept;
 
-  DVector4& operator+=(const DVector4& value) noexcept;
-  DVector4& operator-=(const DVector4& value) noexcept;
-  DVector4& operator*=(TValueType value) noexcept;
-  DVector4& operator*=(const DVector4& value) noexcept;
-  DVector4& operator/=(TValueType value) noexcept;
-  DVector4& operator/=(const DVector4& value) noexcept;
+  constexpr DVector4& operator+=(const DVector4& value) noexcept;
+  constexpr DVector4& operator-=(const DVector4& value) noexcept;
+  constexpr DVector4& operator*=(TValueType value) noexcept;
+  constexpr DVector4& operator*=(const DVector4& value) noexcept;
+  constexpr DVector4& operator/=(TValueType value) noexcept;
+  constexpr DVector4& operator/=(const DVector4& value) noexcept;
 
 #ifdef MATH_ENABLE_RTTR
   EXPR_BIND_REFLECTION();
@@ -161,8 +161,13 @@ struct MATH_NODISCARD DVector4<TType, std::enable_if_t<kIsRealType<TType>>> fina
 };
 
 } /// ::dy::math namespace
+// Normalize() of specializations returns DVector4<TReal>, so specialization of TReal is defined first.
+#ifdef MATH_USE_REAL_AS_DOUBLE
+#include <Math/Type/Inline/DVector4/Simd/DVector4TF64.inl>
+#endif
 #include <Math/Type/Inline/DVector4/Simd/DVector4TF32.inl>
 #include <Math/Type/Inline/DVector4/Simd/DVector4TI32.inl>
+#include <Math/Type/Inline/DVector4/Simd/DVector4TF64.inl>
 #include <Math/Type/Inline/DVector4/DVector4Common.inl>
 #include <Math/Type/Inline/DVector4/DVector4Int.inl>
 #include <Math/Type/Inline/DVector4/DVector4Real.inl>
@@ -0,0 +1,69 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include <new>
+#include <Math/Common/TGlobalTypes.h>
+
+namespace dy::math
+{
+
+/// @brief Alignment in bytes of buffers loaded by SIMD kernels, such as planes of vector streams.
+/// This is enough for AVX aligned load.
+constexpr TIndex kStreamAlignment = 32;
+
+/// @struct DAlignedAllocator
+/// @brief Standard allocator which allocates memory aligned to `TAlignment` bytes.
+/// Used by containers of which buffer is loaded with aligned SIMD instructions.
+/// @tparam TType Value type.
+/// @tparam TAlignment Alignment in bytes. Must be power of 2 and not less than `alignof(TType)`.
+template <typename TType, TIndex TAlignment>
+struct DAlignedAllocator
+{
+  static_assert((TAlignment & (TAlignment - 1)) == 0, "Alignment must be power of 2.");
+  static_assert(TAlignment >= alignof(TType), "Alignment must not be less than alignment of type.");
+
+  using value_type = TType;
+
+  template <typename TAnotherType>
+  struct rebind { using other = DAlignedAllocator<TAnotherType, TAlignment>; };
+
+  DAlignedAllocator() noexcept = default;
+  template <typename TAnotherType>
+  DAlignedAllocator(const DAlignedAllocator<TAnotherType, TAlignment>&) noexcept { }
+
+  TType* allocate(std::size_t count)
+  {
+    return static_cast<TType*>(::operator new(count * sizeof(TType), std::align_val_t{TAlignment}));
+  }
+
+  void deallocate(TType* ptr, std::size_t) noexcept
+  {
+    ::operator delete(ptr, std::align_val_t{TAlignment});
+  }
+};
+
+template <typename TLeft, typename TRight, TIndex TAlignment>
+bool operator==(const DAlignedAllocator<TLeft, TAlignment>&, const DAlignedAllocator<TRight, TAlignment>&) noexcept
+{
+  return true;
+}
+
+template <typename TLeft, typename TRight, TIndex TAlignment>
+bool operator!=(const DAlignedAllocator<TLeft, TAlignment>&, const DAlignedAllocator<TRight, TAlignment>&) noexcept
+{
+  return false;
+}
+
+} /// ::dy::math namespace
@@ -0,0 +1,69 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <vector>
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Type/Math/DVector2.h>
+#include <Math/Type/Math/DVector3.h>
+
+namespace dy::math
+{
+
+/// @class DBlueNoiseTile
+/// @brief Tileable blue noise of `size` x `size` pixels, made with void-and-cluster method.
+/// Each pixel has rank in [0, size^2), and pixels of any threshold of rank are evenly spread without clusters.
+/// Tile is made once (about 50ms with 64 x 64), and `Sample` is stateless lookup which can be called
+/// from any thread.
+/// @reference Ulichney, The void-and-cluster method for dither array generation (1993)
+class DBlueNoiseTile final
+{
+public:
+  DBlueNoiseTile() = default;
+  /// @brief Make tile. See `Generate`.
+  explicit DBlueNoiseTile(TIndex size, TU64 seed = 0, TReal sigma = TReal(1.5));
+
+  /// @brief Make tile of `size` x `size` pixels. Previous tile is discarded.
+  /// @param seed Seed of initial random pattern. Different seed makes different tile.
+  /// @param sigma Deviation of gaussian filter, in pixel, which decides distance between close pixels.
+  void Generate(TIndex size, TU64 seed = 0, TReal sigma = TReal(1.5));
+
+  /// @brief Get the number of pixels of each axis. Zero when tile is not made.
+  TIndex GetSize() const noexcept;
+  /// @brief Get rank of pixel in [0, size^2). Pixel position is wrapped.
+  TU32 GetRankOf(TU32 x, TU32 y) const noexcept;
+
+  /// @brief Get blue noise value in [0, 1) of pixel, for `index`-th sample (e.g. frame) of `dim`-th dimension.
+  /// Each dimension uses tile shifted by R2 sequence, and each index adds golden ratio to value,
+  /// so values of each pixel over indices are also well distributed. Tile must be made.
+  template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+  TType Sample(TU32 x, TU32 y, TU32 index = 0, TU32 dim = 0) const noexcept;
+
+  /// @brief Get 2D point of dimensions `dim` and `dim + 1`.
+  template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+  DVector2<TType> GetVector2(TU32 x, TU32 y, TU32 index = 0, TU32 dim = 0) const noexcept;
+
+  /// @brief Get 3D point of dimensions `dim`, `dim + 1` and `dim + 2`.
+  template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+  DVector3<TType> GetVector3(TU32 x, TU32 y, TU32 index = 0, TU32 dim = 0) const noexcept;
+
+private:
+  /// @brief Get rank of dimension as 0.32 fixed point, with half of rank step.
+  TU32 pGetRankBitsOf(TU32 x, TU32 y, TU32 dim) const noexcept;
+
+  TIndex mSize = 0;
+  std::vector<TU32> mRanks;
+};
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/Micellanous/DBlueNoiseTile.inl>
@@ -0,0 +1,180 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <optional>
+#include <variant>
+#include <vector>
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Common/XGlobalMacroes.h>
+#include <Math/Type/Micellanous/DBounds3D.h>
+#include <Math/Type/Shape/DRay.h>
+#include <Math/Type/Shape/DSphere.h>
+#include <Math/Type/Shape/DBox.h>
+#include <Math/Type/Shape/DCapsule.h>
+#include <Math/Type/Shape/DCone.h>
+#include <Math/Type/Shape/DFrustum.h>
+#include <Math/Type/Shape/DTorus.h>
+#include <Math/Type/Shape/DPlane.h>
+
+namespace dy::math
+{
+
+/// @brief Shape types that can be stored into DBvh. All shapes are in world-space.
+template <typename TType>
+using DBvhShape = std::variant<
+  DSphere<TType>,
+  DBox<TType>,
+  DCapsule<TType>,
+  DCone<TType>,
+  DTorus<TType>,
+  DPlane<TType>>;
+
+/// @enum EBvhBuildMethod
+/// @brief Build algorithm of DBvh.
+enum class EBvhBuildMethod
+{
+  /// Binned SAH (Surface Area Heuristic). Better tree for queries.
+  BinnedSah,
+  /// Linear BVH, which splits shapes sorted by morton code of centroid. Fastest build.
+  Lbvh,
+};
+
+/// @struct DBvhBuildOption
+/// @brief Build option of DBvh.
+struct DBvhBuildOption final
+{
+  EBvhBuildMethod mMethod = EBvhBuildMethod::BinnedSah;
+  /// Maximum shapes of leaf.
+  TIndex mMaxLeafSize = 4;
+  /// The number of threads to build. 0 uses all hardware threads, 1 builds in calling thread only.
+  TIndex mThreadCount = 1;
+};
+
+/// @struct DBvhHit
+/// @brief Result of ray query of DBvh.
+struct DBvhHit final
+{
+  /// Index of shape in the list given to DBvh.
+  TIndex mIndex = 0;
+  /// Positive 't' value of hit point from ray origin.
+  TReal mT = 0;
+};
+
+/// @class DBvh
+/// @tparam TType Real type.
+/// @brief Bounding volume hierarchy of heterogeneous shapes, built with binned SAH (Surface Area Heuristic).
+///
+/// Nodes are flattened into one array in depth-first order. Left child is always next to its parent,
+/// so only right child index is stored. Shapes are reordered by leaf order, so shapes of one leaf are contiguous.
+/// Shape which has infinite bounds (e.g. DPlane) is not inserted into tree, but tested in every query.
+///
+/// Subtrees are built in parallel on DWorkStealingPool when `DBvhBuildOption::mThreadCount` is not 1.
+/// Result of binned SAH does not depend on the number of threads.
+template <typename TType>
+class DBvh final
+{
+public:
+  static_assert(kIsRealType<TType> == true, "DBvh only supports real type.");
+  using TValueType = TType;
+  using TShape = DBvhShape<TType>;
+
+  /// @brief Default number of maximum shapes of leaf node.
+  static constexpr TIndex kDefaultLeafSize = 4;
+  /// @brief The number of bins of SAH of each split.
+  static constexpr TIndex kBinCount = 16;
+  /// @brief Maximum depth of tree. Deeper nodes are split by median of the longest axis.
+  static constexpr TIndex kMaxSahDepth = 32;
+  /// @brief Subtree which has less shapes than this is built in one task.
+  static constexpr TIndex kParallelSubtreeSize = 4096;
+
+  /// @struct DNode
+  /// @brief Flattened node. 32 bytes when TType is TF32.
+  struct DNode final
+  {
+    DBounds3D<TValueType> mBounds;
+    /// Index of first shape when leaf, index of right child node when internal node.
+    TU32 mOffset = 0;
+    /// The number of shapes when leaf, 0 when internal node.
+    TU16 mCount = 0;
+    /// Split axis of internal node. (0 : X, 1 : Y, 2 : Z)
+    TU16 mAxis = 0;
+
+    /// @brief Check node is leaf.
+    bool IsLeaf() const noexcept { return this->mCount > 0; }
+  };
+
+  DBvh() = default;
+  /// @brief Build hierarchy from given shapes. Shapes are indexed in given order.
+  explicit DBvh(const std::vector<TShape>& shapes, TIndex maxLeafSize = kDefaultLeafSize);
+  /// @brief Build hierarchy from given shapes with build option.
+  DBvh(const std::vector<TShape>& shapes, const DBvhBuildOption& option);
+
+  /// @brief Rebuild hierarchy from given shapes. Previous hierarchy is discarded.
+  /// @param maxLeafSize Maximum shapes of leaf. Leaf never has more shapes than this.
+  void Build(const std::vector<TShape>& shapes, TIndex maxLeafSize = kDefaultLeafSize);
+  /// @brief Rebuild hierarchy from given shapes with build option. Previous hierarchy is discarded.
+  void Build(const std::vector<TShape>& shapes, const DBvhBuildOption& option);
+
+  /// @brief Remove all shapes and nodes.
+  void Clear() noexcept;
+
+  /// @brief Get the number of shapes, including shapes which has infinite bounds.
+  TIndex GetShapeCount() const noexcept;
+  /// @brief Get flattened node list. First node is root when not empty.
+  const std::vector<DNode>& GetNodes() const noexcept;
+  /// @brief Get bounds of shapes in tree. Shapes which has infinite bounds are not included.
+  /// If there is no finite shape, infinite bounds is returned.
+  DBounds3D<TValueType> GetBounds() const noexcept;
+
+  /// @brief Get the closest hit of ray with positive 't'.
+  /// Result is same to the smallest `GetClosestTValueOf` of all shapes.
+  /// @param maxT Hit whose 't' is bigger than this is ignored.
+  std::optional<DBvhHit> GetClosestHit(const DRay<TValueType>& ray, TReal maxT = kMaxValueOf<TReal>) const;
+
+  /// @brief Check ray hits any shape with positive 't' up to `maxT`. Traversal stops on the first hit.
+  bool IsAnyHit(const DRay<TValueType>& ray, TReal maxT = kMaxValueOf<TReal>) const;
+
+  /// @brief Get indices of shapes whose bounds overlap with given bounds. Touching bounds are overlapped.
+  /// Shapes which has infinite bounds are always overlapped.
+  /// @param oIndices Found indices are appended. Order is not specified.
+  void GetOverlappedIndices(const DBounds3D<TValueType>& bounds, std::vector<TIndex>& oIndices) const;
+
+  /// @brief Get indices of shapes whose bounds are not culled by frustum. Shapes which has infinite bounds are always visible.
+  /// Planes which node is entirely inside of are not tested for children, and all shapes of node which is inside of frustum
+  /// are appended without test. Shapes are tested as conservative as `frustum.IsVisible(bounds)`.
+  /// @param oIndices Found indices are appended. Order is not specified.
+  void GetVisibleIndices(const DFrustum<TValueType>& frustum, std::vector<TIndex>& oIndices) const;
+
+private:
+  /// @brief Build flattened nodes and store shapes in leaf order.
+  void pBuild(const std::vector<TShape>& shapes, const DBvhBuildOption& option);
+
+  /// @brief Get positive closest 't' of shape if exist.
+  static std::optional<TReal> pGetClosestTValueOf(const DRay<TValueType>& ray, const TShape& shape);
+
+  std::vector<DNode>  mNodes;
+  /// Shapes in leaf order.
+  std::vector<TShape> mShapes;
+  /// Bounds of each shape in leaf order.
+  std::vector<DBounds3D<TValueType>> mShapeBounds;
+  /// Given index of each shape in leaf order.
+  std::vector<TU32>   mIndices;
+
+  /// Shapes which has infinite bounds, and given index of them.
+  std::vector<TShape> mInfiniteShapes;
+  std::vector<TU32>   mInfiniteIndices;
+};
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/DBvh/DBvh.inl>
@@ -0,0 +1,131 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <utility>
+#include <vector>
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Common/XGlobalMacroes.h>
+#include <Math/Type/Micellanous/DBounds3D.h>
+
+namespace dy::math
+{
+
+/// @class DDynamicBoundsTree
+/// @tparam TType Real type.
+/// @brief Dynamic AABB tree for moving DBounds3D, e.g. broadphase of collision detection.
+///
+/// Each leaf keeps fat bounds, which is given bounds expanded by margin with `GetExpandOf`.
+/// Moving bounds inside its fat bounds does not change tree. Otherwise leaf is removed and inserted again,
+/// which refits only ancestors of leaf in O(log n). Ancestors are rebalanced with tree rotation while refitting.
+///
+/// Handle is stable from `Insert` to `Remove`, even if leaf is moved or tree is rotated.
+/// Handle of removed leaf can be reused by next `Insert`.
+template <typename TType>
+class DDynamicBoundsTree final
+{
+public:
+  static_assert(kIsRealType<TType> == true, "DDynamicBoundsTree only supports real type.");
+  using TValueType = TType;
+  using THandle = TU32;
+
+  /// @brief Invalid handle value.
+  static constexpr THandle kInvalidHandle = kMaxValueOf<TU32>;
+
+  /// @brief Create empty tree with margin of fat bounds.
+  explicit DDynamicBoundsTree(TValueType margin = TValueType(0.1));
+
+  /// @brief Insert bounds with user value, and return handle of it.
+  /// Bounds must be finite.
+  THandle Insert(const DBounds3D<TValueType>& bounds, TIndex userValue = 0);
+
+  /// @brief Remove bounds of given handle. Handle must be valid.
+  void Remove(THandle handle);
+
+  /// @brief Update bounds of handle.
+  /// If new bounds is in fat bounds, only bounds is updated. Otherwise leaf is inserted again with new fat bounds.
+  /// @return True if leaf is inserted again.
+  bool Move(THandle handle, const DBounds3D<TValueType>& bounds);
+
+  /// @brief Move bounds of handle by offset with `GetMovedOf`. Same to `Move` with moved bounds.
+  /// @return True if leaf is inserted again.
+  bool MoveBy(THandle handle, const DVector3<TValueType>& offset);
+
+  /// @brief Remove all bounds. All handles are invalidated.
+  void Clear() noexcept;
+
+  /// @brief Get bounds of handle which is given by `Insert` or `Move`.
+  const DBounds3D<TValueType>& GetBounds(THandle handle) const noexcept;
+  /// @brief Get fat bounds of handle, which is stored in tree.
+  const DBounds3D<TValueType>& GetFatBounds(THandle handle) const noexcept;
+  /// @brief Get user value of handle.
+  TIndex GetUserValue(THandle handle) const noexcept;
+
+  /// @brief Get the number of inserted bounds.
+  TIndex GetCount() const noexcept;
+  /// @brief Get height of tree. Empty tree has 0, and tree of only one leaf has 1.
+  TIndex GetHeight() const noexcept;
+  /// @brief Get margin of fat bounds.
+  TValueType GetMargin() const noexcept;
+
+  /// @brief Get handles whose fat bounds overlap with given bounds. Touching bounds are overlapped.
+  /// @param oHandles Found handles are appended. Order is not specified.
+  void GetOverlappedHandles(const DBounds3D<TValueType>& bounds, std::vector<THandle>& oHandles) const;
+
+  /// @brief Get all pairs of handles whose fat bounds overlap each other.
+  /// Each pair is found once, as (smaller handle, bigger handle).
+  /// @param oPairs Found pairs are appended. Order is not specified.
+  void GetOverlappedPairs(std::vector<std::pair<THandle, THandle>>& oPairs) const;
+
+private:
+  struct DNode final
+  {
+    /// Fat bounds when leaf, union of children when internal node.
+    DBounds3D<TValueType> mBounds;
+    /// Given bounds of leaf.
+    DBounds3D<TValueType> mLeafBounds;
+    TIndex mUserValue = 0;
+    /// Parent node when used, next free node when free.
+    TU32 mParent = kInvalidHandle;
+    TU32 mLeft   = kInvalidHandle;
+    TU32 mRight  = kInvalidHandle;
+    /// Height of node. Leaf is 0, and free node is -1.
+    TI32 mHeight = -1;
+
+    /// @brief Check node is leaf.
+    bool IsLeaf() const noexcept { return this->mLeft == kInvalidHandle; }
+  };
+
+  /// @brief Get free node, or new node if there is no free node.
+  TU32 pAllocateNode();
+  /// @brief Return node into free list.
+  void pFreeNode(TU32 index) noexcept;
+
+  /// @brief Insert leaf into the sibling which makes the smallest surface area increase.
+  void pInsertLeaf(TU32 leaf);
+  /// @brief Detach leaf from tree. Leaf node itself is not freed.
+  void pRemoveLeaf(TU32 leaf);
+  /// @brief Refit bounds and height from given node to root, with rebalancing.
+  void pRefitFrom(TU32 index);
+  /// @brief Rotate subtree of given node if it is imbalanced, and return new root of subtree.
+  TU32 pBalance(TU32 index);
+
+  std::vector<DNode> mNodes;
+  TU32 mRoot      = kInvalidHandle;
+  TU32 mFreeList  = kInvalidHandle;
+  TIndex mCount   = 0;
+  TValueType mMargin;
+};
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/DDynamicBoundsTree/DDynamicBoundsTree.inl>
@@ -0,0 +1,243 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <array>
+#include <type_traits>
+#include <Math/Common/TGlobalTypes.h>
+
+namespace dy::math::details
+{
+
+template <typename TEngine, typename = void>
+struct TIsRandomEngine : std::false_type {};
+
+template <typename TEngine>
+struct TIsRandomEngine<TEngine, std::void_t<
+    typename TEngine::result_type,
+    decltype(TEngine::min()),
+    decltype(TEngine::max()),
+    decltype(std::declval<TEngine&>()())>>
+  : std::is_unsigned<typename TEngine::result_type> {};
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+//!
+//! Random bit engines. All engines satisfy `UniformRandomBitGenerator`, so they can be used with
+//! `std` distributions, and also with random functions of `XRandom.h` which have engine parameter.
+//! Engines are not thread-safe, but do not have any shared state.
+//!
+
+/// @class DSplitMix64
+/// @brief SplitMix64 engine. 8 bytes state, and each output is just one add and mix.
+/// Good to seed other engines, and to hash counters.
+/// @reference http://prng.di.unimi.it/splitmix64.c
+class DSplitMix64 final
+{
+public:
+  using result_type = TU64;
+
+  explicit DSplitMix64(TU64 seed = 0) noexcept;
+  /// @brief Reset sequence with given seed.
+  void Seed(TU64 seed) noexcept;
+
+  static constexpr result_type min() noexcept { return kMinValueOf<result_type>; }
+  static constexpr result_type max() noexcept { return kMaxValueOf<result_type>; }
+  /// @brief Get next random bits.
+  result_type operator()() noexcept;
+
+private:
+  TU64 mState = 0;
+};
+
+/// @class DPcg32
+/// @brief PCG32 (XSH-RR 64/32) engine. 16 bytes state, period 2^64 of each stream,
+/// and 2^63 streams which are selected by `stream` of same seed.
+/// @reference https://www.pcg-random.org/
+class DPcg32 final
+{
+public:
+  using result_type = TU32;
+
+  explicit DPcg32(TU64 seed = 0, TU64 stream = 0) noexcept;
+  /// @brief Reset sequence with given seed and stream.
+  void Seed(TU64 seed, TU64 stream = 0) noexcept;
+  /// @brief Skip `count` values in O(log count).
+  void Discard(TU64 count) noexcept;
+
+  static constexpr result_type min() noexcept { return kMinValueOf<result_type>; }
+  static constexpr result_type max() noexcept { return kMaxValueOf<result_type>; }
+  /// @brief Get next random bits.
+  result_type operator()() noexcept;
+
+private:
+  TU64 mState = 0;
+  TU64 mIncrement = 1;
+};
+
+/// @class DXoshiro256StarStar
+/// @brief xoshiro256** engine. 32 bytes state, period 2^256 - 1, and fast 64-bit output.
+/// State is seeded from 64-bit seed with SplitMix64.
+/// @reference http://prng.di.unimi.it/xoshiro256starstar.c
+class DXoshiro256StarStar final
+{
+public:
+  using result_type = TU64;
+
+  explicit DXoshiro256StarStar(TU64 seed = 0) noexcept;
+  /// @brief Reset sequence with given seed.
+  void Seed(TU64 seed) noexcept;
+  /// @brief Skip 2^128 values. Calling this `n` times on copies of one engine makes 2^128 non-overlapping substreams.
+  void Jump() noexcept;
+  /// @brief Skip 2^192 values, to make 2^64 groups of substreams of `Jump`.
+  void LongJump() noexcept;
+
+  static constexpr result_type min() noexcept { return kMinValueOf<result_type>; }
+  static constexpr result_type max() noexcept { return kMaxValueOf<result_type>; }
+  /// @brief Get next random bits.
+  result_type operator()() noexcept;
+
+private:
+  TU64 mState[4] = {};
+};
+
+/// @class DPhilox4x32
+/// @brief Philox4x32-10 counter-based engine. Each block of 4 values is made only from (seed, stream, block number),
+/// so value of any position can be got directly without previous values, and streams of same seed are independent.
+/// Parallel jobs which use stream of job index (not of thread) make same values regardless of thread count
+/// and scheduling. Each stream has 2^64 values.
+/// @reference Salmon et al., Parallel random numbers: as easy as 1, 2, 3 (SC 2011)
+class DPhilox4x32 final
+{
+public:
+  using result_type = TU32;
+  using TBlock = std::array<TU32, 4>;
+
+  explicit DPhilox4x32(TU64 seed = 0, TU64 stream = 0) noexcept;
+  /// @brief Reset sequence with given seed and stream, and move to the first value.
+  void Seed(TU64 seed, TU64 stream = 0) noexcept;
+  /// @brief Skip `count` values in O(1).
+  void Discard(TU64 count) noexcept;
+  /// @brief Move to value of given position of stream in O(1).
+  void SetPosition(TU64 position) noexcept;
+  /// @brief Get position of next value.
+  TU64 GetPosition() const noexcept;
+
+  static constexpr result_type min() noexcept { return kMinValueOf<result_type>; }
+  static constexpr result_type max() noexcept { return kMaxValueOf<result_type>; }
+  /// @brief Get next random bits.
+  result_type operator()() noexcept;
+
+  /// @brief Get 4 values of `block`-th block of stream, which are values of position `[4 block, 4 block + 4)`.
+  static TBlock GetBlockOf(TU64 seed, TU64 stream, TU64 block) noexcept;
+
+private:
+  TU64 mSeed = 0;
+  TU64 mStream = 0;
+  TU64 mPosition = 0;
+  TBlock mBlock = {};
+};
+
+/// @class DRandomEngine
+/// @brief Default random engine, which is owned by one caller or one thread (`GetThreadRandomEngine`).
+/// Uses xoshiro256**.
+///
+/// Default constructed engine is seeded from global seed (`SetRandomSeed`) and new sequence number,
+/// so each engine (each thread engine of `GetThreadRandomEngine`) gets different sequence.
+class DRandomEngine final
+{
+public:
+  using result_type = DXoshiro256StarStar::result_type;
+
+  /// @brief Seed from global seed and next sequence number.
+  DRandomEngine();
+  /// @brief Seed from given seed. Engines with same seed make same sequence.
+  explicit DRandomEngine(TU64 seed) noexcept;
+  /// @brief Seed from given seed and stream (e.g. index of job), which are mixed into one seed.
+  /// Engines of different streams make different sequences, and do not depend on thread which creates them.
+  DRandomEngine(TU64 seed, TU64 stream) noexcept;
+
+  /// @brief Reset sequence with given seed.
+  void Seed(TU64 seed) noexcept;
+
+  static constexpr result_type min() noexcept { return DXoshiro256StarStar::min(); }
+  static constexpr result_type max() noexcept { return DXoshiro256StarStar::max(); }
+  /// @brief Get next random bits.
+  result_type operator()() noexcept;
+
+private:
+  DXoshiro256StarStar mGenerator;
+};
+
+/// @class DRandomLaneEngine
+/// @brief `kLanes` independent xoshiro128** streams, of which states are stored per lane (SoA).
+/// Each call makes 32 random bits of all lanes with same instructions, so bulk functions
+/// (`FillUniform` and others) are compiled into SIMD integer operations.
+/// xoshiro128** only needs add, xor and shifts, which all instruction sets have.
+/// @reference http://prng.di.unimi.it/xoshiro128starstar.c
+class DRandomLaneEngine final
+{
+public:
+  /// @brief The number of streams.
+  static constexpr TIndex kLanes = 16;
+
+  /// @brief Seed from global seed and next sequence number, same to `DRandomEngine`.
+  DRandomLaneEngine();
+  /// @brief Seed lanes from given seed with SplitMix64.
+  explicit DRandomLaneEngine(TU64 seed) noexcept;
+  /// @brief Seed from given seed and stream (e.g. index of job), same to `DRandomEngine`.
+  DRandomLaneEngine(TU64 seed, TU64 stream) noexcept;
+
+  /// @brief Reset sequence of all lanes with given seed.
+  void Seed(TU64 seed) noexcept;
+
+  /// @brief Write next random bits of each lane into `oBits`, which must have `kLanes` values.
+  void Next(TU32* oBits) noexcept;
+
+private:
+  alignas(64) TU32 mStates[4][kLanes] = {};
+};
+
+/// @brief Check given type can be used as engine of random functions.
+template <typename TEngine>
+constexpr bool kIsRandomEngine = details::TIsRandomEngine<TEngine>::value;
+
+//!
+//! Reproducible parallel random values. Default constructed engines and engines of threads get
+//! sequences in order of creation, so values depend on thread count and scheduling.
+//! To make same values regardless of threads, give each job own engine of `(seed, job index)`,
+//! with `DPhilox4x32`, or `DRandomEngine` and `DRandomLaneEngine` of stream.
+//!
+
+/// @brief Set global seed, and reset sequence number of engines which are created after this call.
+/// Engines of calling thread (`GetThreadRandomEngine`, `GetThreadRandomLaneEngine`) are also reseeded
+/// with the first sequences, but engines of other threads are not.
+/// To reproduce values of single thread, call this before any random function.
+void SetRandomSeed(TU64 seed) noexcept;
+
+/// @brief Get global seed. When `SetRandomSeed` is not called, seed is from `std::random_device` and clock.
+TU64 GetRandomSeed() noexcept;
+
+/// @brief Get engine of calling thread, which is created when thread uses it first.
+/// Random functions without engine parameter use this engine.
+DRandomEngine& GetThreadRandomEngine() noexcept;
+
+/// @brief Get lane engine of calling thread, which is created when thread uses it first.
+/// Bulk functions without engine parameter use this engine.
+DRandomLaneEngine& GetThreadRandomLaneEngine() noexcept;
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/Micellanous/DRandomEngine.inl>
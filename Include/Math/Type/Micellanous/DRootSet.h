@@ -0,0 +1,94 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+
+#include <array>
+#include <initializer_list>
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Common/XGlobalMacroes.h>
+
+namespace dy::math
+{
+
+/// @struct DRootSet
+/// @brief Fixed-capacity inline container of root values (e.g. 't' values of ray intersection).
+/// This type never allocates heap memory, so it can be used instead of `std::vector` in hot path.
+/// Container-like member functions follow the name of standard containers,
+/// so range-based for loop and algorithms of `<algorithm>` can be used.
+/// @tparam TType Real type.
+/// @tparam TCapacity Maximum number of values.
+template <typename TType, TIndex TCapacity>
+struct MATH_NODISCARD DRootSet final
+{
+  static_assert(kIsRealType<TType> == true, "DRootSet only supports real type.");
+  static_assert(TCapacity > 0, "DRootSet must have at least one capacity.");
+
+  using TValueType      = TType;
+  using value_type      = TType;
+  using size_type       = TIndex;
+  using reference       = TType&;
+  using const_reference = const TType&;
+  using iterator        = TType*;
+  using const_iterator  = const TType*;
+  static constexpr TIndex kCapacity = TCapacity;
+
+  DRootSet() = default;
+  DRootSet(std::initializer_list<TValueType> list) noexcept;
+
+  /// @brief Convert from other capacity set. Given set size must be equal or less than kCapacity.
+  template <TIndex TOtherCapacity>
+  explicit DRootSet(const DRootSet<TValueType, TOtherCapacity>& other) noexcept;
+
+  /// @brief Insert value at the end. Size must be less than capacity.
+  void push_back(TValueType value) noexcept;
+  /// @brief Insert value at the end. Size must be less than capacity.
+  void emplace_back(TValueType value) noexcept;
+  /// @brief Remove all values. Capacity is not changed.
+  void clear() noexcept;
+  /// @brief Erase [first, end()). Used with `std::remove_if`.
+  iterator erase(const_iterator first, const_iterator last) noexcept;
+
+  /// @brief Sort values in ascending order with insertion sort.
+  /// The order of result is same to `std::sort` of small range, which also uses insertion sort.
+  void Sort() noexcept;
+
+  /// @brief Get the number of values.
+  TIndex size() const noexcept;
+  /// @brief Check set is empty.
+  bool empty() const noexcept;
+  /// @brief Get capacity of set.
+  static constexpr TIndex capacity() noexcept { return TCapacity; }
+
+  TValueType& operator[](TIndex index) noexcept;
+  const TValueType& operator[](TIndex index) const noexcept;
+  /// @brief Get first value. Set must not be empty.
+  const TValueType& front() const noexcept;
+  /// @brief Get last value. Set must not be empty.
+  const TValueType& back() const noexcept;
+
+  TValueType* data() noexcept;
+  const TValueType* data() const noexcept;
+  iterator begin() noexcept;
+  iterator end() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  std::array<TValueType, TCapacity> __mValues = {};
+  TIndex __mSize = 0;
+};
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/Micellanous/DRootSet.inl>
@@ -0,0 +1,165 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <vector>
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Type/Math/DVector3.h>
+#include <Math/Type/Micellanous/DAlignedAllocator.h>
+#include <Math/Type/Micellanous/DBounds3D.h>
+#include <Math/Type/Micellanous/DSdfScene.h>
+
+namespace dy::math
+{
+
+/// @class DSdfBrickGrid
+/// @tparam TType Real type.
+/// @brief Signed distance field which is baked from DSdfScene into sparse grid of bricks.
+///
+/// Domain is divided into bricks of `kBrickCells`^3 cells. Only bricks near the surface (narrow band)
+/// have `kBrickSamples`^3 samples, and samples of border are shared with neighbor bricks,
+/// so trilinear lookup reads one brick only. Other bricks have one conservative value, of which magnitude is
+/// not bigger than SDF value of any point in the brick. Bricks outside of bounds of scene are found with DBounds3D
+/// and not evaluated at all.
+///
+/// Allocated bricks are stored in morton order of brick coordinate, so neighbor bricks are near in memory.
+///
+/// All data is one flat blob (`GetData()`) without pointers, which can be written to file as it is
+/// and used again with `SetView` (e.g. memory-mapped file) or `Load`. Blob uses native byte order.
+template <typename TType>
+class DSdfBrickGrid final
+{
+public:
+  static_assert(kIsRealType<TType> == true, "DSdfBrickGrid only supports real type.");
+  using TValueType = TType;
+
+  /// @brief The number of cells of brick per axis.
+  static constexpr TIndex kBrickCells = 7;
+  /// @brief The number of samples of brick per axis.
+  static constexpr TIndex kBrickSamples = kBrickCells + 1;
+  /// @brief The number of samples of brick.
+  static constexpr TIndex kBrickSampleCount = kBrickSamples * kBrickSamples * kBrickSamples;
+  /// @brief Maximum number of bricks per axis, to make morton code of brick coordinate.
+  static constexpr TIndex kMaxBrickCount = 1024;
+  /// @brief Slot value of brick which does not have samples.
+  static constexpr TU32 kEmptyBrick = kMaxValueOf<TU32>;
+
+  /// @brief Magic number of blob, `DYSB` in little endian.
+  static constexpr TU32 kMagic = 0x42535944u;
+  /// @brief Version of blob layout.
+  static constexpr TU32 kVersion = 1;
+
+  /// @struct DHeader
+  /// @brief Header of blob. Blob is `[header][slots][coarse values][samples]`, each aligned to 64 bytes.
+  struct DHeader final
+  {
+    TU32 mMagic = kMagic;
+    TU32 mVersion = kVersion;
+    /// `sizeof(TValueType)` of values.
+    TU32 mValueSize = sizeof(TValueType);
+    TU32 mBrickSamples = kBrickSamples;
+    /// The number of bricks of each axis.
+    TU32 mBrickCounts[3] = {};
+    /// The number of bricks which have samples.
+    TU32 mAllocatedCount = 0;
+    /// Position of the first sample.
+    TF64 mOrigin[3] = {};
+    /// Distance between samples.
+    TF64 mVoxelSize = 0;
+  };
+
+  DSdfBrickGrid() = default;
+  /// @brief Bake scene in `bounds`. See `Bake`.
+  DSdfBrickGrid(const DSdfScene<TValueType>& scene, const DBounds3D<TValueType>& bounds, TValueType voxelSize, TValueType bandWidth);
+
+  /// @brief Bake SDF of scene into bricks. Previous data is discarded.
+  /// @param bounds Region to bake. Points outside of region get value of the nearest point in region
+  /// plus distance to it.
+  /// @param voxelSize Distance between samples. Each axis of bounds must not have more than `kMaxBrickCount` bricks.
+  /// @param bandWidth Bricks which may have SDF value in `[-bandWidth, bandWidth]` get samples.
+  void Bake(const DSdfScene<TValueType>& scene, const DBounds3D<TValueType>& bounds, TValueType voxelSize, TValueType bandWidth);
+
+  /// @brief Copy blob into owned storage.
+  /// @return False when blob is not valid (magic, version, value type or size), and grid becomes empty.
+  bool Load(const void* data, TIndex size);
+  /// @brief Use blob without copy. Blob must be alive and must not be changed while grid uses it.
+  /// `data` must be aligned to `alignof(TValueType)`. Memory-mapped file is aligned to page.
+  /// @return False when blob is not valid (magic, version, value type or size), and grid becomes empty.
+  bool SetView(const void* data, TIndex size);
+
+  /// @brief Remove all data.
+  void Clear() noexcept;
+  /// @brief Check grid does not have data.
+  bool IsEmpty() const noexcept;
+
+  /// @brief Get blob of grid. `nullptr` when empty.
+  const void* GetData() const noexcept;
+  /// @brief Get byte size of blob.
+  TIndex GetDataSize() const noexcept;
+
+  /// @brief Get bounds of baked region.
+  DBounds3D<TValueType> GetBounds() const noexcept;
+  /// @brief Get distance between samples.
+  TValueType GetVoxelSize() const noexcept;
+  /// @brief Get the number of bricks of each axis.
+  DVector3<TU32> GetBrickCounts() const noexcept;
+  /// @brief Get the number of bricks which have samples.
+  TIndex GetAllocatedBrickCount() const noexcept;
+
+  /// @brief Get trilinear interpolated SDF value. Grid must not be empty.
+  /// Value in brick without samples is conservative value of brick.
+  TReal GetSDFValueOf(const DVector3<TValueType>& point) const noexcept;
+  /// @brief Get SDF value of each point, and write to `oValues` which must have `points.size()` values.
+  void GetSDFValuesOf(const DVector3Stream<TValueType>& points, TReal* oValues) const noexcept;
+  /// @brief Get gradient of trilinear interpolated SDF. Zero vector in brick without samples.
+  DVector3<TValueType> GetGradientOf(const DVector3<TValueType>& point) const noexcept;
+  /// @brief Get normalized gradient. Zero vector in brick without samples.
+  DVector3<TValueType> GetNormalOf(const DVector3<TValueType>& point) const noexcept;
+
+private:
+  /// @struct DCell
+  /// @brief Cell which has point, and local position of point in cell.
+  struct DCell final
+  {
+    /// First sample of cell, `nullptr` when brick does not have samples.
+    const TValueType* mSamples = nullptr;
+    /// Conservative value when brick does not have samples.
+    TValueType mValue = 0;
+    /// Position of point in cell, in [0, 1].
+    TValueType mLocal[3] = {};
+    /// Distance from point to baked region.
+    TValueType mOutside = 0;
+  };
+
+  /// @brief Validate blob and set offsets of it.
+  bool pSetData(const void* data, TIndex size);
+  /// @brief Get data of owned storage or view.
+  const TU8* pGetData() const noexcept;
+  /// @brief Find cell of point, clamped into baked region.
+  DCell pGetCellOf(const DVector3<TValueType>& point) const noexcept;
+
+  std::vector<TU8, DAlignedAllocator<TU8, 64>> mStorage;
+  const TU8* mView = nullptr;
+  TIndex mSize = 0;
+
+  /// Values of header which are used by lookup.
+  DVector3<TValueType> mOrigin;
+  TValueType mInvVoxelSize = 0;
+  TIndex mBrickCounts[3] = {};
+  TIndex mSlotOffset = 0;
+  TIndex mCoarseOffset = 0;
+  TIndex mSampleOffset = 0;
+};
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/DSdfScene/DSdfBrickGrid.inl>
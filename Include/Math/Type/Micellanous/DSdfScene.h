@@ -0,0 +1,195 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <variant>
+#include <vector>
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Common/TSimdTraits.h>
+#include <Math/Common/XGlobalMacroes.h>
+#include <Math/Type/Math/DVector3Stream.h>
+#include <Math/Type/Micellanous/DBounds3D.h>
+#include <Math/Type/Shape/DBox.h>
+#include <Math/Type/Shape/DCapsule.h>
+#include <Math/Type/Shape/DCone.h>
+#include <Math/Type/Shape/DPlane.h>
+#include <Math/Type/Shape/DSphere.h>
+#include <Math/Type/Shape/DTorus.h>
+
+MATH_SIMD_KERNEL_REGION_BEGIN
+
+namespace dy::math
+{
+
+/// @brief Shape types that can be primitive of DSdfScene. All shapes are in world-space.
+template <typename TType>
+using DSdfShape = std::variant<
+  DSphere<TType>,
+  DBox<TType>,
+  DCapsule<TType>,
+  DCone<TType>,
+  DTorus<TType>,
+  DPlane<TType>>;
+
+/// @enum ESdfOperation
+/// @brief Operation of two SDF nodes `a` (lhs) and `b` (rhs).
+enum class ESdfOperation
+{
+  Union,              // min(a, b)
+  Intersection,       // max(a, b)
+  Subtraction,        // max(a, -b), a without b.
+  SmoothUnion,        // Polynomial smooth minimum of a and b with smoothness k.
+  SmoothIntersection, // -SmoothUnion(-a, -b)
+  SmoothSubtraction,  // -SmoothUnion(-a, b)
+};
+
+/// @class DSdfScene
+/// @tparam TType Real type.
+/// @brief Scene graph of signed distance field, which combines shapes with ESdfOperation nodes.
+///
+/// Nodes are immutable and referred by id, so node can be child of many nodes.
+/// `SetRoot` compiles tree of root into postfix program, which is evaluated with small value stack.
+/// Child which needs deeper stack is evaluated first, so stack depth is `O(log n)` for balanced tree.
+///
+/// Each node has bounds of its inside region. When `b` of union-like operation is not needed
+/// because distance from point to bounds of `b` is already far enough, subtree of `b` is skipped. (Pruning)
+/// Distance to bounds is lower bound of exact SDF, so pruning does not change result except rounding error.
+/// Subtree which has DCone or DPlane is not pruned, because SDF of them is not exact distance or bounds is infinite.
+///
+/// When TType is `TF32` and SIMD kernels are enabled, `GetSDFValuesOf` evaluates program for points of SIMD width at once.
+/// Single point functions use same kernel with TSimdScalar, so results are same to each lane of SIMD version
+/// except for rounding error of pruning (applied only when all lanes can skip subtree) and of FMA contraction.
+template <typename TType>
+class DSdfScene final
+{
+public:
+  static_assert(kIsRealType<TType> == true, "DSdfScene only supports real type.");
+  using TValueType = TType;
+  using TShape = DSdfShape<TType>;
+  using TNodeId = TU32;
+
+  /// @brief Maximum stack depth of program. Tree which needs more stack can not be added.
+  static constexpr TIndex kMaxStackDepth = 32;
+
+  /// @enum EInstruction
+  /// @brief Instruction of compiled program.
+  enum class EInstruction : TU8
+  {
+    /// Push SDF value of primitive `mIndex`.
+    Shape,
+    /// Skip subtree of node `mIndex` to `mJump` if it does not change result of operation node `mOperation`.
+    Prune,
+    /// Pop two values and push result of operation node `mIndex`.
+    Operation,
+  };
+
+  /// @struct DInstruction
+  /// @brief One instruction of compiled program.
+  struct DInstruction final
+  {
+    EInstruction mType = EInstruction::Shape;
+    /// True when rhs of operation is evaluated before lhs, so lhs is on the top of stack.
+    bool mIsSwapped = false;
+    TU32 mIndex = 0;
+    TU32 mOperation = 0;
+    TU32 mJump = 0;
+  };
+
+  /// @struct DNode
+  /// @brief Shape or operation node.
+  struct DNode final
+  {
+    /// Bounds which covers region of negative SDF value. Infinite when unknown.
+    DBounds3D<TValueType> mBounds;
+    /// Smoothness `k` of smooth operation.
+    TValueType mSmoothness = 0;
+    /// Index of primitive when shape node, lhs node id when operation node.
+    TU32 mLhs = 0;
+    /// Rhs node id when operation node.
+    TU32 mRhs = 0;
+    /// Stack depth to evaluate node.
+    TU32 mStackDepth = 1;
+    ESdfOperation mOperation = ESdfOperation::Union;
+    bool mIsShape = true;
+    /// True when SDF value of node is not less than distance from outside point to `mBounds`.
+    bool mIsPrunable = false;
+  };
+
+  DSdfScene() = default;
+
+  /// @brief Add shape node, and return id of it.
+  TNodeId AddShape(const TShape& shape);
+  /// @brief Add operation node of two nodes, and return id of it.
+  /// @param smoothness Smoothness `k` of smooth operations, which must be positive. Ignored by others.
+  TNodeId AddOperation(ESdfOperation operation, TNodeId lhs, TNodeId rhs, TValueType smoothness = TValueType(0));
+
+  /// @brief Set root node of scene, and compile program of it.
+  void SetRoot(TNodeId root);
+  /// @brief Check scene has root.
+  bool HasRoot() const noexcept;
+  /// @brief Get root node id. Scene must have root.
+  TNodeId GetRoot() const noexcept;
+
+  /// @brief Remove all nodes and program.
+  void Clear() noexcept;
+
+  /// @brief Get the number of nodes.
+  TIndex GetNodeCount() const noexcept;
+  /// @brief Get node of id.
+  const DNode& GetNode(TNodeId id) const noexcept;
+  /// @brief Get compiled program of root.
+  const std::vector<DInstruction>& GetProgram() const noexcept;
+  /// @brief Get bounds which covers region of negative SDF value of root. Infinite when scene has no root.
+  DBounds3D<TValueType> GetBounds() const noexcept;
+
+  /// @brief Get signed distance value of scene from point. Scene without root returns `kMaxValueOf<TReal>`.
+  TReal GetSDFValueOf(const DVector3<TValueType>& point) const;
+  /// @brief Get signed distance value of each point, and write to `oValues` which must have `points.size()` values.
+  void GetSDFValuesOf(const DVector3Stream<TValueType>& points, TReal* oValues) const;
+
+  /// @brief Evaluate program for lanes of `TSimd` (SIMD wrapper or TSimdScalar) at once.
+  /// All lanes must skip subtree to prune it.
+  template <typename TSimd>
+  MATH_SIMD_INLINE typename TSimd::TReg GetSDFValueOf(
+    const typename TSimd::TReg& x,
+    const typename TSimd::TReg& y,
+    const typename TSimd::TReg& z) const;
+
+private:
+  /// @struct DPrimitive
+  /// @brief Shape which is converted for kernel. Meaning of `mOrigin` and `mParams` is different per shape.
+  struct DPrimitive final
+  {
+    DVector3<TValueType> mOrigin;
+    DVector3<TValueType> mParams;
+    TU32 mType = 0;
+  };
+
+  /// @brief Get SDF value of primitive for lanes of `TSimd`.
+  template <typename TSimd>
+  MATH_SIMD_INLINE static typename TSimd::TReg pGetSDFValueOf(
+    const DPrimitive& primitive,
+    const typename TSimd::TReg& x,
+    const typename TSimd::TReg& y,
+    const typename TSimd::TReg& z);
+
+  std::vector<DNode> mNodes;
+  std::vector<DPrimitive> mPrimitives;
+  std::vector<DInstruction> mProgram;
+  TNodeId mRoot = kMaxValueOf<TU32>;
+};
+
+} /// ::dy::math namespace
+
+MATH_SIMD_KERNEL_REGION_END
+#include <Math/Type/Inline/DSdfScene/DSdfScene.inl>
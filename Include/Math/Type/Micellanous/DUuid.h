@@ -12,24 +12,20 @@
 /// SOFTWARE.
 ///
 
+#include <array>
 #include <cstdint>
 #include <string>
+#include <type_traits>
 #include <Math/Common/XRttrEntry.h>
 
 #ifdef MATH_ENABLE_UUID
-namespace boost::uuids
-{
-
-struct uuid;
-
-} /// Forward declaration.
-
 namespace dy::math
 {
 
 /// @struct DUuid
 /// @brief UUID structure.
-/// This uses RAII to avoid build dependency of boost (so many files)
+/// 16 bytes of value are stored in the instance, so copy, move, comparison and hashing
+/// do not allocate and are same to those of 16 bytes. Only generation and string conversion use boost.
 struct DUuid final
 {
 public:
@@ -45,11 +41,14 @@ public:
   /// instead of printing error log.
   explicit DUuid(const std::string& iUuidString, bool iIsStrict = false);
 
-  DUuid(const DUuid& uuid);
-  DUuid& operator=(const DUuid& uuid);
-  DUuid(DUuid&& uuid) noexcept;
-  DUuid& operator=(DUuid&& uuid) noexcept; 
-  ~DUuid();
+  /// @brief Create uuid from 16 bytes of value, in order of string representation.
+  explicit DUuid(const std::array<uint8_t, 16>& iBytes) noexcept;
+
+  DUuid(const DUuid& uuid) = default;
+  DUuid& operator=(const DUuid& uuid) = default;
+  DUuid(DUuid&& uuid) noexcept = default;
+  DUuid& operator=(DUuid&& uuid) noexcept = default; 
+  ~DUuid() = default;
 
   typedef uint8_t value_type;
   typedef uint8_t& reference;
@@ -65,7 +64,7 @@ public:
   }
 
   /// @brief Check uuid has valid value.
-  [[nodiscard]] bool HasValue() const;
+  [[nodiscard]] bool HasValue() const noexcept;
 
   /// @brief Return value as string.
   std::string ToString() const;
@@ -77,12 +76,19 @@ public:
   const_iterator end() const noexcept;
 
 private:
-  boost::uuids::uuid* mUuid = nullptr;
+  /// @brief Get lower and upper 8 bytes of value.
+  uint64_t pGetLow() const noexcept;
+  uint64_t pGetHigh() const noexcept;
+
+  alignas(8) uint8_t mValue[16] = {};
 
   friend struct std::hash<::dy::math::DUuid>;
   friend bool operator==(const DUuid& lhs, const DUuid& rhs) noexcept;
 };
 
+static_assert(sizeof(DUuid) == 16, "DUuid must have only 16 bytes of value.");
+static_assert(std::is_trivially_copyable_v<DUuid> == true, "DUuid must be trivially copyable.");
+
 bool operator==(const DUuid& lhs, const DUuid& rhs) noexcept;
 bool operator!=(const DUuid& lhs, const DUuid& rhs) noexcept;
 
@@ -108,6 +114,7 @@ namespace dy::math
 DUuid CreateUuid();
 
 } /// ::dy::math namespace
+#include <Math/Type/Inline/Micellanous/DUuid.inl>
 
 #ifdef MATH_ENABLE_RTTR
 namespace dy::math
@@ -0,0 +1,77 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <Math/Common/TGlobalTypes.h>
+
+namespace dy::math
+{
+
+/// @class DWorkStealingPool
+/// @brief Fork-join task pool. Each worker has own task deque.
+/// Worker pushes and pops tasks at the back of own deque (LIFO, depth-first),
+/// and steals from the front of other deques when own deque is empty.
+///
+/// Threads only live while `Run` is called. Calling thread works as worker 0,
+/// so pool with 1 thread runs all tasks in calling thread without creating thread.
+class DWorkStealingPool final
+{
+public:
+  /// @brief Task type. Argument is index of worker which runs the task.
+  using TTask = std::function<void(TIndex)>;
+
+  /// @brief Create pool with given the number of workers.
+  /// If `threadCount` is 0, `std::thread::hardware_concurrency()` is used.
+  explicit DWorkStealingPool(TIndex threadCount = 0);
+
+  DWorkStealingPool(const DWorkStealingPool&) = delete;
+  DWorkStealingPool& operator=(const DWorkStealingPool&) = delete;
+
+  /// @brief Get the number of workers, including calling thread of `Run`.
+  TIndex GetThreadCount() const noexcept;
+
+  /// @brief Run given task and all tasks pushed from it, and wait until all tasks are done.
+  /// Tasks must not throw exception.
+  void Run(TTask task);
+
+  /// @brief Push task into the deque of given worker. Must be called from task in `Run`,
+  /// with worker index that is given to that task.
+  void Push(TIndex workerIndex, TTask task);
+
+private:
+  struct DQueue final
+  {
+    std::mutex mMutex;
+    std::deque<TTask> mTasks;
+  };
+
+  /// @brief Pop the newest task of own deque.
+  bool pTryPop(TIndex workerIndex, TTask& oTask);
+  /// @brief Steal the oldest task of other worker's deque.
+  bool pTrySteal(TIndex workerIndex, TTask& oTask);
+  /// @brief Work loop of worker until there is no pending task.
+  void pWork(TIndex workerIndex);
+
+  std::vector<std::unique_ptr<DQueue>> mQueues;
+  /// The number of tasks which is pushed but not finished yet.
+  std::atomic<TIndex> mPendingCount{0};
+};
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/Micellanous/DWorkStealingPool.inl>
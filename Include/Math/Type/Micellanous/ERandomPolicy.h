@@ -22,7 +22,7 @@ namespace dy::math
 enum class ERandomPolicy 
 {
   Uniform,  /// Follows uniform distribution.
-  Discrete, /// Follows discrete normal distribution.
+  Discrete, /// Follows normal distribution, clamped into range.
 };
 
 } /// ::dy::math namespace
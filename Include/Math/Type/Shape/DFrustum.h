@@ -0,0 +1,130 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <array>
+#include <Math/Common/XGlobalMacroes.h>
+#include <Math/Type/Math/DMatrix4.h>
+#include <Math/Type/Micellanous/DBounds3D.h>
+#include <Math/Type/Micellanous/EGraphics.h>
+#include <Math/Type/Shape/DBox.h>
+#include <Math/Type/Shape/DPlane.h>
+#include <Math/Type/Shape/DSphere.h>
+
+namespace dy::math
+{
+
+/// @enum EFrustumPlane
+/// @brief Plane index of DFrustum. Bit `i` of plane mask is plane `i`.
+enum class EFrustumPlane
+{
+  Left = 0,
+  Right,
+  Bottom,
+  Top,
+  Near,
+  Far,
+};
+
+/// @enum EFrustumTest
+/// @brief Result of testing volume with DFrustum.
+enum class EFrustumTest
+{
+  Outside,    // Volume is entirely outside of one plane.
+  Intersected,// Volume may cross planes. (Conservative)
+  Inside,     // Volume is entirely inside of all planes.
+};
+
+/// @struct DFrustum
+/// @tparam TType Real type.
+/// @brief View frustum of 6 planes, which is extracted from clip matrix such as `projection * view`.
+/// Normals of planes face to inside of frustum, so point `p` is inside when all `Dot(n, p) + d >= 0`.
+///
+/// Tests of volumes are conservative. Volume which is not culled may be outside of frustum near corners,
+/// but visible volume is never culled.
+template <typename TType>
+struct MATH_NODISCARD DFrustum final
+{
+  static_assert(kIsRealType<TType> == true, "DFrustum only supports real type.");
+  using TValueType = TType;
+
+  /// @brief The number of planes.
+  static constexpr TIndex kPlaneCount = 6;
+  /// @brief Plane mask which has all planes.
+  static constexpr TU32 kAllPlaneMask = (TU32(1) << kPlaneCount) - 1;
+
+  DFrustum() = default;
+  /// @brief Extract planes from clip matrix (Gribb & Hartmann) which transforms `(x, y, z, 1)` into clip space.
+  /// Both EMatMajor are supported, and `matrix * vector` is regarded as mathematical product.
+  /// @param graphics Clip depth range. `[-w, w]` of OpenGL, or `[0, w]` of DirectX.
+  template <EMatMajor TMajor>
+  explicit DFrustum(const DMatrix4<TValueType, TMajor>& matrix, EGraphics graphics = EGraphics::OpenGL);
+
+  /// @brief Get plane. Normal of plane faces to inside.
+  const DPlane<TValueType>& GetPlane(EFrustumPlane plane) const noexcept;
+  /// @brief Get all planes, in order of EFrustumPlane.
+  const std::array<DPlane<TValueType>, kPlaneCount>& GetPlanes() const noexcept;
+
+  /// @brief Check point is inside of frustum.
+  bool IsVisible(const DVector3<TValueType>& point) const noexcept;
+  /// @brief Check bounds is not culled. Infinite bounds is always visible.
+  bool IsVisible(const DBounds3D<TValueType>& bounds) const noexcept;
+  /// @brief Check sphere is not culled.
+  bool IsVisible(const DSphere<TValueType>& sphere) const noexcept;
+  /// @brief Check box is not culled.
+  bool IsVisible(const DBox<TValueType>& box) const noexcept;
+
+  /// @brief Test bounds with planes of `ioPlaneMask` only, for hierarchical culling.
+  /// Bits of planes that bounds is entirely inside of are cleared from `ioPlaneMask`,
+  /// so children of bounds do not need to test those planes again. (Plane masking)
+  /// @param ioLastPlane Plane that culled this volume last time, which is tested first (Plane coherency).
+  /// When volume is culled, culling plane is stored. Keep it per volume across frames.
+  /// @return `Inside` when `ioPlaneMask` becomes 0.
+  EFrustumTest Test(const DBounds3D<TValueType>& bounds, TU32& ioPlaneMask, TU32& ioLastPlane) const noexcept;
+  /// @brief Test sphere with planes of `ioPlaneMask` only, for hierarchical culling.
+  /// See `Test(bounds, ioPlaneMask, ioLastPlane)`.
+  EFrustumTest Test(const DSphere<TValueType>& sphere, TU32& ioPlaneMask, TU32& ioLastPlane) const noexcept;
+
+  /// @brief Cull `count` bounds, and write visibility bits into `oMasks`.
+  /// Bit `i % 32` of `oMasks[i / 32]` is set when `bounds[i]` is visible.
+  /// `oMasks` must have `(count + 31) / 32` elements, and unused bits of last element are cleared.
+  /// When TType is `TF32` and SIMD kernels are enabled, 6 planes are tested at once with SIMD lanes.
+  /// Results are same to `IsVisible` of each volume.
+  void GetVisibleMasksOf(const DBounds3D<TValueType>* bounds, TIndex count, TU32* oMasks) const noexcept;
+  /// @brief Cull `count` spheres, and write visibility bits into `oMasks`.
+  /// See `GetVisibleMasksOf(bounds, count, oMasks)`.
+  void GetVisibleMasksOf(const DSphere<TValueType>* spheres, TIndex count, TU32* oMasks) const noexcept;
+  /// @brief Cull `count` boxes, and write visibility bits into `oMasks`.
+  /// See `GetVisibleMasksOf(bounds, count, oMasks)`.
+  void GetVisibleMasksOf(const DBox<TValueType>* boxes, TIndex count, TU32* oMasks) const noexcept;
+
+private:
+  /// @brief Set plane and SIMD lanes of plane.
+  void pSetPlane(EFrustumPlane plane, const DVector4<TValueType>& coefficients);
+  /// @brief Cull `count` volumes. Radius of sphere is projected as it is, and others with `|n|` of plane.
+  template <bool TIsSphere, typename TVolume>
+  void pGetVisibleMasksOf(const TVolume* volumes, TIndex count, TU32* oMasks) const noexcept;
+
+  std::array<DPlane<TValueType>, kPlaneCount> mPlanes = {};
+
+  /// Planes as structure of arrays, padded to 8 lanes for SIMD kernels.
+  /// Padded lanes have zero normal and positive d, so they never cull.
+  alignas(32) std::array<TValueType, 8> mNormalX = {};
+  alignas(32) std::array<TValueType, 8> mNormalY = {};
+  alignas(32) std::array<TValueType, 8> mNormalZ = {};
+  alignas(32) std::array<TValueType, 8> mD = {TValueType(1), TValueType(1), TValueType(1), TValueType(1),
+                                              TValueType(1), TValueType(1), TValueType(1), TValueType(1)};
+};
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/XShape/DFrustum.inl>
@@ -0,0 +1,58 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+
+#include <array>
+#include <Math/Common/XGlobalMacroes.h>
+#include <Math/Type/Shape/DRay.h>
+
+namespace dy::math
+{
+
+/// @struct DRayPacket
+/// @tparam TType Real type.
+/// @tparam TLanes The number of rays in packet. Only 4, 8 and 16 are supported.
+/// @brief Fixed-size bundle of rays stored as structure of arrays (SoA).
+/// Each component array is aligned to 32 bytes, so SIMD kernels can load lanes directly.
+/// Direction of each ray is copied from DRay as it is, so normalized direction is kept.
+template <typename TType, TIndex TLanes>
+struct MATH_NODISCARD DRayPacket final
+{
+  static_assert(kIsRealType<TType> == true, "DRayPacket only supports real type.");
+  static_assert(TLanes == 4 || TLanes == 8 || TLanes == 16, "DRayPacket only supports 4, 8 and 16 lanes.");
+  using TValueType = TType;
+  static constexpr TIndex kLanes = TLanes;
+
+  DRayPacket() = default;
+  /// @brief Construct packet from `TLanes` rays.
+  explicit DRayPacket(const std::array<DRay<TValueType>, TLanes>& rays) noexcept;
+  /// @brief Construct packet from pointer of contiguous `TLanes` rays.
+  explicit DRayPacket(const DRay<TValueType>* pRays) noexcept;
+
+  /// @brief Set ray into given lane index.
+  void SetRay(TIndex index, const DRay<TValueType>& ray) noexcept;
+
+  /// @brief Get ray of given lane index.
+  DRay<TValueType> GetRay(TIndex index) const;
+
+  alignas(32) std::array<TValueType, TLanes> __mOriginX = {};
+  alignas(32) std::array<TValueType, TLanes> __mOriginY = {};
+  alignas(32) std::array<TValueType, TLanes> __mOriginZ = {};
+  alignas(32) std::array<TValueType, TLanes> __mDirectionX = {};
+  alignas(32) std::array<TValueType, TLanes> __mDirectionY = {};
+  alignas(32) std::array<TValueType, TLanes> __mDirectionZ = {};
+};
+
+} /// ::dy::math namespace
+#include <Math/Type/Inline/DRay/DRayPacket.inl>
@@ -16,13 +16,36 @@
 #include <vector>
 #include <Math/Common/TGlobalTypes.h>
 
+namespace dy::math::details
+{
+
+/// @brief Check two bounds overlap without epsilon. Touching bounds are overlapped.
+template <typename TType>
+bool IsBounds3DOverlapped(const DBounds3D<TType>& lhs, const DBounds3D<TType>& rhs) noexcept
+{
+  return lhs.__mMin.X <= rhs.__mMax.X && rhs.__mMin.X <= lhs.__mMax.X
+      && lhs.__mMin.Y <= rhs.__mMax.Y && rhs.__mMin.Y <= lhs.__mMax.Y
+      && lhs.__mMin.Z <= rhs.__mMax.Z && rhs.__mMin.Z <= lhs.__mMax.Z;
+}
+
+/// @brief Check `inner` is fully contained in `outer`. Touching bounds are contained.
+template <typename TType>
+bool IsBounds3DContained(const DBounds3D<TType>& outer, const DBounds3D<TType>& inner) noexcept
+{
+  return outer.__mMin.X <= inner.__mMin.X && inner.__mMax.X <= outer.__mMax.X
+      && outer.__mMin.Y <= inner.__mMin.Y && inner.__mMax.Y <= outer.__mMax.Y
+      && outer.__mMin.Z <= inner.__mMin.Z && inner.__mMax.Z <= outer.__mMax.Z;
+}
+
+} /// ::dy::math::details namespace
+
 namespace dy::math
 {
 
 template <typename TType>
 DBounds3D<TType> GetUnionOf(const DBounds3D<TType>& lhs, const DBounds3D<TType>& rhs)
 {
-  return {{lhs.GetMin(), lhs.GetMax(), rhs.GetMin(), rhs.GetMax()}};
+  return {ExtractMin(lhs.GetMin(), rhs.GetMin()), ExtractMax(lhs.GetMax(), rhs.GetMax())};
 }
 
 template <typename TType>
@@ -118,7 +141,7 @@ DBounds3D<TType> GetDBounds3DOf(const DBox<TType>& shape, const DMatrix3<TType,
 template <typename TType>
 DBounds3D<TType> GetDBounds3DOf(const DBox<TType>& shape, const DQuaternion<TType>& rot)
 {
-  return GetDBounds3DOf(shape, rot.ToMatrix3<EMatMajor::Column>());
+  return GetDBounds3DOf(shape, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
@@ -127,9 +150,9 @@ DBounds3D<TType> GetDBounds3DOf(const DTorus<TType>& shape)
   const auto dR = shape.GetDistance();
   const auto r  = shape.GetRadius();
   const auto& origin = shape.GetOrigin();
-  const auto offset = shape.GetOrigin() + DVector3<TType>{dR + r, dR + r, r};
+  const auto offset = DVector3<TType>{dR + r, r, dR + r};
 
-  return {origin + offset, origin - offset};
+  return {origin - offset, origin + offset};
 }
 
 template <typename TType, EMatMajor TMajor>
@@ -148,7 +171,7 @@ DBounds3D<TType> GetDBounds3DOf(const DTorus<TType>& shape, const DMatrix3<TType
 template <typename TType>
 DBounds3D<TType> GetDBounds3DOf(const DTorus<TType>& shape, const DQuaternion<TType>& rot)
 {
-  return GetDBounds3DOf(shape, rot.ToMatrix3<EMatMajor::Column>());
+  return GetDBounds3DOf(shape, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
@@ -177,7 +200,7 @@ DBounds3D<TType> GetDBounds3DOf(const DCone<TType>& shape, const DMatrix3<TType,
 template <typename TType>
 DBounds3D<TType> GetDBounds3DOf(const DCone<TType>& shape, const DQuaternion<TType>& rot)
 {
-  return GetDBounds3DOf(shape, rot.ToMatrix3<EMatMajor::Column>());
+  return GetDBounds3DOf(shape, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
@@ -206,7 +229,7 @@ DBounds3D<TType> GetDBounds3DOf(const DCapsule<TType>& shape, const DMatrix3<TTy
 template <typename TType>
 DBounds3D<TType> GetDBounds3DOf(const DCapsule<TType>& shape, const DQuaternion<TType>& rot)
 {
-  return GetDBounds3DOf(shape, rot.ToMatrix3<EMatMajor::Column>());
+  return GetDBounds3DOf(shape, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 } /// ::dy::math namespace
\ No newline at end of file
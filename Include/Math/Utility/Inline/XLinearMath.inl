@@ -18,31 +18,31 @@ namespace dy::math
 {
 
 template <typename TLeft, typename TRight>
-TReal Dot(const DVector2<TLeft>& lhs, const DVector2<TRight>& rhs) noexcept
+constexpr TReal Dot(const DVector2<TLeft>& lhs, const DVector2<TRight>& rhs) noexcept
 {
   return Cast<TReal>(lhs.X * rhs.X + lhs.Y * rhs.Y);
 }
 
 template <typename TLeft, typename TRight>
-TReal Dot(const DVector3<TLeft>& lhs, const DVector3<TRight>& rhs) noexcept
+constexpr TReal Dot(const DVector3<TLeft>& lhs, const DVector3<TRight>& rhs) noexcept
 {
   return Cast<TReal>(lhs.X * rhs.X + lhs.Y * rhs.Y + lhs.Z * rhs.Z);
 }
 
 template <typename TLeft, typename TRight>
-TReal Dot(const DVector4<TLeft>& lhs, const DVector4<TRight>& rhs) noexcept
+constexpr TReal Dot(const DVector4<TLeft>& lhs, const DVector4<TRight>& rhs) noexcept
 {
   return Cast<TReal>(lhs.X * rhs.X + lhs.Y * rhs.Y + lhs.Z * rhs.Z + lhs.W * rhs.W);
 }
 
 template <typename TLeft, typename TRight>
-TReal Dot(const DQuaternion<TLeft>& lhs, const DQuaternion<TRight>& rhs) noexcept
+constexpr TReal Dot(const DQuaternion<TLeft>& lhs, const DQuaternion<TRight>& rhs) noexcept
 {
   return Cast<TReal>(lhs.X() * rhs.X() + lhs.Y() * rhs.Y() + lhs.Z() * rhs.Z() + lhs.W() * rhs.W());
 }
 
 template <typename TLeft, typename TRight>
-DVector3<GetBiggerType<TLeft, TRight>> 
+constexpr DVector3<GetBiggerType<TLeft, TRight>> 
 Cross(const DVector3<TLeft>& lhs, const DVector3<TRight>& rhs) noexcept
 {
   // (0) X Y Z 
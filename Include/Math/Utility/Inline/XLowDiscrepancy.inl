@@ -0,0 +1,305 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <limits>
+
+namespace dy::math::details
+{
+
+/// @struct DSobolPolynomial
+/// @brief Primitive polynomial (degree and coefficients) and initial direction numbers of dimension.
+struct DSobolPolynomial final
+{
+  TU32 mDegree;
+  TU32 mCoefficients;
+  TU32 mInitials[7];
+};
+
+/// @brief Polynomials of dimensions from 1 (new-joe-kuo-6.21201). Dimension 0 is van der Corput sequence.
+constexpr DSobolPolynomial kSobolPolynomials[kSobolDimensionCount - 1] = {
+  {1, 0, {1}},                   {2, 1, {1, 3}},                {3, 1, {1, 3, 1}},
+  {3, 2, {1, 1, 1}},             {4, 1, {1, 1, 3, 3}},          {4, 4, {1, 3, 5, 13}},
+  {5, 2, {1, 1, 5, 5, 17}},      {5, 4, {1, 1, 5, 5, 5}},       {5, 7, {1, 1, 7, 11, 19}},
+  {5, 11, {1, 1, 5, 1, 1}},      {5, 13, {1, 1, 1, 3, 11}},     {5, 14, {1, 3, 5, 5, 31}},
+  {6, 1, {1, 3, 3, 9, 7, 49}},   {6, 13, {1, 1, 1, 15, 21, 21}}, {6, 16, {1, 3, 1, 13, 27, 49}},
+  {6, 19, {1, 1, 1, 15, 7, 5}},  {6, 22, {1, 3, 1, 15, 13, 25}}, {6, 25, {1, 1, 5, 5, 19, 61}},
+  {7, 1, {1, 3, 7, 11, 23, 15, 103}}, {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+};
+
+using TSobolMatrices = std::array<std::array<TU32, 32>, kSobolDimensionCount>;
+
+/// @brief Make direction numbers of each bit of index, as 0.32 fixed point.
+constexpr TSobolMatrices MakeSobolMatrices() noexcept
+{
+  TSobolMatrices matrices = {};
+  for (TU32 bit = 0; bit < 32; ++bit) { matrices[0][bit] = TU32(1) << (31 - bit); }
+
+  for (TU32 dim = 1; dim < kSobolDimensionCount; ++dim)
+  {
+    const auto& polynomial = kSobolPolynomials[dim - 1];
+    const TU32 degree = polynomial.mDegree;
+    auto& directions = matrices[dim];
+    for (TU32 bit = 0; bit < 32; ++bit)
+    {
+      if (bit < degree)
+      {
+        directions[bit] = polynomial.mInitials[bit] << (31 - bit);
+        continue;
+      }
+
+      TU32 value = directions[bit - degree] ^ (directions[bit - degree] >> degree);
+      for (TU32 k = 1; k < degree; ++k)
+      {
+        if ((polynomial.mCoefficients >> (degree - 1 - k)) & 1) { value ^= directions[bit - k]; }
+      }
+      directions[bit] = value;
+    }
+  }
+  return matrices;
+}
+
+using TSobolTables = std::array<std::array<std::array<TU32, 16>, 8>, kSobolDimensionCount>;
+
+/// @brief Make XOR of direction numbers of each 4 bits of index, so one point needs 8 lookups.
+constexpr TSobolTables MakeSobolTables() noexcept
+{
+  const TSobolMatrices matrices = MakeSobolMatrices();
+  TSobolTables tables = {};
+  for (TU32 dim = 0; dim < kSobolDimensionCount; ++dim)
+  {
+    for (TU32 nibble = 0; nibble < 8; ++nibble)
+    {
+      for (TU32 bits = 0; bits < 16; ++bits)
+      {
+        TU32 value = 0;
+        for (TU32 bit = 0; bit < 4; ++bit)
+        {
+          if ((bits >> bit) & 1) { value ^= matrices[dim][nibble * 4 + bit]; }
+        }
+        tables[dim][nibble][bits] = value;
+      }
+    }
+  }
+  return tables;
+}
+
+constexpr TSobolTables kSobolTables = MakeSobolTables();
+
+/// @brief Get coordinate of Sobol sequence as 0.32 fixed point.
+inline TU32 GetSobolBitsOf(TU32 index, TU32 dim) noexcept
+{
+  assert(dim < kSobolDimensionCount);
+  const auto& tables = kSobolTables[dim];
+  TU32 result = 0;
+  for (TU32 nibble = 0; nibble < 8; ++nibble) { result ^= tables[nibble][(index >> (nibble * 4)) & 0xF]; }
+  return result;
+}
+
+/// @brief Reverse order of bits.
+constexpr TU32 GetReversedBitsOf(TU32 value) noexcept
+{
+  value = ((value >> 1) & 0x55555555u) | ((value & 0x55555555u) << 1);
+  value = ((value >> 2) & 0x33333333u) | ((value & 0x33333333u) << 2);
+  value = ((value >> 4) & 0x0F0F0F0Fu) | ((value & 0x0F0F0F0Fu) << 4);
+  value = ((value >> 8) & 0x00FF00FFu) | ((value & 0x00FF00FFu) << 8);
+  return (value >> 16) | (value << 16);
+}
+
+/// @brief Hash-based nested uniform (Owen) scrambling of 0.32 fixed point value.
+/// Flip of each bit depends only on higher bits and seed, so hash is done on reversed bits,
+/// where multiplication carries lower bits into higher bits.
+/// @reference https://psychopath.io/post/2021_01_30_building_a_better_lk_hash
+constexpr TU32 GetOwenScrambledOf(TU32 value, TU32 seed) noexcept
+{
+  value = GetReversedBitsOf(value);
+  value ^= value * 0x3D20ADEAu;
+  value += seed;
+  value *= (seed >> 16) | 1;
+  value ^= value * 0x05526C56u;
+  value ^= value * 0x53A22864u;
+  return GetReversedBitsOf(value);
+}
+
+/// @brief Mix two values into seed of other dimension.
+constexpr TU32 GetCombinedSeedOf(TU32 seed, TU32 value) noexcept
+{
+  seed ^= value + 0x9E3779B9u + (seed << 6) + (seed >> 2);
+  seed ^= seed >> 16;
+  seed *= 0x7FEB352Du;
+  seed ^= seed >> 15;
+  seed *= 0x846CA68Bu;
+  return seed ^ (seed >> 16);
+}
+
+/// @brief Convert 0.32 fixed point into real in [0, 1).
+template <typename TType>
+TType GetRealOfFixed32(TU32 bits) noexcept
+{
+  if constexpr (std::is_same_v<TType, TF32> == true) { return static_cast<TF32>(bits >> 8) * (1.0f / 16777216.0f); }
+  else { return static_cast<TType>(bits) * static_cast<TType>(1.0 / 4294967296.0); }
+}
+
+/// @brief Convert 0.64 fixed point into real in [0, 1).
+template <typename TType>
+TType GetRealOfFixed64(TU64 bits) noexcept
+{
+  if constexpr (std::is_same_v<TType, TF32> == true) { return static_cast<TF32>(bits >> 40) * (1.0f / 16777216.0f); }
+  else { return static_cast<TType>(bits >> 11) * static_cast<TType>(1.0 / 9007199254740992.0); }
+}
+
+constexpr TU32 kHaltonPrimes[kHaltonDimensionCount] = {
+  2,   3,   5,   7,   11,  13,  17,  19,  23,  29,  31,  37,  41,  43,  47,  53,
+  59,  61,  67,  71,  73,  79,  83,  89,  97,  101, 103, 107, 109, 113, 127, 131,
+  137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223,
+  227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311,
+};
+
+/// @brief Get generalized golden ratio of dimensions, the positive root of `x^(d+1) = x + 1`.
+constexpr TF64 GetGeneralizedGoldenRatioOf(TU32 dimensions) noexcept
+{
+  TF64 x = 2;
+  for (TU32 iteration = 0; iteration < 32; ++iteration)
+  {
+    TF64 power = 1;
+    for (TU32 i = 0; i < dimensions; ++i) { power *= x; }
+    x -= (power * x - x - 1) / ((dimensions + 1) * power - 1);
+  }
+  return x;
+}
+
+/// @brief Make `alpha_i = 1 / phi^(i+1)` of each dimension as 0.64 fixed point.
+template <TU32 TDimensions>
+constexpr std::array<TU64, TDimensions> MakeRdAlphas() noexcept
+{
+  const TF64 inverse = 1.0 / GetGeneralizedGoldenRatioOf(TDimensions);
+  std::array<TU64, TDimensions> alphas = {};
+  TF64 alpha = 1;
+  for (TU32 dim = 0; dim < TDimensions; ++dim)
+  {
+    alpha *= inverse;
+    alphas[dim] = static_cast<TU64>(alpha * 18446744073709551616.0);
+  }
+  return alphas;
+}
+
+template <TU32 TDimensions>
+constexpr std::array<TU64, TDimensions> kRdAlphas = MakeRdAlphas<TDimensions>();
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+template <typename TType, typename>
+TType SobolSample(TU32 index, TU32 dim) noexcept
+{
+  return details::GetRealOfFixed32<TType>(details::GetSobolBitsOf(index, dim));
+}
+
+template <typename TType, typename>
+TType OwenSobolSample(TU32 index, TU32 dim, TU32 seed) noexcept
+{
+  // Index is scrambled with seed only, so all dimensions of one point use same Sobol point.
+  // Owen scrambling of index keeps each power of 2 of points from 0 as one block of Sobol points.
+  const TU32 shuffled = details::GetOwenScrambledOf(index, details::GetCombinedSeedOf(seed, 0xA511E9B3u));
+  const TU32 bits = details::GetSobolBitsOf(shuffled, dim);
+  return details::GetRealOfFixed32<TType>(details::GetOwenScrambledOf(bits, details::GetCombinedSeedOf(seed, dim)));
+}
+
+template <typename TType, typename>
+TType HaltonSample(TU32 index, TU32 dim) noexcept
+{
+  assert(dim < kHaltonDimensionCount);
+  if (dim == 0) { return details::GetRealOfFixed32<TType>(details::GetReversedBitsOf(index)); }
+
+  // Digits are reversed in integer, and divided once, so error is not accumulated.
+  const TU32 base = details::kHaltonPrimes[dim];
+  const TF64 inverseBase = 1.0 / base;
+  TU64 reversed = 0;
+  TF64 inverseScale = 1;
+  while (index != 0)
+  {
+    const TU32 next = index / base;
+    reversed = reversed * base + (index - next * base);
+    inverseScale *= inverseBase;
+    index = next;
+  }
+  constexpr TType kOneMinusEpsilon = TType(1) - std::numeric_limits<TType>::epsilon() / 2;
+  return std::min(static_cast<TType>(static_cast<TF64>(reversed) * inverseScale), kOneMinusEpsilon);
+}
+
+template <typename TType, TU32 TDimensions, typename>
+TType RdSample(TU32 index, TU32 dim) noexcept
+{
+  static_assert(TDimensions > 0, "R_d sequence must have at least one dimension.");
+  assert(dim < TDimensions);
+  constexpr TU64 kHalf = TU64(1) << 63;
+  return details::GetRealOfFixed64<TType>(kHalf + index * details::kRdAlphas<TDimensions>[dim]);
+}
+
+template <typename TType, typename>
+DVector2<TType> SobolVector2(TU32 index, TU32 dim) noexcept
+{
+  return {SobolSample<TType>(index, dim), SobolSample<TType>(index, dim + 1)};
+}
+
+template <typename TType, typename>
+DVector3<TType> SobolVector3(TU32 index, TU32 dim) noexcept
+{
+  return {SobolSample<TType>(index, dim), SobolSample<TType>(index, dim + 1), SobolSample<TType>(index, dim + 2)};
+}
+
+template <typename TType, typename>
+DVector2<TType> OwenSobolVector2(TU32 index, TU32 dim, TU32 seed) noexcept
+{
+  return {OwenSobolSample<TType>(index, dim, seed), OwenSobolSample<TType>(index, dim + 1, seed)};
+}
+
+template <typename TType, typename>
+DVector3<TType> OwenSobolVector3(TU32 index, TU32 dim, TU32 seed) noexcept
+{
+  return {
+    OwenSobolSample<TType>(index, dim, seed), 
+    OwenSobolSample<TType>(index, dim + 1, seed), 
+    OwenSobolSample<TType>(index, dim + 2, seed)};
+}
+
+template <typename TType, typename>
+DVector2<TType> HaltonVector2(TU32 index, TU32 dim) noexcept
+{
+  return {HaltonSample<TType>(index, dim), HaltonSample<TType>(index, dim + 1)};
+}
+
+template <typename TType, typename>
+DVector3<TType> HaltonVector3(TU32 index, TU32 dim) noexcept
+{
+  return {HaltonSample<TType>(index, dim), HaltonSample<TType>(index, dim + 1), HaltonSample<TType>(index, dim + 2)};
+}
+
+template <typename TType, typename>
+DVector2<TType> RdVector2(TU32 index) noexcept
+{
+  return {RdSample<TType, 2>(index, 0), RdSample<TType, 2>(index, 1)};
+}
+
+template <typename TType, typename>
+DVector3<TType> RdVector3(TU32 index) noexcept
+{
+  return {RdSample<TType, 3>(index, 0), RdSample<TType, 3>(index, 1), RdSample<TType, 3>(index, 2)};
+}
+
+} /// ::dy::math namespace
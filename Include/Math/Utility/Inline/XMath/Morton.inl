@@ -0,0 +1,39 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+namespace dy::math::details
+{
+
+/// @brief Spread lower 10 bits of value to every 3rd bit.
+constexpr TU32 ExpandMortonBitsOf(TU32 value) noexcept
+{
+  value &= 0x3FFu;
+  value = (value | (value << 16)) & 0x030000FFu;
+  value = (value | (value <<  8)) & 0x0300F00Fu;
+  value = (value | (value <<  4)) & 0x030C30C3u;
+  value = (value | (value <<  2)) & 0x09249249u;
+  return value;
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+constexpr TU32 GetMortonCodeOf(TU32 x, TU32 y, TU32 z) noexcept
+{
+  return (details::ExpandMortonBitsOf(x) << 2) | (details::ExpandMortonBitsOf(y) << 1) | details::ExpandMortonBitsOf(z);
+}
+
+} /// ::dy::math namespace
@@ -12,92 +12,661 @@
 /// SOFTWARE.
 ///
 
-#include <chrono>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
 #include <random>
 #include <Math/Utility/XMath.h>
 #include <Math/Common/XGlobalMacroes.h>
+#include <Math/Common/XSimdDispatch.h>
 
-namespace dy::math
+MATH_SIMD_KERNEL_REGION_BEGIN
+
+namespace dy::math::details
+{
+
+/// @brief Check engine makes all values of 32-bit or 64-bit, so bits can be used directly.
+template <typename TEngine>
+constexpr bool kIsFullRangeEngine = TEngine::min() == 0
+  && (TEngine::max() == kMaxValueOf<TU32> || TEngine::max() == kMaxValueOf<TU64>);
+
+/// @brief Get 32 random bits. 64-bit engine gives upper bits, which are better for some engines.
+template <typename TEngine>
+TU32 GetRandomBits32Of(TEngine& engine) noexcept
+{
+  if constexpr (TEngine::max() == kMaxValueOf<TU32>) { return static_cast<TU32>(engine()); }
+  else { return static_cast<TU32>(static_cast<TU64>(engine()) >> 32); }
+}
+
+/// @brief Get 64 random bits. 32-bit engine is called twice.
+template <typename TEngine>
+TU64 GetRandomBits64Of(TEngine& engine) noexcept
+{
+  if constexpr (TEngine::max() == kMaxValueOf<TU64>) { return static_cast<TU64>(engine()); }
+  else 
+  { 
+    const TU64 high = static_cast<TU32>(engine());
+    return (high << 32) | static_cast<TU32>(engine()); 
+  }
+}
+
+/// @brief Get uniform random integer in [0, span].
+template <typename TEngine>
+TU64 GetBoundedRandomOf(TEngine& engine, TU64 span) noexcept
+{
+  if (span < kMaxValueOf<TU32>)
+  {
+    // Lemire's method. High 32 bits of (bits * range) are in [0, range), and low 32 bits are checked
+    // to reject biased values. Division is needed only when low bits are less than range.
+    const TU32 range = static_cast<TU32>(span) + 1;
+    TU64 multiplied = TU64(GetRandomBits32Of(engine)) * range;
+    auto low = static_cast<TU32>(multiplied);
+    if (low < range)
+    {
+      const TU32 threshold = (0u - range) % range;
+      while (low < threshold)
+      {
+        multiplied = TU64(GetRandomBits32Of(engine)) * range;
+        low = static_cast<TU32>(multiplied);
+      }
+    }
+    return multiplied >> 32;
+  }
+  if (span == kMaxValueOf<TU32>) { return GetRandomBits32Of(engine); }
+  if (span == kMaxValueOf<TU64>) { return GetRandomBits64Of(engine); }
+
+  // Range over 32 bits, mask out bits which are higher than span and reject values over it.
+  // Acceptance rate is more than 1/2.
+  TU64 mask = span;
+  mask |= mask >> 1; mask |= mask >> 2; mask |= mask >> 4;
+  mask |= mask >> 8; mask |= mask >> 16; mask |= mask >> 32;
+  TU64 value = GetRandomBits64Of(engine) & mask;
+  while (value > span) { value = GetRandomBits64Of(engine) & mask; }
+  return value;
+}
+
+/// @brief Get uniform random real in [0, 1) from the highest 24 (TF32) or 53 (other) bits.
+template <typename TType, typename TEngine>
+TType GetUnitRandomOf(TEngine& engine) noexcept
+{
+  if constexpr (std::is_same_v<TType, TF32> == true)
+  {
+    return static_cast<TF32>(GetRandomBits32Of(engine) >> 8) * (1.0f / 16777216.0f);
+  }
+  else
+  {
+    return static_cast<TType>(static_cast<TF64>(GetRandomBits64Of(engine) >> 11) * (1.0 / 9007199254740992.0));
+  }
+}
+
+//!
+//! Kernels of bulk functions. Random bits of `DRandomLaneEngine` are converted with integer loops over lanes
+//! which compiler vectorizes, and `TF32` values are transformed with SIMD wrapper (or TSimdScalar) of
+//! `CallRandomKernel`, using polynomial `log`, `sin` and `cos`. Other real types use `std` functions.
+//!
+
+/// @brief Call `kernel(TSimd{})` in function of selected SIMD instruction set, so loops of it are compiled
+/// with that instruction set. Call it with `TSimdScalar<TF32>` when SIMD kernels are not compiled.
+template <typename TKernel>
+void CallRandomKernel(TKernel&& kernel)
+{
+#ifdef MATH_SIMD_KERNELS
+  if (DispatchSimdF32<DRandomLaneEngine::kLanes>([&kernel](auto simd) MATH_SIMD_INLINE { kernel(simd); }) == true) 
+  { 
+    return; 
+  }
+#endif
+  kernel(TSimdScalar<TF32>{});
+}
+
+/// @brief Write each chunk of `[0, count)` with `function(values)`, which fills `TValuesPerChunk` values
+/// into (unaligned) `values`. Last chunk is written into buffer, and only remained values are copied.
+template <TIndex TValuesPerChunk, typename TValue, typename TFunction>
+MATH_SIMD_INLINE inline void ForEachRandomChunk(TValue* oValues, TIndex count, TFunction&& function) noexcept
+{
+  TIndex i = 0;
+  for (; i + TValuesPerChunk <= count; i += TValuesPerChunk) { function(oValues + i); }
+  if (i < count)
+  {
+    alignas(64) TValue values[TValuesPerChunk];
+    function(values);
+    std::copy_n(values, count - i, oValues + i);
+  }
+}
+
+/// @brief Get real in [0, 1) from random bits. `TF32` uses the highest 24 bits.
+template <typename TType>
+TType GetUnitRealOfBits(TU32 bits) noexcept
+{
+  if constexpr (std::is_same_v<TType, TF32> == true) { return static_cast<TF32>(static_cast<TI32>(bits >> 8)) * (1.0f / 16777216.0f); }
+  else { return static_cast<TType>(bits) * static_cast<TType>(1.0 / 4294967296.0); }
+}
+
+/// @brief Write reals in [0, 1) of random bits of lanes.
+MATH_SIMD_INLINE inline void GetUnitRealsOfBits(const TU32* bits, TF32* oValues) noexcept
+{
+  for (TIndex lane = 0; lane < DRandomLaneEngine::kLanes; ++lane) { oValues[lane] = GetUnitRealOfBits<TF32>(bits[lane]); }
+}
+
+/// @brief Make reals `u` in (0, 1] from random bits, and split into `u = 2^e * m` where m in [sqrt(1/2), sqrt(2)).
+/// `log(u)` is got from them with `GetFastLogOf`.
+MATH_SIMD_INLINE inline void SplitLogArgumentsOf(const TU32* bits, TF32* oExponents, TF32* oMantissas) noexcept
+{
+  constexpr TU32 kSqrtHalfBits = 0x3F3504F3u;
+  for (TIndex lane = 0; lane < DRandomLaneEngine::kLanes; ++lane)
+  {
+    const TF32 u = static_cast<TF32>(static_cast<TI32>(bits[lane] >> 8) + 1) * (1.0f / 16777216.0f);
+    TU32 uBits;
+    std::memcpy(&uBits, &u, sizeof(uBits));
+    uBits -= kSqrtHalfBits;
+    oExponents[lane] = static_cast<TF32>(static_cast<TI32>(uBits) >> 23);
+
+    const TU32 mantissaBits = (uBits & 0x007FFFFFu) + kSqrtHalfBits;
+    std::memcpy(&oMantissas[lane], &mantissaBits, sizeof(mantissaBits));
+  }
+}
+
+/// @brief Get `e ln2 + log(m)` of `SplitLogArgumentsOf`, with absolute error less than 1e-6.
+/// log(m) = 2 atanh(s) where s = (m - 1) / (m + 1) is in [-0.172, 0.172].
+template <typename TSimd>
+MATH_SIMD_INLINE inline typename TSimd::TReg GetFastLogOf(typename TSimd::TReg exponent, typename TSimd::TReg mantissa) noexcept
 {
+  using S = TSimd;
+  const auto one = S::Set1(1.0f);
+  const auto s = S::Div(S::Sub(mantissa, one), S::Add(mantissa, one));
+  const auto s2 = S::Mul(s, s);
+  auto poly = S::Set1(2.0f / 9.0f);
+  poly = S::Add(S::Set1(2.0f / 7.0f), S::Mul(s2, poly));
+  poly = S::Add(S::Set1(2.0f / 5.0f), S::Mul(s2, poly));
+  poly = S::Add(S::Set1(2.0f / 3.0f), S::Mul(s2, poly));
+  poly = S::Add(S::Set1(2.0f), S::Mul(s2, poly));
+  return S::Add(S::Mul(exponent, S::Set1(0.69314718056f)), S::Mul(s, poly));
+}
 
-namespace details
+/// @brief Split angle `2 pi turn` of random bits into quadrant and offset `x` in [-pi/4, pi/4) from center of quadrant.
+/// `oSwaps` is 1 when sine and cosine are swapped by quadrant, and signs are -1 or 1.
+MATH_SIMD_INLINE inline void SplitTurnsOf(const TU32* bits, TF32* oOffsets, TF32* oSwaps, TF32* oSinSigns, TF32* oCosSigns) noexcept
 {
+  for (TIndex lane = 0; lane < DRandomLaneEngine::kLanes; ++lane)
+  {
+    // Highest 2 bits are quadrant, and next 22 bits are position in quadrant.
+    const auto quadrant = static_cast<TI32>(bits[lane] >> 30);
+    const auto position = static_cast<TI32>((bits[lane] >> 8) & 0x3FFFFF);
+    oOffsets[lane] = (static_cast<TF32>(position) * (1.0f / 4194304.0f) - 0.5f) * (kPi<TF32> / 2);
+    oSwaps[lane] = static_cast<TF32>(quadrant & 1);
+    oSinSigns[lane] = static_cast<TF32>(1 - (quadrant & 2));
+    oCosSigns[lane] = static_cast<TF32>(1 - ((quadrant + 1) & 2));
+  }
+}
+
+/// @brief Get sine and cosine of `SplitTurnsOf`, with error less than 1e-6.
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetFastSinCosOf(
+  typename TSimd::TReg x, typename TSimd::TReg swap, typename TSimd::TReg sinSign, typename TSimd::TReg cosSign,
+  typename TSimd::TReg& oSin, typename TSimd::TReg& oCos) noexcept
+{
+  using S = TSimd;
+  typename S::TReg sinX, cosX;
+  GetFastSinCosCoreOf<S>(x, sinX, cosX);
+
+  // sin and cos of (pi/4 + x), and rotate by quadrant.
+  const auto sqrtHalf = S::Set1(0.70710678118f);
+  const auto sinQ = S::Mul(S::Add(sinX, cosX), sqrtHalf);
+  const auto cosQ = S::Mul(S::Sub(cosX, sinX), sqrtHalf);
+  const auto isSwapped = S::CmpGt(swap, S::Set1(0.5f));
+  oSin = S::Mul(S::Select(isSwapped, cosQ, sinQ), sinSign);
+  oCos = S::Mul(S::Select(isSwapped, sinQ, cosQ), cosSign);
+}
 
-inline std::mt19937& GetRandomDevice() noexcept
+/// @struct DRandomAngleLanes
+/// @brief Angles of lanes which are split by `SplitTurnsOf`.
+struct DRandomAngleLanes final
 {
-  static std::random_device randomDevice;
-  static std::mt19937 rngGenerator(randomDevice());
+  alignas(64) TF32 mOffsets[DRandomLaneEngine::kLanes];
+  alignas(64) TF32 mSwaps[DRandomLaneEngine::kLanes];
+  alignas(64) TF32 mSinSigns[DRandomLaneEngine::kLanes];
+  alignas(64) TF32 mCosSigns[DRandomLaneEngine::kLanes];
+
+  MATH_SIMD_INLINE void Split(const TU32* bits) noexcept { SplitTurnsOf(bits, mOffsets, mSwaps, mSinSigns, mCosSigns); }
 
-  static bool isInitilaized = false;
-  if (isInitilaized == false)
+  template <typename TSimd>
+  MATH_SIMD_INLINE inline void GetSinCosOf(TIndex i, typename TSimd::TReg& oSin, typename TSimd::TReg& oCos) const noexcept
   {
-    rngGenerator.seed(
-      static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count()));
-    isInitilaized = true;
+    GetFastSinCosOf<TSimd>(
+      TSimd::Load(mOffsets + i), TSimd::Load(mSwaps + i), TSimd::Load(mSinSigns + i), TSimd::Load(mCosSigns + i),
+      oSin, oCos);
   }
+};
+
+template <typename TType>
+MATH_SIMD_INLINE inline void FillUniformRealsOf(DRandomLaneEngine& engine, TType* oValues, TIndex count, TType start, TType end) noexcept
+{
+  constexpr TIndex kLanes = DRandomLaneEngine::kLanes;
+  const TType scale = end - start;
+  ForEachRandomChunk<kLanes>(oValues, count, [&engine, start, scale](TType* values) MATH_SIMD_INLINE
+  {
+    alignas(64) TU32 bits[kLanes];
+    engine.Next(bits);
+    if constexpr (std::is_same_v<TType, TF32> == true)
+    {
+      for (TIndex lane = 0; lane < kLanes; ++lane) { values[lane] = start + scale * GetUnitRealOfBits<TF32>(bits[lane]); }
+    }
+    else
+    {
+      // 53 bits from two values.
+      alignas(64) TU32 lowBits[kLanes];
+      engine.Next(lowBits);
+      for (TIndex lane = 0; lane < kLanes; ++lane)
+      {
+        const TU64 value = ((TU64(bits[lane]) << 32) | lowBits[lane]) >> 11;
+        values[lane] = start + scale * static_cast<TType>(static_cast<TF64>(value) * (1.0 / 9007199254740992.0));
+      }
+    }
+  });
+}
 
-  return rngGenerator;
+template <typename TType>
+void FillUniformIntegersOf(DRandomLaneEngine& engine, TType* oValues, TIndex count, TType start, TType end) noexcept
+{
+  constexpr TIndex kLanes = DRandomLaneEngine::kLanes;
+  using TUnsigned = std::make_unsigned_t<TType>;
+  const TU64 span = static_cast<TUnsigned>(static_cast<TUnsigned>(end) - static_cast<TUnsigned>(start));
+
+  alignas(64) TU32 bits[kLanes];
+  TIndex nextLane = kLanes;
+  const auto getBits = [&]() 
+  {
+    if (nextLane == kLanes) { engine.Next(bits); nextLane = 0; }
+    return bits[nextLane++];
+  };
+
+  if (span < kMaxValueOf<TU32>)
+  {
+    // Lemire's method as `RandomUniformInteger`, but threshold is got once.
+    const TU32 range = static_cast<TU32>(span) + 1;
+    const TU32 threshold = (0u - range) % range;
+    for (TIndex i = 0; i < count; ++i)
+    {
+      TU64 multiplied = TU64(getBits()) * range;
+      while (static_cast<TU32>(multiplied) < threshold) { multiplied = TU64(getBits()) * range; }
+      oValues[i] = static_cast<TType>(static_cast<TUnsigned>(start) + static_cast<TUnsigned>(multiplied >> 32));
+    }
+  }
+  else
+  {
+    TU64 mask = span;
+    mask |= mask >> 1; mask |= mask >> 2; mask |= mask >> 4;
+    mask |= mask >> 8; mask |= mask >> 16; mask |= mask >> 32;
+    for (TIndex i = 0; i < count; ++i)
+    {
+      TU64 value;
+      do 
+      { 
+        const TU64 high = getBits();
+        value = ((high << 32) | getBits()) & mask; 
+      } while (value > span);
+      oValues[i] = static_cast<TType>(static_cast<TUnsigned>(static_cast<TUnsigned>(start) + value));
+    }
+  }
+}
+
+template <typename TSimd>
+MATH_SIMD_INLINE inline void FillNormalsOf(DRandomLaneEngine& engine, TF32* oValues, TIndex count, TF32 mean, TF32 deviation) noexcept
+{
+  using S = TSimd;
+  constexpr TIndex kLanes = DRandomLaneEngine::kLanes;
+  // Box-Muller transform makes two values from each pair of uniform values.
+  ForEachRandomChunk<kLanes * 2>(oValues, count, [&engine, mean, deviation](TF32* values) MATH_SIMD_INLINE
+  {
+    alignas(64) TU32 bits[kLanes];
+    alignas(64) TF32 exponents[kLanes];
+    alignas(64) TF32 mantissas[kLanes];
+    DRandomAngleLanes angles;
+    engine.Next(bits);
+    SplitLogArgumentsOf(bits, exponents, mantissas);
+    engine.Next(bits);
+    angles.Split(bits);
+
+    for (TIndex i = 0; i < kLanes; i += S::kLanes)
+    {
+      const auto log = GetFastLogOf<S>(S::Load(exponents + i), S::Load(mantissas + i));
+      const auto radius = S::Mul(S::Sqrt(S::Mul(S::Set1(-2.0f), log)), S::Set1(deviation));
+      typename S::TReg sin, cos;
+      angles.template GetSinCosOf<S>(i, sin, cos);
+      S::StoreU(values + i, S::Add(S::Set1(mean), S::Mul(radius, cos)));
+      S::StoreU(values + kLanes + i, S::Add(S::Set1(mean), S::Mul(radius, sin)));
+    }
+  });
+}
+
+template <typename TType>
+void FillNormalsOf(DRandomLaneEngine& engine, TType* oValues, TIndex count, TType mean, TType deviation) noexcept
+{
+  constexpr TIndex kLanes = DRandomLaneEngine::kLanes;
+  ForEachRandomChunk<kLanes * 2>(oValues, count, [&engine, mean, deviation](TType* values)
+  {
+    alignas(64) TU32 radiusBits[kLanes];
+    alignas(64) TU32 angleBits[kLanes];
+    engine.Next(radiusBits);
+    engine.Next(angleBits);
+    for (TIndex lane = 0; lane < kLanes; ++lane)
+    {
+      const TType u = TType(1) - GetUnitRealOfBits<TType>(radiusBits[lane]);
+      const TType radius = std::sqrt(TType(-2) * std::log(u)) * deviation;
+      const TType angle = GetUnitRealOfBits<TType>(angleBits[lane]) * k2Pi<TType>;
+      values[lane] = mean + radius * std::cos(angle);
+      values[kLanes + lane] = mean + radius * std::sin(angle);
+    }
+  });
+}
+
+template <typename TSimd>
+MATH_SIMD_INLINE inline void FillOnSphereOf(DRandomLaneEngine& engine, DVector3<TF32>* oValues, TIndex count, TF32 radius) noexcept
+{
+  using S = TSimd;
+  constexpr TIndex kLanes = DRandomLaneEngine::kLanes;
+  // Archimedes: z is uniform in [-1, 1], and angle around z is uniform.
+  ForEachRandomChunk<kLanes>(oValues, count, [&engine, radius](DVector3<TF32>* values) MATH_SIMD_INLINE
+  {
+    alignas(64) TU32 bits[kLanes];
+    alignas(64) TF32 heights[kLanes];
+    alignas(64) TF32 x[kLanes];
+    alignas(64) TF32 y[kLanes];
+    DRandomAngleLanes angles;
+    engine.Next(bits);
+    GetUnitRealsOfBits(bits, heights);
+    engine.Next(bits);
+    angles.Split(bits);
+
+    for (TIndex i = 0; i < kLanes; i += S::kLanes)
+    {
+      const auto z = S::Sub(S::Set1(1.0f), S::Mul(S::Set1(2.0f), S::Load(heights + i)));
+      const auto r = S::Mul(S::Sqrt(S::Max(S::Sub(S::Set1(1.0f), S::Mul(z, z)), S::Set1(0.0f))), S::Set1(radius));
+      typename S::TReg sin, cos;
+      angles.template GetSinCosOf<S>(i, sin, cos);
+      S::Store(x + i, S::Mul(r, cos));
+      S::Store(y + i, S::Mul(r, sin));
+      S::Store(heights + i, S::Mul(z, S::Set1(radius)));
+    }
+    for (TIndex lane = 0; lane < kLanes; ++lane) { values[lane] = DVector3<TF32>{x[lane], y[lane], heights[lane]}; }
+  });
+}
+
+template <typename TType>
+void FillOnSphereOf(DRandomLaneEngine& engine, DVector3<TType>* oValues, TIndex count, TType radius) noexcept
+{
+  constexpr TIndex kLanes = DRandomLaneEngine::kLanes;
+  ForEachRandomChunk<kLanes>(oValues, count, [&engine, radius](DVector3<TType>* values)
+  {
+    alignas(64) TU32 heightBits[kLanes];
+    alignas(64) TU32 angleBits[kLanes];
+    engine.Next(heightBits);
+    engine.Next(angleBits);
+    for (TIndex lane = 0; lane < kLanes; ++lane)
+    {
+      const TType z = TType(1) - TType(2) * GetUnitRealOfBits<TType>(heightBits[lane]);
+      const TType r = std::sqrt(std::max(TType(1) - z * z, TType(0))) * radius;
+      const TType angle = GetUnitRealOfBits<TType>(angleBits[lane]) * k2Pi<TType>;
+      values[lane] = DVector3<TType>{r * std::cos(angle), r * std::sin(angle), z * radius};
+    }
+  });
+}
+
+template <typename TSimd>
+MATH_SIMD_INLINE inline void FillInDiskOf(DRandomLaneEngine& engine, DVector2<TF32>* oValues, TIndex count, TF32 radius) noexcept
+{
+  using S = TSimd;
+  constexpr TIndex kLanes = DRandomLaneEngine::kLanes;
+  ForEachRandomChunk<kLanes>(oValues, count, [&engine, radius](DVector2<TF32>* values) MATH_SIMD_INLINE
+  {
+    alignas(64) TU32 bits[kLanes];
+    alignas(64) TF32 x[kLanes];
+    alignas(64) TF32 y[kLanes];
+    DRandomAngleLanes angles;
+    engine.Next(bits);
+    GetUnitRealsOfBits(bits, x);
+    engine.Next(bits);
+    angles.Split(bits);
+
+    for (TIndex i = 0; i < kLanes; i += S::kLanes)
+    {
+      const auto r = S::Mul(S::Sqrt(S::Load(x + i)), S::Set1(radius));
+      typename S::TReg sin, cos;
+      angles.template GetSinCosOf<S>(i, sin, cos);
+      S::Store(x + i, S::Mul(r, cos));
+      S::Store(y + i, S::Mul(r, sin));
+    }
+    for (TIndex lane = 0; lane < kLanes; ++lane) { values[lane] = DVector2<TF32>{x[lane], y[lane]}; }
+  });
+}
+
+template <typename TType>
+void FillInDiskOf(DRandomLaneEngine& engine, DVector2<TType>* oValues, TIndex count, TType radius) noexcept
+{
+  constexpr TIndex kLanes = DRandomLaneEngine::kLanes;
+  ForEachRandomChunk<kLanes>(oValues, count, [&engine, radius](DVector2<TType>* values)
+  {
+    alignas(64) TU32 radiusBits[kLanes];
+    alignas(64) TU32 angleBits[kLanes];
+    engine.Next(radiusBits);
+    engine.Next(angleBits);
+    for (TIndex lane = 0; lane < kLanes; ++lane)
+    {
+      const TType r = std::sqrt(GetUnitRealOfBits<TType>(radiusBits[lane])) * radius;
+      const TType angle = GetUnitRealOfBits<TType>(angleBits[lane]) * k2Pi<TType>;
+      values[lane] = DVector2<TType>{r * std::cos(angle), r * std::sin(angle)};
+    }
+  });
+}
+
+/// @brief Get normal distributed random value of which mean is center of range and deviation is 1/6 of range,
+/// clamped into [from, priorTo].
+template <typename TEngine>
+TReal GetRangedNormalRandomOf(TEngine& engine, TReal from, TReal priorTo) noexcept
+{
+  // Box-Muller transform. `u` is in (0, 1] so log is finite.
+  const TReal u = TReal(1) - GetUnitRandomOf<TReal>(engine);
+  const TReal v = GetUnitRandomOf<TReal>(engine);
+  const TReal normal = std::sqrt(TReal(-2) * std::log(u)) * std::cos(k2Pi<TReal> * v);
+  const TReal value = (from + priorTo) / 2 + normal * (priorTo - from) / 6;
+  return std::clamp(value, std::min(from, priorTo), std::max(from, priorTo));
 }
 
 } /// ::dy::math::details namespace
 
+namespace dy::math
+{
+
 template<typename TType, typename>
 TType RandomUniformInteger(TType start, TType inclusiveEnd) noexcept
 {
-  std::uniform_int_distribution<TType> dist{start, inclusiveEnd};
-  return dist(details::GetRandomDevice());
+  return RandomUniformInteger<TType>(GetThreadRandomEngine(), start, inclusiveEnd);
+}
+
+template<typename TType, typename TEngine, typename>
+TType RandomUniformInteger(TEngine& engine, TType start, TType inclusiveEnd) noexcept
+{
+  assert(start <= inclusiveEnd);
+  if constexpr (details::kIsFullRangeEngine<TEngine> == true)
+  {
+    using TUnsigned = std::make_unsigned_t<TType>;
+    const auto span = static_cast<TUnsigned>(static_cast<TUnsigned>(inclusiveEnd) - static_cast<TUnsigned>(start));
+    const auto offset = static_cast<TUnsigned>(details::GetBoundedRandomOf(engine, span));
+    return static_cast<TType>(static_cast<TUnsigned>(static_cast<TUnsigned>(start) + offset));
+  }
+  else
+  {
+    std::uniform_int_distribution<TType> dist{start, inclusiveEnd};
+    return dist(engine);
+  }
 }
 
 template <typename TType, typename>
-TF32 RandomUniformReal(TType start, TType end) noexcept
+TType RandomUniformReal(TType start, TType end) noexcept
 {
-  std::uniform_real_distribution<TType> dist{start, end};
-  return dist(details::GetRandomDevice());
+  return RandomUniformReal<TType>(GetThreadRandomEngine(), start, end);
+}
+
+template <typename TType, typename TEngine, typename>
+TType RandomUniformReal(TEngine& engine, TType start, TType end) noexcept
+{
+  if constexpr (details::kIsFullRangeEngine<TEngine> == true)
+  {
+    return start + (end - start) * details::GetUnitRandomOf<TType>(engine);
+  }
+  else
+  {
+    std::uniform_real_distribution<TType> dist{start, end};
+    return dist(engine);
+  }
 }
 
 template <typename TType, typename>
 void RandomUniformIntegers(
-  std::size_t iCount, std::vector<TType> oContainer, 
-  TType iStart, TType iInclusiveEnd) noexcept
+  std::size_t iCount, std::vector<TType>& oContainer, 
+  TType iStart, TType iInclusiveEnd)
 {
-  std::uniform_int_distribution<TType> dist{iStart, iInclusiveEnd};
-  auto& gen = details::GetRandomDevice();
-  for (TIndex i = 0; i < iCount; ++i)
+  const auto offset = oContainer.size();
+  oContainer.resize(offset + iCount);
+  FillUniform(oContainer.data() + offset, iCount, iStart, iInclusiveEnd);
+}
+
+template <typename TType, typename>
+void RandomUniformReals(
+  std::size_t iCount, std::vector<TType>& oContainer, 
+  TType iStart, TType iEnd)
+{
+  const auto offset = oContainer.size();
+  oContainer.resize(offset + iCount);
+  FillUniform(oContainer.data() + offset, iCount, iStart, iEnd);
+}
+
+template <typename TType, typename>
+void FillUniform(TType* oValues, TIndex count, TType start, TType end) noexcept
+{
+  FillUniform(GetThreadRandomLaneEngine(), oValues, count, start, end);
+}
+
+template <typename TType, typename>
+void FillUniform(DRandomLaneEngine& engine, TType* oValues, TIndex count, TType start, TType end) noexcept
+{
+  assert(start <= end);
+  if constexpr (kIsRealType<TType> == true)
   {
-    oContainer.emplace_back(dist(gen));
+    details::CallRandomKernel([&](auto) MATH_SIMD_INLINE { details::FillUniformRealsOf(engine, oValues, count, start, end); });
+  }
+  else
+  {
+    details::FillUniformIntegersOf(engine, oValues, count, start, end);
   }
 }
 
 template <typename TType, typename>
-void RandomUniformReals(
-  std::size_t iCount, std::vector<TType> oContainer, 
-  TType iStart, TType iEnd) noexcept
+void FillNormal(TType* oValues, TIndex count, TType mean, TType deviation) noexcept
+{
+  FillNormal(GetThreadRandomLaneEngine(), oValues, count, mean, deviation);
+}
+
+template <typename TType, typename>
+void FillNormal(DRandomLaneEngine& engine, TType* oValues, TIndex count, TType mean, TType deviation) noexcept
+{
+  if constexpr (std::is_same_v<TType, TF32> == true)
+  {
+    details::CallRandomKernel([&](auto simd) MATH_SIMD_INLINE 
+    { 
+      details::FillNormalsOf<decltype(simd)>(engine, oValues, count, mean, deviation); 
+    });
+  }
+  else
+  {
+    details::FillNormalsOf(engine, oValues, count, mean, deviation);
+  }
+}
+
+template <typename TType, typename>
+void FillOnSphere(DVector3<TType>* oValues, TIndex count, TReal radius) noexcept
+{
+  FillOnSphere(GetThreadRandomLaneEngine(), oValues, count, radius);
+}
+
+template <typename TType, typename>
+void FillOnSphere(DRandomLaneEngine& engine, DVector3<TType>* oValues, TIndex count, TReal radius) noexcept
+{
+  if constexpr (std::is_same_v<TType, TF32> == true)
+  {
+    details::CallRandomKernel([&](auto simd) MATH_SIMD_INLINE 
+    { 
+      details::FillOnSphereOf<decltype(simd)>(engine, oValues, count, static_cast<TF32>(radius)); 
+    });
+  }
+  else
+  {
+    details::FillOnSphereOf(engine, oValues, count, static_cast<TType>(radius));
+  }
+}
+
+template <typename TType, typename>
+void FillInDisk(DVector2<TType>* oValues, TIndex count, TReal radius) noexcept
 {
-  std::uniform_real_distribution<TType> dist{iStart, iEnd};
-  auto& gen = details::GetRandomDevice();
-  for (TIndex i = 0; i < iCount; ++i)
+  FillInDisk(GetThreadRandomLaneEngine(), oValues, count, radius);
+}
+
+template <typename TType, typename>
+void FillInDisk(DRandomLaneEngine& engine, DVector2<TType>* oValues, TIndex count, TReal radius) noexcept
+{
+  if constexpr (std::is_same_v<TType, TF32> == true)
+  {
+    details::CallRandomKernel([&](auto simd) MATH_SIMD_INLINE 
+    { 
+      details::FillInDiskOf<decltype(simd)>(engine, oValues, count, static_cast<TF32>(radius)); 
+    });
+  }
+  else
   {
-    oContainer.emplace_back(dist(gen));
+    details::FillInDiskOf(engine, oValues, count, static_cast<TType>(radius));
   }
 }
 
 template<typename TType, typename>
 DVector2<TType> RandomVector2Length(TReal length) noexcept
 {
-  const auto theta = RandomUniformReal<TType>(-kPi<TType>, kPi<TType>);
-  return {length * std::cos(theta), length * std::sin(theta)};
+  return RandomVector2Length<TType>(GetThreadRandomEngine(), length);
+}
+
+template<typename TType, typename TEngine, typename>
+DVector2<TType> RandomVector2Length(TEngine& engine, TReal length) noexcept
+{
+  // Engine of partial range (e.g. `std::minstd_rand`) is handled by `RandomUniformReal`.
+  TType sin, cos;
+  details::GetSinCosOfTurn<TSimdScalar<TType>>(RandomUniformReal<TType>(engine, TType(0), TType(1)), sin, cos);
+  return {static_cast<TType>(length) * cos, static_cast<TType>(length) * sin};
 }
 
 template<typename TType, typename>
 DVector3<TType> RandomVector3Length(TReal length) noexcept
 {
-  const auto theta = RandomUniformReal<TType>(-kPi<TType> / 2, kPi<TType> / 2);
-  const auto tho   = RandomUniformReal<TType>(-kPi<TType>, kPi<TType>);
+  return RandomVector3Length<TType>(GetThreadRandomEngine(), length);
+}
 
-  return {
-    length * std::cos(theta) * std::cos(tho), 
-    length * std::sin(theta), 
-    length * std::cos(theta) * std::sin(tho)};
+template<typename TType, typename TEngine, typename>
+DVector3<TType> RandomVector3Length(TEngine& engine, TReal length) noexcept
+{
+  DVector2<TType> sample;
+  if constexpr (details::kIsFullRangeEngine<TEngine> == true)
+  {
+    // Two samples from one 64-bit value. 
+    const TU64 bits = details::GetRandomBits64Of(engine);
+    sample = {
+      details::GetUnitRealOfBits<TType>(static_cast<TU32>(bits >> 32)), 
+      details::GetUnitRealOfBits<TType>(static_cast<TU32>(bits))};
+  }
+  else
+  {
+    sample.X = RandomUniformReal<TType>(engine, TType(0), TType(1));
+    sample.Y = RandomUniformReal<TType>(engine, TType(0), TType(1));
+  }
+  return SampleUniformSphere(sample) * static_cast<TType>(length);
 }
 
 template <typename TType, typename>
@@ -108,7 +677,7 @@ DVector2<TType> RandomVector2Range(ERandomPolicy policy, TReal from, TReal prior
   case ERandomPolicy::Uniform:
     return RandomVector2Length<TType>(1.f) * RandomUniformReal(from, priorTo);
   case ERandomPolicy::Discrete:
-    return {};
+    return RandomVector2Length<TType>(1.f) * details::GetRangedNormalRandomOf(GetThreadRandomEngine(), from, priorTo);
   default: M_ASSERT_OR_THROW(false, "Unexpected error occurred.");
   }
 }
@@ -121,10 +690,12 @@ DVector3<TType> RandomVector3Range(ERandomPolicy policy, TReal from, TReal prior
   case ERandomPolicy::Uniform:
     return RandomVector3Length<TType>(1.f) * RandomUniformReal(from, priorTo);
   case ERandomPolicy::Discrete:
-    return {};
+    return RandomVector3Length<TType>(1.f) * details::GetRangedNormalRandomOf(GetThreadRandomEngine(), from, priorTo);
   default: M_ASSERT_OR_THROW(false, "Unexpected error occurred.");
   }
 }
 
 
-} /// ::dy::math namespace
\ No newline at end of file
+} /// ::dy::math namespace
+
+MATH_SIMD_KERNEL_REGION_END
@@ -0,0 +1,407 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cmath>
+#include <type_traits>
+#include <Math/Common/XSimdDispatch.h>
+#include <Math/Utility/XMath.h>
+#include <Math/Utility/XStreamMath.h>
+
+MATH_SIMD_KERNEL_REGION_BEGIN
+
+namespace dy::math::details
+{
+
+//!
+//! Kernels of sampling functions are written with SIMD wrappers, and scalar functions call them with
+//! `TSimdScalar`, so scalar and batch functions give same result except for FMA contraction.
+//!
+
+/// @brief Get sine and cosine of x in [-pi/4, pi/4] with Taylor polynomials, with error less than 1e-6.
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetFastSinCosCoreOf(
+  typename TSimd::TReg x, typename TSimd::TReg& oSin, typename TSimd::TReg& oCos) noexcept
+{
+  using S = TSimd;
+  const auto x2 = S::Mul(x, x);
+  auto sinX = S::Set1(1.0f / 362880);
+  sinX = S::Add(S::Set1(-1.0f / 5040), S::Mul(x2, sinX));
+  sinX = S::Add(S::Set1(1.0f / 120), S::Mul(x2, sinX));
+  sinX = S::Add(S::Set1(-1.0f / 6), S::Mul(x2, sinX));
+  oSin = S::Mul(x, S::Add(S::Set1(1.0f), S::Mul(x2, sinX)));
+  auto cosX = S::Set1(1.0f / 40320);
+  cosX = S::Add(S::Set1(-1.0f / 720), S::Mul(x2, cosX));
+  cosX = S::Add(S::Set1(1.0f / 24), S::Mul(x2, cosX));
+  cosX = S::Add(S::Set1(-1.0f / 2), S::Mul(x2, cosX));
+  oCos = S::Add(S::Set1(1.0f), S::Mul(x2, cosX));
+}
+
+/// @brief Get sine and cosine of x in [-pi/4, pi/4]. Polynomial for `TF32`, and `std` functions for others.
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetSinCosOfSmallAngle(
+  typename TSimd::TReg x, typename TSimd::TReg& oSin, typename TSimd::TReg& oCos) noexcept
+{
+  if constexpr (std::is_same_v<typename TSimd::TValueType, TF32> == true) { GetFastSinCosCoreOf<TSimd>(x, oSin, oCos); }
+  else
+  {
+    oSin = std::sin(x);
+    oCos = std::cos(x);
+  }
+}
+
+/// @brief Get sine and cosine of angle `2 pi turn`, where turn is in [0, 1).
+/// `TF32` finds quadrant with comparisons, and rotates polynomial of offset from center of quadrant.
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetSinCosOfTurn(
+  typename TSimd::TReg turn, typename TSimd::TReg& oSin, typename TSimd::TReg& oCos) noexcept
+{
+  using S = TSimd;
+  using T = typename S::TValueType;
+  if constexpr (std::is_same_v<T, TF32> == false)
+  {
+    oSin = std::sin(turn * k2Pi<T>);
+    oCos = std::cos(turn * k2Pi<T>);
+  }
+  else
+  {
+    const auto zero = S::Set1(0.0f);
+    const auto one = S::Set1(1.0f);
+    const auto scaled = S::Mul(turn, S::Set1(4.0f));
+    const auto isOver1 = S::CmpGe(scaled, one);
+    const auto isOver2 = S::CmpGe(scaled, S::Set1(2.0f));
+    const auto isOver3 = S::CmpGe(scaled, S::Set1(3.0f));
+    const auto quadrant = S::Add(
+      S::Add(S::Select(isOver1, one, zero), S::Select(isOver2, one, zero)), 
+      S::Select(isOver3, one, zero));
+    const auto x = S::Mul(S::Sub(S::Sub(scaled, quadrant), S::Set1(0.5f)), S::Set1(kPi<TF32> / 2));
+
+    typename S::TReg sinX, cosX;
+    GetFastSinCosCoreOf<S>(x, sinX, cosX);
+    // sin and cos of (pi/4 + x), and rotate by quadrant.
+    // Quadrant 1 and 3 swap sine and cosine, sine is negative in 2 and 3, and cosine is negative in 1 and 2.
+    const auto sqrtHalf = S::Set1(0.70710678118f);
+    const auto sinQ = S::Mul(S::Add(sinX, cosX), sqrtHalf);
+    const auto cosQ = S::Mul(S::Sub(cosX, sinX), sqrtHalf);
+    const auto isSwapped = S::Or(S::AndNot(isOver2, isOver1), isOver3);
+    const auto sin = S::Select(isSwapped, cosQ, sinQ);
+    const auto cos = S::Select(isSwapped, sinQ, cosQ);
+    oSin = S::Select(isOver2, S::Neg(sin), sin);
+    oCos = S::Select(S::AndNot(isOver3, isOver1), S::Neg(cos), cos);
+  }
+}
+
+/// @brief Get point on unit circle of angle `2 pi turn`, of which height is `z`. 
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetPointOfHeight(
+  typename TSimd::TReg z, typename TSimd::TReg turn,
+  typename TSimd::TReg& oX, typename TSimd::TReg& oY) noexcept
+{
+  using S = TSimd;
+  using T = typename S::TValueType;
+  const auto radius = S::Sqrt(S::Max(S::Sub(S::Set1(T(1)), S::Mul(z, z)), S::Set1(T(0))));
+  typename S::TReg sin, cos;
+  GetSinCosOfTurn<S>(turn, sin, cos);
+  oX = S::Mul(radius, cos);
+  oY = S::Mul(radius, sin);
+}
+
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetUniformSphereOf(
+  typename TSimd::TReg u0, typename TSimd::TReg u1,
+  typename TSimd::TReg& oX, typename TSimd::TReg& oY, typename TSimd::TReg& oZ) noexcept
+{
+  using S = TSimd;
+  using T = typename S::TValueType;
+  oZ = S::Sub(S::Set1(T(1)), S::Mul(S::Set1(T(2)), u0));
+  GetPointOfHeight<S>(oZ, u1, oX, oY);
+}
+
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetUniformHemisphereOf(
+  typename TSimd::TReg u0, typename TSimd::TReg u1,
+  typename TSimd::TReg& oX, typename TSimd::TReg& oY, typename TSimd::TReg& oZ) noexcept
+{
+  using S = TSimd;
+  using T = typename S::TValueType;
+  oZ = S::Sub(S::Set1(T(1)), u0);
+  GetPointOfHeight<S>(oZ, u1, oX, oY);
+}
+
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetUniformConeOf(
+  typename TSimd::TReg u0, typename TSimd::TReg u1, typename TSimd::TReg cosThetaMax,
+  typename TSimd::TReg& oX, typename TSimd::TReg& oY, typename TSimd::TReg& oZ) noexcept
+{
+  using S = TSimd;
+  using T = typename S::TValueType;
+  const auto one = S::Set1(T(1));
+  oZ = S::Sub(one, S::Mul(u0, S::Sub(one, cosThetaMax)));
+  GetPointOfHeight<S>(oZ, u1, oX, oY);
+}
+
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetConcentricDiskOf(
+  typename TSimd::TReg u0, typename TSimd::TReg u1, typename TSimd::TReg& oX, typename TSimd::TReg& oY) noexcept
+{
+  using S = TSimd;
+  using T = typename S::TValueType;
+  // Square [-1, 1]^2 into disk. In the left and right quarters (|a| > |b|), r = a and angle = pi/4 b/a.
+  // In the others, r = b and angle = pi/2 - pi/4 a/b, so sine and cosine of pi/4 a/b are swapped.
+  const auto one = S::Set1(T(1));
+  const auto a = S::Sub(S::Mul(S::Set1(T(2)), u0), one);
+  const auto b = S::Sub(S::Mul(S::Set1(T(2)), u1), one);
+  const auto isHorizontal = S::CmpGt(S::Abs(a), S::Abs(b));
+  const auto radius = S::Select(isHorizontal, a, b);
+  const auto numerator = S::Select(isHorizontal, b, a);
+  const auto denominator = S::Select(S::CmpNeq(radius, S::Set1(T(0))), radius, one);
+  const auto angle = S::Mul(S::Div(numerator, denominator), S::Set1(kPi<T> / 4));
+
+  typename S::TReg sin, cos;
+  GetSinCosOfSmallAngle<S>(angle, sin, cos);
+  oX = S::Mul(radius, S::Select(isHorizontal, cos, sin));
+  oY = S::Mul(radius, S::Select(isHorizontal, sin, cos));
+}
+
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetCosineHemisphereOf(
+  typename TSimd::TReg u0, typename TSimd::TReg u1,
+  typename TSimd::TReg& oX, typename TSimd::TReg& oY, typename TSimd::TReg& oZ) noexcept
+{
+  using S = TSimd;
+  using T = typename S::TValueType;
+  // Malley's method.
+  GetConcentricDiskOf<S>(u0, u1, oX, oY);
+  const auto squared = S::Add(S::Mul(oX, oX), S::Mul(oY, oY));
+  oZ = S::Sqrt(S::Max(S::Sub(S::Set1(T(1)), squared), S::Set1(T(0))));
+}
+
+template <typename TSimd>
+MATH_SIMD_INLINE inline void GetUniformTriangleOf(
+  typename TSimd::TReg u0, typename TSimd::TReg u1, typename TSimd::TReg& oB0, typename TSimd::TReg& oB1) noexcept
+{
+  using S = TSimd;
+  using T = typename S::TValueType;
+  const auto half = S::Set1(T(0.5));
+  const auto halfU0 = S::Mul(u0, half);
+  const auto halfU1 = S::Mul(u1, half);
+  const auto isUpper = S::CmpGt(u1, u0);
+  oB0 = S::Select(isUpper, halfU0, S::Sub(u0, halfU1));
+  oB1 = S::Select(isUpper, S::Sub(u1, halfU0), halfU1);
+}
+
+/// @brief Write point of `kernel(simd, u0, u1, oX, oY, oZ)` of each sample into stream.
+template <typename TType, typename TKernel>
+void SampleStreamOf(
+  const TType* samples0, const TType* samples1, TIndex count, DVector3Stream<TType>& oPoints, TKernel&& kernel)
+{
+  oPoints.resize(count);
+  TType* x = oPoints.GetPlane(0);
+  TType* y = oPoints.GetPlane(1);
+  TType* z = oPoints.GetPlane(2);
+  ForEachStreamChunk<TType>(count,
+    [samples0, samples1, x, y, z, &kernel](auto simd, TIndex i) MATH_SIMD_INLINE
+    {
+      using S = decltype(simd);
+      typename S::TReg pointX, pointY, pointZ;
+      kernel(simd, S::LoadU(samples0 + i), S::LoadU(samples1 + i), pointX, pointY, pointZ);
+      S::Store(x + i, pointX);
+      S::Store(y + i, pointY);
+      S::Store(z + i, pointZ);
+    },
+    [samples0, samples1, x, y, z, &kernel](TIndex i) 
+    { 
+      kernel(TSimdScalar<TType>{}, samples0[i], samples1[i], x[i], y[i], z[i]); 
+    });
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+template <typename TType, typename>
+DVector3<TType> SampleUniformSphere(const DVector2<TType>& sample) noexcept
+{
+  DVector3<TType> result;
+  details::GetUniformSphereOf<TSimdScalar<TType>>(sample.X, sample.Y, result.X, result.Y, result.Z);
+  return result;
+}
+
+template <typename TType, typename>
+DVector3<TType> SampleUniformHemisphere(const DVector2<TType>& sample) noexcept
+{
+  DVector3<TType> result;
+  details::GetUniformHemisphereOf<TSimdScalar<TType>>(sample.X, sample.Y, result.X, result.Y, result.Z);
+  return result;
+}
+
+template <typename TType, typename>
+DVector3<TType> SampleCosineHemisphere(const DVector2<TType>& sample) noexcept
+{
+  DVector3<TType> result;
+  details::GetCosineHemisphereOf<TSimdScalar<TType>>(sample.X, sample.Y, result.X, result.Y, result.Z);
+  return result;
+}
+
+template <typename TType, typename>
+DVector2<TType> SampleUniformDisk(const DVector2<TType>& sample) noexcept
+{
+  DVector2<TType> result;
+  details::GetConcentricDiskOf<TSimdScalar<TType>>(sample.X, sample.Y, result.X, result.Y);
+  return result;
+}
+
+template <typename TType, typename>
+DVector3<TType> SampleUniformCone(const DVector2<TType>& sample, TReal cosThetaMax) noexcept
+{
+  DVector3<TType> result;
+  details::GetUniformConeOf<TSimdScalar<TType>>(
+    sample.X, sample.Y, static_cast<TType>(cosThetaMax), result.X, result.Y, result.Z);
+  return result;
+}
+
+template <typename TType, typename>
+DVector2<TType> SampleUniformTriangle(const DVector2<TType>& sample) noexcept
+{
+  DVector2<TType> result;
+  details::GetUniformTriangleOf<TSimdScalar<TType>>(sample.X, sample.Y, result.X, result.Y);
+  return result;
+}
+
+template <typename TType, typename>
+DVector3<TType> SampleUniformTriangle(
+  const DVector2<TType>& sample, 
+  const DVector3<TType>& p0, const DVector3<TType>& p1, const DVector3<TType>& p2) noexcept
+{
+  const auto barycentric = SampleUniformTriangle(sample);
+  return p2 + (p0 - p2) * barycentric.X + (p1 - p2) * barycentric.Y;
+}
+
+template <typename TType, typename>
+DVector3<TType> SampleUniformBounds(const DVector3<TType>& sample, const DBounds3D<TType>& bounds) noexcept
+{
+  const auto& min = bounds.GetMin();
+  const auto length = bounds.GetMax() - min;
+  return {min.X + sample.X * length.X, min.Y + sample.Y * length.Y, min.Z + sample.Z * length.Z};
+}
+
+template <typename TType, typename>
+void SampleUniformSpheres(const TType* samples0, const TType* samples1, TIndex count, DVector3Stream<TType>& oPoints)
+{
+  details::SampleStreamOf(samples0, samples1, count, oPoints, 
+    [](auto simd, auto u0, auto u1, auto& oX, auto& oY, auto& oZ) MATH_SIMD_INLINE
+    {
+      details::GetUniformSphereOf<decltype(simd)>(u0, u1, oX, oY, oZ);
+    });
+}
+
+template <typename TType, typename>
+void SampleUniformHemispheres(const TType* samples0, const TType* samples1, TIndex count, DVector3Stream<TType>& oPoints)
+{
+  details::SampleStreamOf(samples0, samples1, count, oPoints, 
+    [](auto simd, auto u0, auto u1, auto& oX, auto& oY, auto& oZ) MATH_SIMD_INLINE
+    {
+      details::GetUniformHemisphereOf<decltype(simd)>(u0, u1, oX, oY, oZ);
+    });
+}
+
+template <typename TType, typename>
+void SampleCosineHemispheres(const TType* samples0, const TType* samples1, TIndex count, DVector3Stream<TType>& oPoints)
+{
+  details::SampleStreamOf(samples0, samples1, count, oPoints, 
+    [](auto simd, auto u0, auto u1, auto& oX, auto& oY, auto& oZ) MATH_SIMD_INLINE
+    {
+      details::GetCosineHemisphereOf<decltype(simd)>(u0, u1, oX, oY, oZ);
+    });
+}
+
+template <typename TType, typename>
+void SampleUniformDisks(const TType* samples0, const TType* samples1, TIndex count, TType* oX, TType* oY) noexcept
+{
+  details::ForEachStreamChunk<TType>(count,
+    [samples0, samples1, oX, oY](auto simd, TIndex i) MATH_SIMD_INLINE
+    {
+      using S = decltype(simd);
+      typename S::TReg x, y;
+      details::GetConcentricDiskOf<S>(S::LoadU(samples0 + i), S::LoadU(samples1 + i), x, y);
+      S::StoreU(oX + i, x);
+      S::StoreU(oY + i, y);
+    },
+    [samples0, samples1, oX, oY](TIndex i) 
+    { 
+      details::GetConcentricDiskOf<TSimdScalar<TType>>(samples0[i], samples1[i], oX[i], oY[i]); 
+    });
+}
+
+template <typename TType, typename>
+void SampleUniformCones(
+  const TType* samples0, const TType* samples1, TIndex count, TReal cosThetaMax, 
+  DVector3Stream<TType>& oPoints)
+{
+  const auto cosine = static_cast<TType>(cosThetaMax);
+  details::SampleStreamOf(samples0, samples1, count, oPoints, 
+    [cosine](auto simd, auto u0, auto u1, auto& oX, auto& oY, auto& oZ) MATH_SIMD_INLINE
+    {
+      using S = decltype(simd);
+      details::GetUniformConeOf<S>(u0, u1, S::Set1(cosine), oX, oY, oZ);
+    });
+}
+
+template <typename TType, typename>
+void SampleUniformTriangles(
+  const TType* samples0, const TType* samples1, TIndex count,
+  const DVector3<TType>& p0, const DVector3<TType>& p1, const DVector3<TType>& p2,
+  DVector3Stream<TType>& oPoints)
+{
+  const auto edge0 = p0 - p2;
+  const auto edge1 = p1 - p2;
+  details::SampleStreamOf(samples0, samples1, count, oPoints, 
+    [&edge0, &edge1, &p2](auto simd, auto u0, auto u1, auto& oX, auto& oY, auto& oZ) MATH_SIMD_INLINE
+    {
+      using S = decltype(simd);
+      typename S::TReg b0, b1;
+      details::GetUniformTriangleOf<S>(u0, u1, b0, b1);
+      oX = S::Add(S::Set1(p2.X), S::Add(S::Mul(S::Set1(edge0.X), b0), S::Mul(S::Set1(edge1.X), b1)));
+      oY = S::Add(S::Set1(p2.Y), S::Add(S::Mul(S::Set1(edge0.Y), b0), S::Mul(S::Set1(edge1.Y), b1)));
+      oZ = S::Add(S::Set1(p2.Z), S::Add(S::Mul(S::Set1(edge0.Z), b0), S::Mul(S::Set1(edge1.Z), b1)));
+    });
+}
+
+template <typename TType, typename>
+void SampleUniformBounds(
+  const DVector3Stream<TType>& samples, const DBounds3D<TType>& bounds, DVector3Stream<TType>& oPoints)
+{
+  const TIndex count = samples.size();
+  oPoints.resize(count);
+  const auto& min = bounds.GetMin();
+  const auto length = bounds.GetMax() - min;
+  for (TIndex axis = 0; axis < 3; ++axis)
+  {
+    const TType* src = samples.GetPlane(axis);
+    TType* dst = oPoints.GetPlane(axis);
+    const TType start = min[axis];
+    const TType scale = length[axis];
+    details::ForEachStreamChunk<TType>(count,
+      [src, dst, start, scale](auto simd, TIndex i) MATH_SIMD_INLINE
+      {
+        using S = decltype(simd);
+        S::Store(dst + i, S::Add(S::Set1(start), S::Mul(S::Load(src + i), S::Set1(scale))));
+      },
+      [src, dst, start, scale](TIndex i) { dst[i] = start + src[i] * scale; });
+  }
+}
+
+} /// ::dy::math namespace
+
+MATH_SIMD_KERNEL_REGION_END
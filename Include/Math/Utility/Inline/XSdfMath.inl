@@ -0,0 +1,175 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace dy::math::details
+{
+
+/// @brief Write SDF values of points with callable or `GetSDFValuesOf` of evaluator.
+template <typename TType, typename TEvaluator>
+void GetSDFValuesWith(TEvaluator& evaluator, const DVector3Stream<TType>& points, TReal* oValues)
+{
+  if constexpr (std::is_invocable_v<TEvaluator&, const DVector3Stream<TType>&, TReal*> == true)
+  {
+    evaluator(points, oValues);
+  }
+  else
+  {
+    evaluator.GetSDFValuesOf(points, oValues);
+  }
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+template <typename TType, TIndex TLanes, typename TEvaluator>
+TU32 SphereTrace(
+  const DRayPacket<TType, TLanes>& rays,
+  TEvaluator&& evaluator,
+  const DSphereTraceOption& option,
+  DSphereTraceResult<TType, TLanes>& oResult)
+{
+  assert(option.mRelaxation >= TReal(1) && option.mRelaxation < TReal(2));
+  assert(option.mHitEpsilon > TReal(0));
+
+  oResult.mTValues.fill(std::numeric_limits<TReal>::infinity());
+  oResult.mNormals.fill(DVector3<TType>{});
+  oResult.mStepCounts.fill(0);
+  oResult.mHitMask = 0;
+
+  // Over-relaxed sphere tracing (Keinert et al. 2014) of each lane.
+  std::array<TReal, TLanes> t;
+  std::array<TReal, TLanes> relaxation;
+  std::array<TReal, TLanes> stepLength;
+  std::array<TReal, TLanes> previousRadius;
+  std::array<TReal, TLanes> sign;
+  t.fill(option.mMinT);
+  relaxation.fill(option.mRelaxation);
+  stepLength.fill(TReal(0));
+  previousRadius.fill(TReal(0));
+  sign.fill(TReal(1));
+
+  // Lanes which are not terminated, compacted to the front.
+  std::array<TIndex, TLanes> activeLanes;
+  for (TIndex i = 0; i < TLanes; ++i) { activeLanes[i] = i; }
+  TIndex activeCount = TLanes;
+
+  DVector3Stream<TType> points{TLanes};
+  std::array<TReal, TLanes> values;
+  for (TIndex step = 0; step < option.mMaxSteps && activeCount > 0; ++step)
+  {
+    points.resize(activeCount);
+    for (TIndex k = 0; k < activeCount; ++k)
+    {
+      const TIndex lane = activeLanes[k];
+      const auto laneT = static_cast<TType>(t[lane]);
+      points.GetPlane(0)[k] = rays.__mOriginX[lane] + rays.__mDirectionX[lane] * laneT;
+      points.GetPlane(1)[k] = rays.__mOriginY[lane] + rays.__mDirectionY[lane] * laneT;
+      points.GetPlane(2)[k] = rays.__mOriginZ[lane] + rays.__mDirectionZ[lane] * laneT;
+    }
+    details::GetSDFValuesWith<TType>(evaluator, points, values.data());
+
+    TIndex nextCount = 0;
+    for (TIndex k = 0; k < activeCount; ++k)
+    {
+      const TIndex lane = activeLanes[k];
+      oResult.mStepCounts[lane] += 1;
+      if (step == 0 && values[k] < TReal(0)) { sign[lane] = TReal(-1); }
+
+      const TReal signedRadius = sign[lane] * values[k];
+      const TReal radius = std::abs(signedRadius);
+      // When unbounding spheres of previous and current step do not overlap, surface could be skipped.
+      // When ray is over the surface, relaxed step went too far. In both cases,
+      // go back into unbounding sphere of previous step, and continue without relaxation.
+      const bool isRelaxationFailed = relaxation[lane] > TReal(1)
+        && (signedRadius < TReal(0) || radius + previousRadius[lane] < stepLength[lane]);
+      if (isRelaxationFailed == true)
+      {
+        stepLength[lane] -= relaxation[lane] * stepLength[lane];
+        relaxation[lane] = TReal(1);
+      }
+      else
+      {
+        stepLength[lane] = signedRadius * relaxation[lane];
+      }
+      previousRadius[lane] = radius;
+
+      if (isRelaxationFailed == false && radius < option.mHitEpsilon)
+      {
+        oResult.mTValues[lane] = t[lane];
+        oResult.mHitMask |= TU32(1) << lane;
+        continue;
+      }
+
+      t[lane] += stepLength[lane];
+      if (t[lane] > option.mMaxT) { continue; }
+      activeLanes[nextCount++] = lane;
+    }
+    activeCount = nextCount;
+  }
+
+  if (oResult.mHitMask == 0) { return 0; }
+
+  // Normal from 4 values at vertices of tetrahedron around hit point.
+  // n = sum(k_i f(p + e k_i)) for k = (1, -1, -1), (-1, -1, 1), (-1, 1, -1), (1, 1, 1).
+  constexpr TType kOffsets[4][3] = {{1, -1, -1}, {-1, -1, 1}, {-1, 1, -1}, {1, 1, 1}};
+  const auto epsilon = static_cast<TType>(option.mNormalEpsilon);
+  TIndex hitLanes[TLanes];
+  TIndex hitCount = 0;
+  for (TIndex lane = 0; lane < TLanes; ++lane)
+  {
+    if ((oResult.mHitMask >> lane) & 1) { hitLanes[hitCount++] = lane; }
+  }
+
+  points.resize(hitCount * 4);
+  for (TIndex k = 0; k < hitCount; ++k)
+  {
+    const TIndex lane = hitLanes[k];
+    const auto laneT = static_cast<TType>(oResult.mTValues[lane]);
+    const TType x = rays.__mOriginX[lane] + rays.__mDirectionX[lane] * laneT;
+    const TType y = rays.__mOriginY[lane] + rays.__mDirectionY[lane] * laneT;
+    const TType z = rays.__mOriginZ[lane] + rays.__mDirectionZ[lane] * laneT;
+    for (TIndex v = 0; v < 4; ++v)
+    {
+      points.GetPlane(0)[k * 4 + v] = x + kOffsets[v][0] * epsilon;
+      points.GetPlane(1)[k * 4 + v] = y + kOffsets[v][1] * epsilon;
+      points.GetPlane(2)[k * 4 + v] = z + kOffsets[v][2] * epsilon;
+    }
+  }
+
+  std::array<TReal, TLanes * 4> normalValues;
+  details::GetSDFValuesWith<TType>(evaluator, points, normalValues.data());
+  for (TIndex k = 0; k < hitCount; ++k)
+  {
+    DVector3<TType> normal = {};
+    for (TIndex v = 0; v < 4; ++v)
+    {
+      const auto value = static_cast<TType>(normalValues[k * 4 + v]);
+      normal += DVector3<TType>{kOffsets[v][0] * value, kOffsets[v][1] * value, kOffsets[v][2] * value};
+    }
+
+    const auto squaredLength = normal.GetSquareLength();
+    if (squaredLength > TReal(0)) { normal = normal / static_cast<TType>(std::sqrt(squaredLength)); }
+    oResult.mNormals[hitLanes[k]] = normal;
+  }
+  return oResult.mHitMask;
+}
+
+} /// ::dy::math namespace
@@ -24,7 +24,7 @@ bool IsRayIntersected(const DRay<TType>& ray, const DBounds3D<TType>& bounds)
 {
   if (bounds.IsInfiniteBound() == true) { return true; }
 
-  const auto tResult = GetTValuesOf(ray, bounds);
+  const auto tResult = GetTValueSetOf(ray, bounds);
   return tResult.empty() == false;
 }
 
@@ -38,7 +38,7 @@ bool IsRayIntersected(const DRay<TType>& ray, const DSphere<TType>& sphere)
   const auto b = 2 * Dot(alp, dir);
   const auto c = Dot(alp, alp) - (sphere.GetRadius() * sphere.GetRadius());
 
-  const auto result = SolveQuadric(TReal(1), TReal(b), TReal(c));
+  const auto result = SolveQuadricRoots(TReal(1), TReal(b), TReal(c));
   if (result.empty() == true) { return false; }
 
   return std::any_of(result.cbegin(), result.cend(), [](const auto& value) { return value >= 0; });
@@ -47,7 +47,7 @@ bool IsRayIntersected(const DRay<TType>& ray, const DSphere<TType>& sphere)
 template <typename TType>
 bool IsRayIntersected(const DRay<TType>& ray, const DBox<TType>& box)
 {
-  const auto tResult = GetTValuesOf(ray, box);
+  const auto tResult = GetTValueSetOf(ray, box);
   return tResult.empty() == false;
 }
 
@@ -69,7 +69,7 @@ bool IsRayIntersected(const DRay<TType>& ray, const DBox<TType>& box, const DMat
 template <typename TType>
 bool IsRayIntersected(const DRay<TType>& ray, const DBox<TType>& box, const DQuaternion<TType>& rot)
 {
-  return IsRayIntersected(ray, box, rot.ToMatrix3<EMatMajor::Column>());
+  return IsRayIntersected(ray, box, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
@@ -89,7 +89,7 @@ bool IsRayIntersected(const DRay<TType>& ray, const DPlane<TType>& plane)
 template <typename TType>
 bool IsRayIntersected(const DRay<TType>& ray, const DTorus<TType>& torus)
 {
-  const auto tResult = GetTValuesOf(ray, torus);
+  const auto tResult = GetTValueSetOf(ray, torus);
   return tResult.empty() == false;
 }
 
@@ -111,13 +111,13 @@ bool IsRayIntersected(const DRay<TType>& ray, const DTorus<TType>& torus, const
 template <typename TType>
 bool IsRayIntersected(const DRay<TType>& ray, const DTorus<TType>& torus, const DQuaternion<TType>& rot)
 {
-  return IsRayIntersected(ray, torus, rot.ToMatrix3<EMatMajor::Column>());
+  return IsRayIntersected(ray, torus, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
 bool IsRayIntersected(const DRay<TType>& ray, const DCone<TType>& cone)
 {
-  const auto tResult = GetTValuesOf(ray, cone);
+  const auto tResult = GetTValueSetOf(ray, cone);
   return tResult.empty() == false;
 }
 
@@ -139,13 +139,13 @@ bool IsRayIntersected(const DRay<TType>& ray, const DCone<TType>& cone, const DM
 template <typename TType>
 bool IsRayIntersected(const DRay<TType>& ray, const DCone<TType>& cone, const DQuaternion<TType>& rot)
 {
-  return IsRayIntersected(ray, cone, rot.ToMatrix3<EMatMajor::Column>());
+  return IsRayIntersected(ray, cone, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
 bool IsRayIntersected(const DRay<TType>& ray, const DCapsule<TType>& capsule)
 {
-  const auto tResult = GetTValuesOf(ray, capsule);
+  const auto tResult = GetTValueSetOf(ray, capsule);
   return tResult.empty() == false;
 }
 
@@ -167,7 +167,7 @@ bool IsRayIntersected(const DRay<TType>& ray, const DCapsule<TType>& capsule, co
 template <typename TType>
 bool IsRayIntersected(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DQuaternion<TType>& rot)
 {
-  return IsRayIntersected(ray, capsule, rot.ToMatrix3<EMatMajor::Column>());
+  return IsRayIntersected(ray, capsule, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 //!
@@ -334,21 +334,21 @@ TReal GetSDFValueOf(const DVector3<TType>& point, const DCapsule<TType>& capsule
 }
 
 //!
-//! GetTValuesOf
+//! GetTValueSetOf
 //! 
 
 template <typename TType>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBounds3D<TType>& bounds)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DBounds3D<TType>& bounds)
 {
   if (bounds.IsInfiniteBound() == true) { return {}; }
 
   const DVector3<TType> centerPoint = (bounds.GetMin() + bounds.GetMax()) / 2;
   const DVector3<TType> halfLength  = bounds.GetLength() / 2;
-  return GetTValuesOf(ray, DBox<TType>{centerPoint, halfLength});
+  return GetTValueSetOf(ray, DBox<TType>{centerPoint, halfLength});
 }
 
 template <typename TType>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DSphere<TType>& sphere)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DSphere<TType>& sphere)
 {
   if (IsRayIntersected(ray, sphere) == false) { return {}; }
 
@@ -357,21 +357,20 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DSphere<TType>& sp
 
   const auto b = 2 * Dot(alp, dir);
   const auto c = Dot(alp, alp) - (sphere.GetRadius() * sphere.GetRadius());
-  const auto sqrtE = std::sqrt((b * b) - c);
 
-  auto result = SolveQuadric(TReal(1), TReal(b), TReal(c));
+  auto result = SolveQuadricRoots(TReal(1), TReal(b), TReal(c));
 
   result.erase(
     std::remove_if(result.begin(), result.end(), [](const auto& value) { return value < 0.0f; }),
     result.end());
-  std::sort(result.begin(), result.end());
+  result.Sort();
 
-  return result;
+  return DRootSet<TReal, 4>(result);
 }
 
 /// @brief Get positive 't' list to the point of given DPlane from given ray.
 template <typename TType>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DPlane<TType>& plane)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DPlane<TType>& plane)
 {
   if (IsRayIntersected(ray, plane) == false) { return {}; }
   
@@ -386,7 +385,7 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DPlane<TType>& pla
 }
 
 template <typename TType>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBox<TType>& box)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DBox<TType>& box)
 {
   // Use 3-dimensional slab method [Kay and Kajyia].
   TType tMin = kMinValueOf<TType>;
@@ -421,7 +420,7 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBox<TType>& box)
     tMax = std::min(tMax, std::max(tz1, tz2));
   }
 
-  std::vector<TReal> result;
+  DRootSet<TReal, 4> result;
   static const DVector3<TType> epVec = {TType(1e-5)};
   if (tMax >= tMin && tMax >= 0)
   {
@@ -446,7 +445,7 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBox<TType>& box)
 }
 
 template <typename TType, EMatMajor TMajor>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBox<TType>& box, const DMatrix3<TType, TMajor>& rot)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DBox<TType>& box, const DMatrix3<TType, TMajor>& rot)
 {
   // We regards box is symmetrical and origin is located on origin of box space.
   // We need to convert ray of world-space into box-space.
@@ -454,17 +453,17 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBox<TType>& box,
   const auto localSpacePos  = invRotMat * (ray.GetOrigin() - box.GetOrigin());
   const auto localSpaceDir  = invRotMat * ray.GetDirection();
   
-  return GetTValuesOf(DRay<TType>{localSpacePos, localSpaceDir}, DBox<TType>{DVector3<TType>{0}, box.GetLengthList()});
+  return GetTValueSetOf(DRay<TType>{localSpacePos, localSpaceDir}, DBox<TType>{DVector3<TType>{0}, box.GetLengthList()});
 }
 
 template <typename TType>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBox<TType>& box, const DQuaternion<TType>& rot)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DBox<TType>& box, const DQuaternion<TType>& rot)
 {
-  return GetTValuesOf(ray, box, rot.ToMatrix3<EMatMajor::Column>());
+  return GetTValueSetOf(ray, box, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DTorus<TType>& torus)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DTorus<TType>& torus)
 {
   // reference https://marcin-chwedczuk.github.io/ray-tracing-torus
   // reference https://en.wikipedia.org/wiki/Quartic_function#Ferrari's_solution
@@ -482,25 +481,25 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DTorus<TType>& tor
   const auto c2 = 
       2 * d2 * o2_minus_torus2 
     + 4 * std::pow(od, 2)  
-    + 4 * std::pow(torus.GetRadius(), 2) * std::pow(ray.GetDirection().Y, 2);
+    + 4 * std::pow(torus.GetDistance(), 2) * std::pow(ray.GetDirection().Y, 2);
   const auto c1 = 
       4 * o2_minus_torus2 * od
-    + 8 * std::pow(torus.GetRadius(), 2) * ro.Y * ray.GetDirection().Y;
+    + 8 * std::pow(torus.GetDistance(), 2) * ro.Y * ray.GetDirection().Y;
   const auto c0 = 
       std::pow(o2_minus_torus2, 2)
-    - 4 * std::pow(torus.GetRadius(), 2) * (std::pow(torus.GetRadius(), 2) - std::pow(ro.Y, 2));
+    - 4 * std::pow(torus.GetDistance(), 2) * (std::pow(torus.GetRadius(), 2) - std::pow(ro.Y, 2));
 
-  auto result = SolveQuartic(c4, c3, c2, c1, c0);
+  auto result = SolveQuarticRoots(c4, c3, c2, c1, c0);
   result.erase(
     std::remove_if(result.begin(), result.end(), [](const auto& value) { return value < 0.0f; }),
     result.end());
-  std::sort(result.begin(), result.end());
+  result.Sort();
 
   return result;
 }
 
 template <typename TType, EMatMajor TMajor>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DMatrix3<TType, TMajor>& rot)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DMatrix3<TType, TMajor>& rot)
 {
   // We regards box is symmetrical and origin is located on origin of box space.
   // We need to convert ray of world-space into box-space.
@@ -508,20 +507,20 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DTorus<TType>& tor
   const auto localSpacePos  = invRotMat * (ray.GetOrigin() - torus.GetOrigin());
   const auto localSpaceDir  = invRotMat * ray.GetDirection();
   
-  return GetTValuesOf(
+  return GetTValueSetOf(
     DRay<TType>{localSpacePos, localSpaceDir}, 
     DTorus<TType>{DVector3<TType>{0}, torus.GetDistance(), torus.GetRadius()}
   );
 }
 
 template <typename TType>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DQuaternion<TType>& rot)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DQuaternion<TType>& rot)
 {
-  return GetTValuesOf(ray, torus, rot.ToMatrix3<EMatMajor::Column>());
+  return GetTValueSetOf(ray, torus, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCone<TType>& cone)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCone<TType>& cone)
 {
   // http://lousodrome.net/blog/light/2017/01/03/intersection-of-a-ray-and-a-cone/
   // We need to get point C, vector V, and cos\theta.
@@ -538,14 +537,14 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCone<TType>& cone
   const TReal qb = 2 * (Dot(d, v) * Dot(co, v) - Dot(d, co) * cTheta2);
   const TReal qc = std::pow(Dot(co, v), TReal(2)) - Dot(co, co) * cTheta2;
 
-  std::vector<TReal> tempResult = SolveQuadric(qa, qb, qc);
+  auto tempResult = SolveQuadricRoots(qa, qb, qc);
   tempResult.erase(
     std::remove_if(tempResult.begin(), tempResult.end(), [](const auto& value) { return value < 0.0f; }),
     tempResult.end());
-  std::sort(tempResult.begin(), tempResult.end());
+  tempResult.Sort();
 
   // Check height, disk and out of range.
-  std::vector<TReal> result = {};
+  DRootSet<TReal, 4> result = {};
   for (auto& t : tempResult)
   {
     const DVector3<TReal> rp = (ro + t * d) - c;
@@ -560,7 +559,7 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCone<TType>& cone
   if (IsRayIntersected(DRay<TType>{ro, d}, DPlane<TType>{}) == true)
   {
     // Do another tvalue of plane that has normal unitY and d 0.
-    const auto planeTValues = GetTValuesOf(DRay<TType>{ro, d}, DPlane<TType>{});
+    const auto planeTValues = GetTValueSetOf(DRay<TType>{ro, d}, DPlane<TType>{});
     if (planeTValues.empty() == false)
     {
       // If newT of potential disk exceeds range of disk radius, just throw away.
@@ -572,13 +571,13 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCone<TType>& cone
       }
     }
   }
-  std::sort(result.begin(), result.end());
+  result.Sort();
 
   return result;
 }
 
 template <typename TType, EMatMajor TMajor>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCone<TType>& cone, const DMatrix3<TType, TMajor>& rot)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCone<TType>& cone, const DMatrix3<TType, TMajor>& rot)
 {
   // We regards box is symmetrical and origin is located on origin of box space.
   // We need to convert ray of world-space into box-space.
@@ -586,26 +585,24 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCone<TType>& cone
   const auto localSpacePos  = invRotMat * (ray.GetOrigin() - cone.GetOrigin());
   const auto localSpaceDir  = invRotMat * ray.GetDirection();
   
-  return GetTValuesOf(
+  return GetTValueSetOf(
     DRay<TType>{localSpacePos, localSpaceDir}, 
     DCone<TType>{DVector3<TType>{0}, cone.GetHeight(), cone.GetRadius()}
   );  
 }
 
 template <typename TType>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCone<TType>& cone, const DQuaternion<TType>& rot)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCone<TType>& cone, const DQuaternion<TType>& rot)
 {
-  return GetTValuesOf(ray, cone, rot.ToMatrix3<EMatMajor::Column>());
+  return GetTValueSetOf(ray, cone, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& capsule)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCapsule<TType>& capsule)
 {
   const DVector3<TType> ro  = ray.GetOrigin() - capsule.GetOrigin();
   const DVector3<TType>& d  = ray.GetDirection();
-  const DVector3<TType> col = DVector3<TType>{};
-  const DVector3<TType> coh = DVector3<TType>::UnitY() * capsule.GetHeight();
-  std::vector<TReal> result; 
+  DRootSet<TReal, 4> result; 
 
   // First, get `t` list of y-axis infinite cylinder when d is parallel to UnitY().
   if (Dot(DVector3<TType>::UnitY(), d) != 1)
@@ -615,7 +612,7 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& c
     const TType b = 2 * (ro.X * dxz.X + ro.Z * dxz.Z);
     const TType c = std::pow(ro.X, 2) + std::pow(ro.Z, 2) - std::pow(capsule.GetRadius(), 2);
 
-    std::vector<TReal> tList = SolveQuadric(a, b, c);
+    auto tList = SolveQuadricRoots(a, b, c);
     const TReal cosValue = Dot(d, dxz);
     assert(cosValue > 0);
     // Remove if p = ro + t`d, p.y is < 0 or > capsule.GetHeight().
@@ -630,7 +627,7 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& c
   // If got `t` list size is zero or one, try get another `t` from hemisphere.
   if (result.size() < 2)
   {
-    const auto upTList = GetTValuesOf(
+    const auto upTList = GetTValueSetOf(
       ray, 
       DSphere<TType>{DVector3<TType>::UnitY() * capsule.GetHeight(), capsule.GetRadius()}
     );
@@ -639,7 +636,7 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& c
       if ((ro + t * d).Y > capsule.GetHeight()) { result.emplace_back(t); }
     }
 
-    const auto downTList = GetTValuesOf(ray, DSphere<TType>{capsule.GetOrigin(), capsule.GetRadius()});
+    const auto downTList = GetTValueSetOf(ray, DSphere<TType>{capsule.GetOrigin(), capsule.GetRadius()});
     for (const auto& t : downTList)
     {
       if ((ro + t * d).Y < 0) { result.emplace_back(t); }
@@ -647,12 +644,12 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& c
   }
 
   // Sort it and return.
-  std::sort(result.begin(), result.end());
+  result.Sort();
   return result;
 }
 
 template <typename TType, EMatMajor TMajor>
-std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DMatrix3<TType, TMajor>& rot)
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DMatrix3<TType, TMajor>& rot)
 {
   // We regards box is symmetrical and origin is located on origin of box space.
   // We need to convert ray of world-space into box-space.
@@ -660,16 +657,125 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& c
   const auto localSpacePos  = invRotMat * (ray.GetOrigin() - capsule.GetOrigin());
   const auto localSpaceDir  = invRotMat * ray.GetDirection();
   
-  return GetTValuesOf(
+  return GetTValueSetOf(
     DRay<TType>{localSpacePos, localSpaceDir}, 
     DCapsule<TType>{DVector3<TType>{0}, capsule.GetHeight(), capsule.GetRadius()}
   );  
 }
 
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DQuaternion<TType>& rot)
+{
+  return GetTValueSetOf(ray, capsule, rot.template ToMatrix3<EMatMajor::Column>());
+}
+
+//!
+//! GetTValuesOf
+//! 
+
+template <typename TType>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBounds3D<TType>& bounds)
+{
+  const auto result = GetTValueSetOf(ray, bounds);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DSphere<TType>& sphere)
+{
+  const auto result = GetTValueSetOf(ray, sphere);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DPlane<TType>& plane)
+{
+  const auto result = GetTValueSetOf(ray, plane);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBox<TType>& box)
+{
+  const auto result = GetTValueSetOf(ray, box);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType, EMatMajor TMajor>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBox<TType>& box, const DMatrix3<TType, TMajor>& rot)
+{
+  const auto result = GetTValueSetOf(ray, box, rot);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DBox<TType>& box, const DQuaternion<TType>& rot)
+{
+  const auto result = GetTValueSetOf(ray, box, rot);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DTorus<TType>& torus)
+{
+  const auto result = GetTValueSetOf(ray, torus);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType, EMatMajor TMajor>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DMatrix3<TType, TMajor>& rot)
+{
+  const auto result = GetTValueSetOf(ray, torus, rot);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DQuaternion<TType>& rot)
+{
+  const auto result = GetTValueSetOf(ray, torus, rot);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCone<TType>& cone)
+{
+  const auto result = GetTValueSetOf(ray, cone);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType, EMatMajor TMajor>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCone<TType>& cone, const DMatrix3<TType, TMajor>& rot)
+{
+  const auto result = GetTValueSetOf(ray, cone, rot);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCone<TType>& cone, const DQuaternion<TType>& rot)
+{
+  const auto result = GetTValueSetOf(ray, cone, rot);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& capsule)
+{
+  const auto result = GetTValueSetOf(ray, capsule);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+template <typename TType, EMatMajor TMajor>
+std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DMatrix3<TType, TMajor>& rot)
+{
+  const auto result = GetTValueSetOf(ray, capsule, rot);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
 template <typename TType>
 std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DQuaternion<TType>& rot)
 {
-  return GetTValuesOf(ray, capsule, rot.ToMatrix3<EMatMajor::Column>());
+  const auto result = GetTValueSetOf(ray, capsule, rot);
+  return std::vector<TReal>(result.cbegin(), result.cend());
 }
 
 //!
@@ -681,7 +787,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DBounds3D<
 {
   if (bounds.IsInfiniteBound() == true) { return std::nullopt; }
 
-  const auto tValueList = GetTValuesOf(ray, bounds);
+  const auto tValueList = GetTValueSetOf(ray, bounds);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -690,7 +796,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DBounds3D<
 template <typename TType>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DSphere<TType>& sphere)
 {
-  const auto tValueList = GetTValuesOf(ray, sphere);
+  const auto tValueList = GetTValueSetOf(ray, sphere);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -699,7 +805,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DSphere<TT
 template <typename TType>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DBox<TType>& box)
 {
-  const auto tValueList = GetTValuesOf(ray, box);
+  const auto tValueList = GetTValueSetOf(ray, box);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -708,7 +814,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DBox<TType
 template <typename TType, EMatMajor TMajor>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DBox<TType>& box, const DMatrix3<TType, TMajor>& rot)
 {
-  const auto tValueList = GetTValuesOf(ray, box, rot);
+  const auto tValueList = GetTValueSetOf(ray, box, rot);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -717,7 +823,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DBox<TType
 template <typename TType>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DBox<TType>& box, const DQuaternion<TType>& rot)
 {
-  const auto tValueList = GetTValuesOf(ray, box, rot);
+  const auto tValueList = GetTValueSetOf(ray, box, rot);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -726,7 +832,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DBox<TType
 template <typename TType>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DPlane<TType>& plane)
 {
-  const auto tValueList = GetTValuesOf(ray, plane);
+  const auto tValueList = GetTValueSetOf(ray, plane);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -735,7 +841,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DPlane<TTy
 template <typename TType>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DTorus<TType>& torus)
 {
-  const auto tValueList = GetTValuesOf(ray, torus);
+  const auto tValueList = GetTValueSetOf(ray, torus);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front(); 
@@ -744,7 +850,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DTorus<TTy
 template <typename TType, EMatMajor TMajor>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DMatrix3<TType, TMajor>& rot)
 {
-  const auto tValueList = GetTValuesOf(ray, torus, rot);
+  const auto tValueList = GetTValueSetOf(ray, torus, rot);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -753,7 +859,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DTorus<TTy
 template <typename TType>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DQuaternion<TType>& rot)
 {
-  const auto tValueList = GetTValuesOf(ray, torus, rot);
+  const auto tValueList = GetTValueSetOf(ray, torus, rot);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -762,7 +868,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DTorus<TTy
 template <typename TType>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCone<TType>& cone)
 {
-  const auto tValueList = GetTValuesOf(ray, cone);
+  const auto tValueList = GetTValueSetOf(ray, cone);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front(); 
@@ -771,7 +877,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCone<TTyp
 template <typename TType, EMatMajor TMajor>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCone<TType>& cone, const DMatrix3<TType, TMajor>& rot)
 {
-  const auto tValueList = GetTValuesOf(ray, cone, rot);
+  const auto tValueList = GetTValueSetOf(ray, cone, rot);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -780,7 +886,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCone<TTyp
 template <typename TType>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCone<TType>& cone, const DQuaternion<TType>& rot)
 {
-  const auto tValueList = GetTValuesOf(ray, cone, rot);
+  const auto tValueList = GetTValueSetOf(ray, cone, rot);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -789,7 +895,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCone<TTyp
 template <typename TType>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCapsule<TType>& capsule)
 {
-  const auto tValueList = GetTValuesOf(ray, capsule);
+  const auto tValueList = GetTValueSetOf(ray, capsule);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front(); 
@@ -798,7 +904,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCapsule<T
 template <typename TType, EMatMajor TMajor>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DMatrix3<TType, TMajor>& rot)
 {
-  const auto tValueList = GetTValuesOf(ray, capsule, rot);
+  const auto tValueList = GetTValueSetOf(ray, capsule, rot);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -807,7 +913,7 @@ std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCapsule<T
 template <typename TType>
 std::optional<TReal> GetClosestTValueOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DQuaternion<TType>& rot)
 {
-  const auto tValueList = GetTValuesOf(ray, capsule, rot);
+  const auto tValueList = GetTValueSetOf(ray, capsule, rot);
   if (tValueList.empty() == true) { return std::nullopt; }
 
   return tValueList.front();
@@ -882,7 +988,7 @@ GetNormalOf(const DRay<TType>& ray, const DBox<TType>& box, const DMatrix3<TType
 template <typename TType>
 std::optional<DVector3<TType>> GetNormalOf(const DRay<TType>& ray, const DBox<TType>& box, const DQuaternion<TType>& rot)
 {
-  return GetNormalOf(ray, box, rot.ToMatrix3<EMatMajor::Column>());
+  return GetNormalOf(ray, box, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 /// @brief Try to get normal vector of plane, when ray is intersected.
@@ -939,7 +1045,7 @@ GetNormalOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DMatrix3<T
 template <typename TType>
 std::optional<DVector3<TType>> GetNormalOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DQuaternion<TType>& rot)
 {
-  return GetNormalOf(ray, torus, rot.ToMatrix3<EMatMajor::Column>());
+  return GetNormalOf(ray, torus, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
@@ -986,7 +1092,7 @@ template <typename TType>
 std::optional<DVector3<TType>> 
 GetNormalOf(const DRay<TType>& ray, const DCone<TType>& cone, const DQuaternion<TType>& rot)
 {
-  return GetNormalOf(ray, cone, rot.ToMatrix3<EMatMajor::Column>());
+  return GetNormalOf(ray, cone, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 template <typename TType>
@@ -1033,7 +1139,7 @@ template <typename TType>
 std::optional<DVector3<TType>> 
 GetNormalOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DQuaternion<TType>& rot)
 {
-  return GetNormalOf(ray, capsule, rot.ToMatrix3<EMatMajor::Column>());
+  return GetNormalOf(ray, capsule, rot.template ToMatrix3<EMatMajor::Column>());
 }
 
 } /// ::dy::math namespace
\ No newline at end of file
@@ -0,0 +1,300 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+
+#include <type_traits>
+#include <Math/Common/XSimdDispatch.h>
+
+MATH_SIMD_KERNEL_REGION_BEGIN
+
+namespace dy::math::details
+{
+
+/// @brief Check packet functions of TType can use SIMD kernels.
+/// Kernels follow the operation order of scalar version, so results are same in bit.
+template <typename TType>
+constexpr bool kIsPacketSimdable =
+#ifdef MATH_SIMD_KERNELS
+  std::is_same_v<TType, TF32> && std::is_same_v<TReal, TF32>;
+#else
+  false;
+#endif
+
+#ifdef MATH_SIMD_KERNELS
+/// @brief Call `function(TSimd{}, laneOffset)` for each SIMD-width chunk of packet, 
+/// and merge returned chunk masks into `oMask`.
+/// @return False when SIMD kernels are not selected in run-time, so scalar version must be used.
+template <TIndex TLanes, typename TFunction>
+bool ForEachPacketChunk(TU32& oMask, TFunction&& function)
+{
+  return DispatchSimdF32<TLanes>([&oMask, &function](auto simd) MATH_SIMD_INLINE
+  {
+    using TSimd = decltype(simd);
+    TU32 mask = 0;
+    for (TIndex i = 0; i < TLanes; i += TSimd::kLanes) { mask |= function(simd, i) << i; }
+    oMask = mask;
+  });
+}
+
+/// @brief Sphere kernel of `IsRayIntersected` and `GetClosestTValueOf`.
+/// Mirrors `SolveQuadric(1, b, c)` of scalar version.
+/// @param oTValues If not null, closest 't' values are stored. (infinity when not hit)
+template <typename TSimd, TIndex TLanes>
+MATH_SIMD_INLINE inline TU32 GetClosestTValueOfSphereChunk(
+  const DRayPacket<TF32, TLanes>& rays, TIndex offset, const DSphere<TF32>& sphere, TF32* oTValues)
+{
+  using S = TSimd;
+  const auto& so = sphere.GetOrigin();
+  const auto zero = S::Set1(0.0f);
+
+  const auto alpX = S::Sub(S::Load(&rays.__mOriginX[offset]), S::Set1(so.X));
+  const auto alpY = S::Sub(S::Load(&rays.__mOriginY[offset]), S::Set1(so.Y));
+  const auto alpZ = S::Sub(S::Load(&rays.__mOriginZ[offset]), S::Set1(so.Z));
+  const auto dirX = S::Load(&rays.__mDirectionX[offset]);
+  const auto dirY = S::Load(&rays.__mDirectionY[offset]);
+  const auto dirZ = S::Load(&rays.__mDirectionZ[offset]);
+
+  const auto dotAD = S::Add(S::Add(S::Mul(alpX, dirX), S::Mul(alpY, dirY)), S::Mul(alpZ, dirZ));
+  const auto dotAA = S::Add(S::Add(S::Mul(alpX, alpX), S::Mul(alpY, alpY)), S::Mul(alpZ, alpZ));
+  const auto b = S::Mul(S::Set1(2.0f), dotAD);
+  const auto c = S::Sub(dotAA, S::Set1(sphere.GetRadius() * sphere.GetRadius()));
+
+  // Normal form: x^2 + px + q = 0. (q = c / 1 is c itself.)
+  const auto p = S::Div(b, S::Set1(2.0f));
+  const auto D = S::Sub(S::Mul(p, p), c);
+
+  // IsNearlyZero(D, 1e-5) : single root -p.
+  const auto absD = S::Select(S::CmpLt(zero, D), D, S::Sub(zero, D));
+  const auto isSingle = S::CmpLt(absD, S::Set1(1e-5f));
+  const auto negP = S::Neg(p);
+  const auto singleHit = S::And(isSingle, S::CmpGe(negP, zero));
+
+  // D > 0 : two roots, -sqrt(D) - p is not bigger than sqrt(D) - p.
+  const auto sqrtD = S::Sqrt(D);
+  const auto rootMin = S::Sub(S::Neg(sqrtD), p);
+  const auto rootMax = S::Sub(sqrtD, p);
+  const auto doubleHit = S::AndNot(isSingle, S::And(S::CmpGt(D, zero), S::CmpGe(rootMax, zero)));
+
+  const auto hit = S::Or(singleHit, doubleHit);
+  if (oTValues != nullptr)
+  {
+    const auto closest = S::Select(isSingle, negP, S::Select(S::CmpGe(rootMin, zero), rootMin, rootMax));
+    S::StoreU(oTValues + offset, S::Select(hit, closest, S::Set1(std::numeric_limits<TF32>::infinity())));
+  }
+  return S::MoveMask(hit);
+}
+
+/// @brief Box kernel of `IsRayIntersected` and `GetClosestTValueOf`.
+/// Mirrors slab method of scalar version, including axis skip of zero direction.
+/// @param oTValues If not null, closest 't' values are stored. (infinity when not hit)
+template <typename TSimd, TIndex TLanes>
+MATH_SIMD_INLINE inline TU32 GetClosestTValueOfBoxChunk(
+  const DRayPacket<TF32, TLanes>& rays, TIndex offset, const DBox<TF32>& box, TF32* oTValues)
+{
+  using S = TSimd;
+  const auto zero = S::Set1(0.0f);
+  const auto min = box.GetMinPos();
+  const auto max = box.GetMaxPos();
+
+  const auto roX = S::Load(&rays.__mOriginX[offset]);
+  const auto roY = S::Load(&rays.__mOriginY[offset]);
+  const auto roZ = S::Load(&rays.__mOriginZ[offset]);
+  const auto rdX = S::Load(&rays.__mDirectionX[offset]);
+  const auto rdY = S::Load(&rays.__mDirectionY[offset]);
+  const auto rdZ = S::Load(&rays.__mDirectionZ[offset]);
+
+  auto tMin = S::Set1(kMinValueOf<TF32>);
+  auto tMax = S::Set1(kMaxValueOf<TF32>);
+  const auto UpdateSlab = [&](auto ro, auto rd, TF32 slabMin, TF32 slabMax) MATH_SIMD_INLINE
+  {
+    const auto t1 = S::Div(S::Sub(S::Set1(slabMin), ro), rd);
+    const auto t2 = S::Div(S::Sub(S::Set1(slabMax), ro), rd);
+    // std::max(tMin, std::min(t1, t2)) and std::min(tMax, std::max(t1, t2)).
+    const auto isValid = S::CmpNeq(rd, zero);
+    tMin = S::Select(isValid, S::Max(S::Min(t2, t1), tMin), tMin);
+    tMax = S::Select(isValid, S::Min(S::Max(t2, t1), tMax), tMax);
+  };
+  UpdateSlab(roX, rdX, min.X, max.X);
+  UpdateSlab(roY, rdY, min.Y, max.Y);
+  UpdateSlab(roZ, rdZ, min.Z, max.Z);
+
+  const DVector3<TF32> epVec = {TF32(1e-5)};
+  const DVector3<TF32> elpMin = min - epVec;
+  const DVector3<TF32> elpMax = max + epVec;
+  const auto IsInside = [&](auto t) MATH_SIMD_INLINE
+  {
+    const auto x = S::Add(roX, S::Mul(t, rdX));
+    const auto y = S::Add(roY, S::Mul(t, rdY));
+    const auto z = S::Add(roZ, S::Mul(t, rdZ));
+    const auto inMax = S::And(S::And(S::CmpLe(x, S::Set1(elpMax.X)), S::CmpLe(y, S::Set1(elpMax.Y))), S::CmpLe(z, S::Set1(elpMax.Z)));
+    const auto inMin = S::And(S::And(S::CmpGe(x, S::Set1(elpMin.X)), S::CmpGe(y, S::Set1(elpMin.Y))), S::CmpGe(z, S::Set1(elpMin.Z)));
+    return S::And(inMax, inMin);
+  };
+
+  const auto isCandidate = S::And(S::CmpGe(tMax, tMin), S::CmpGe(tMax, zero));
+  const auto acceptMin = S::And(isCandidate, S::And(S::CmpGe(tMin, zero), IsInside(tMin)));
+  const auto acceptMax = S::And(isCandidate, S::And(S::CmpGt(tMax, tMin), IsInside(tMax)));
+
+  const auto hit = S::Or(acceptMin, acceptMax);
+  if (oTValues != nullptr)
+  {
+    const auto closest = S::Select(acceptMin, tMin, tMax);
+    S::StoreU(oTValues + offset, S::Select(hit, closest, S::Set1(std::numeric_limits<TF32>::infinity())));
+  }
+  return S::MoveMask(hit);
+}
+#endif /// MATH_SIMD_KERNELS
+
+/// @brief Convert non-infinite DBounds3D into DBox, like scalar `GetTValuesOf(ray, bounds)`.
+template <typename TType>
+DBox<TType> ToBoxOfPacket(const DBounds3D<TType>& bounds)
+{
+  const DVector3<TType> centerPoint = (bounds.GetMin() + bounds.GetMax()) / 2;
+  const DVector3<TType> halfLength  = bounds.GetLength() / 2;
+  return DBox<TType>{centerPoint, halfLength};
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+template <typename TType, TIndex TLanes>
+TU32 IsRayIntersected(const DRayPacket<TType, TLanes>& rays, const DBounds3D<TType>& bounds)
+{
+  if (bounds.IsInfiniteBound() == true) { return TU32((TU64(1) << TLanes) - 1); }
+
+  return IsRayIntersected(rays, details::ToBoxOfPacket(bounds));
+}
+
+template <typename TType, TIndex TLanes>
+TU32 IsRayIntersected(const DRayPacket<TType, TLanes>& rays, const DSphere<TType>& sphere)
+{
+#ifdef MATH_SIMD_KERNELS
+  if constexpr (details::kIsPacketSimdable<TType> == true)
+  {
+    TU32 mask = 0;
+    const bool isDispatched = details::ForEachPacketChunk<TLanes>(mask, [&](auto simd, TIndex offset) MATH_SIMD_INLINE
+    {
+      return details::GetClosestTValueOfSphereChunk<decltype(simd)>(rays, offset, sphere, nullptr);
+    });
+    if (isDispatched == true) { return mask; }
+  }
+#endif
+
+  TU32 mask = 0;
+  for (TIndex i = 0; i < TLanes; ++i) 
+  { 
+    if (IsRayIntersected(rays.GetRay(i), sphere) == true) { mask |= TU32(1) << i; }
+  }
+  return mask;
+}
+
+template <typename TType, TIndex TLanes>
+TU32 IsRayIntersected(const DRayPacket<TType, TLanes>& rays, const DBox<TType>& box)
+{
+#ifdef MATH_SIMD_KERNELS
+  if constexpr (details::kIsPacketSimdable<TType> == true)
+  {
+    TU32 mask = 0;
+    const bool isDispatched = details::ForEachPacketChunk<TLanes>(mask, [&](auto simd, TIndex offset) MATH_SIMD_INLINE
+    {
+      return details::GetClosestTValueOfBoxChunk<decltype(simd)>(rays, offset, box, nullptr);
+    });
+    if (isDispatched == true) { return mask; }
+  }
+#endif
+
+  TU32 mask = 0;
+  for (TIndex i = 0; i < TLanes; ++i) 
+  { 
+    if (IsRayIntersected(rays.GetRay(i), box) == true) { mask |= TU32(1) << i; }
+  }
+  return mask;
+}
+
+template <typename TType, TIndex TLanes>
+TU32 GetClosestTValueOf(
+  const DRayPacket<TType, TLanes>& rays, 
+  const DBounds3D<TType>& bounds, 
+  std::array<TReal, TLanes>& oTValues)
+{
+  if (bounds.IsInfiniteBound() == true) 
+  { 
+    oTValues.fill(std::numeric_limits<TReal>::infinity());
+    return 0; 
+  }
+
+  return GetClosestTValueOf(rays, details::ToBoxOfPacket(bounds), oTValues);
+}
+
+template <typename TType, TIndex TLanes>
+TU32 GetClosestTValueOf(
+  const DRayPacket<TType, TLanes>& rays, 
+  const DSphere<TType>& sphere, 
+  std::array<TReal, TLanes>& oTValues)
+{
+#ifdef MATH_SIMD_KERNELS
+  if constexpr (details::kIsPacketSimdable<TType> == true)
+  {
+    TU32 mask = 0;
+    const bool isDispatched = details::ForEachPacketChunk<TLanes>(mask, [&](auto simd, TIndex offset) MATH_SIMD_INLINE
+    {
+      return details::GetClosestTValueOfSphereChunk<decltype(simd)>(rays, offset, sphere, oTValues.data());
+    });
+    if (isDispatched == true) { return mask; }
+  }
+#endif
+
+  TU32 mask = 0;
+  for (TIndex i = 0; i < TLanes; ++i) 
+  { 
+    const auto t = GetClosestTValueOf(rays.GetRay(i), sphere);
+    oTValues[i] = t.has_value() == true ? *t : std::numeric_limits<TReal>::infinity();
+    if (t.has_value() == true) { mask |= TU32(1) << i; }
+  }
+  return mask;
+}
+
+template <typename TType, TIndex TLanes>
+TU32 GetClosestTValueOf(
+  const DRayPacket<TType, TLanes>& rays, 
+  const DBox<TType>& box, 
+  std::array<TReal, TLanes>& oTValues)
+{
+#ifdef MATH_SIMD_KERNELS
+  if constexpr (details::kIsPacketSimdable<TType> == true)
+  {
+    TU32 mask = 0;
+    const bool isDispatched = details::ForEachPacketChunk<TLanes>(mask, [&](auto simd, TIndex offset) MATH_SIMD_INLINE
+    {
+      return details::GetClosestTValueOfBoxChunk<decltype(simd)>(rays, offset, box, oTValues.data());
+    });
+    if (isDispatched == true) { return mask; }
+  }
+#endif
+
+  TU32 mask = 0;
+  for (TIndex i = 0; i < TLanes; ++i) 
+  { 
+    const auto t = GetClosestTValueOf(rays.GetRay(i), box);
+    oTValues[i] = t.has_value() == true ? *t : std::numeric_limits<TReal>::infinity();
+    if (t.has_value() == true) { mask |= TU32(1) << i; }
+  }
+  return mask;
+}
+
+} /// ::dy::math namespace
+
+MATH_SIMD_KERNEL_REGION_END
@@ -0,0 +1,353 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+#include <Math/Common/XSimdDispatch.h>
+
+MATH_SIMD_KERNEL_REGION_BEGIN
+
+namespace dy::math::details
+{
+
+/// @brief Call `simdFunc(TSimd{}, i)` for each register-sized chunk of `[0, count)` when `TType` can use SIMD,
+/// and call `scalarFunc(i)` for remained indices.
+/// Chunk starts from 0 and step is lane count, so aligned load can be used for stream planes.
+template <typename TType, typename TSimdFunc, typename TScalarFunc>
+void ForEachStreamChunk(TIndex count, TSimdFunc&& simdFunc, TScalarFunc&& scalarFunc)
+{
+  TIndex i = 0;
+#ifdef MATH_SIMD_KERNELS
+  if constexpr (std::is_same_v<TType, TF32>)
+  {
+    DispatchSimdF32([&i, count, &simdFunc](auto simd) MATH_SIMD_INLINE
+    {
+      using TSimd = decltype(simd);
+      for (; i + TSimd::kLanes <= count; i += TSimd::kLanes) { simdFunc(simd, i); }
+    });
+  }
+#else
+  (void)simdFunc;
+#endif
+
+  for (; i < count; ++i) { scalarFunc(i); }
+}
+
+/// @brief Apply unary element-wise operation to each plane.
+template <typename TStream, typename TSimdFunc, typename TScalarFunc>
+void TransformPlanesOf(const TStream& values, TStream& oResults, TSimdFunc&& simdFunc, TScalarFunc&& scalarFunc)
+{
+  using TType = typename TStream::TValueType;
+  const TIndex count = values.size();
+  oResults.resize(count);
+
+  for (TIndex axis = 0; axis < TStream::kDimension; ++axis)
+  {
+    const TType* src = values.GetPlane(axis);
+    TType* dst = oResults.GetPlane(axis);
+    ForEachStreamChunk<TType>(count,
+      [src, dst, &simdFunc](auto simd, TIndex i) MATH_SIMD_INLINE
+      {
+        using TSimd = decltype(simd);
+        TSimd::Store(dst + i, simdFunc(simd, TSimd::Load(src + i)));
+      },
+      [src, dst, &scalarFunc](TIndex i) { dst[i] = scalarFunc(src[i]); });
+  }
+}
+
+/// @brief Apply binary element-wise operation to each plane pair.
+template <typename TStream, typename TSimdFunc, typename TScalarFunc>
+void TransformPlanesOf(
+  const TStream& lhs, const TStream& rhs, TStream& oResults,
+  TSimdFunc&& simdFunc, TScalarFunc&& scalarFunc)
+{
+  using TType = typename TStream::TValueType;
+  assert(lhs.size() == rhs.size());
+  const TIndex count = lhs.size();
+  oResults.resize(count);
+
+  for (TIndex axis = 0; axis < TStream::kDimension; ++axis)
+  {
+    const TType* lSrc = lhs.GetPlane(axis);
+    const TType* rSrc = rhs.GetPlane(axis);
+    TType* dst = oResults.GetPlane(axis);
+    ForEachStreamChunk<TType>(count,
+      [lSrc, rSrc, dst, &simdFunc](auto simd, TIndex i) MATH_SIMD_INLINE
+      {
+        using TSimd = decltype(simd);
+        TSimd::Store(dst + i, simdFunc(simd, TSimd::Load(lSrc + i), TSimd::Load(rSrc + i)));
+      },
+      [lSrc, rSrc, dst, &scalarFunc](TIndex i) { dst[i] = scalarFunc(lSrc[i], rSrc[i]); });
+  }
+}
+
+template <typename TStream>
+void DotOfStream(const TStream& lhs, const TStream& rhs, typename TStream::TValueType* oResults) noexcept
+{
+  using TType = typename TStream::TValueType;
+  constexpr TIndex kDim = TStream::kDimension;
+  assert(lhs.size() == rhs.size());
+
+  std::array<const TType*, kDim> l;
+  std::array<const TType*, kDim> r;
+  for (TIndex axis = 0; axis < kDim; ++axis) { l[axis] = lhs.GetPlane(axis); r[axis] = rhs.GetPlane(axis); }
+
+  ForEachStreamChunk<TType>(lhs.size(),
+    [&l, &r, oResults](auto simd, TIndex i) MATH_SIMD_INLINE
+    {
+      using TSimd = decltype(simd);
+      auto sum = TSimd::Mul(TSimd::Load(l[0] + i), TSimd::Load(r[0] + i));
+      for (TIndex axis = 1; axis < kDim; ++axis)
+      {
+        sum = TSimd::Add(sum, TSimd::Mul(TSimd::Load(l[axis] + i), TSimd::Load(r[axis] + i)));
+      }
+      TSimd::StoreU(oResults + i, sum);
+    },
+    [&l, &r, oResults](TIndex i)
+    {
+      TType sum = l[0][i] * r[0][i];
+      for (TIndex axis = 1; axis < kDim; ++axis) { sum += l[axis][i] * r[axis][i]; }
+      oResults[i] = sum;
+    });
+}
+
+template <typename TStream>
+void NormalizeOfStream(const TStream& values, TStream& oResults)
+{
+  using TType = typename TStream::TValueType;
+  constexpr TIndex kDim = TStream::kDimension;
+  const TIndex count = values.size();
+  oResults.resize(count);
+
+  std::array<const TType*, kDim> src;
+  std::array<TType*, kDim> dst;
+  for (TIndex axis = 0; axis < kDim; ++axis) { src[axis] = values.GetPlane(axis); dst[axis] = oResults.GetPlane(axis); }
+
+  ForEachStreamChunk<TType>(count,
+    [&src, &dst](auto simd, TIndex i) MATH_SIMD_INLINE
+    {
+      using TSimd = decltype(simd);
+      typename TSimd::TReg v[kDim];
+      for (TIndex axis = 0; axis < kDim; ++axis) { v[axis] = TSimd::Load(src[axis] + i); }
+
+      auto squared = TSimd::Mul(v[0], v[0]);
+      for (TIndex axis = 1; axis < kDim; ++axis) { squared = TSimd::Add(squared, TSimd::Mul(v[axis], v[axis])); }
+      const auto length = TSimd::Sqrt(squared);
+      for (TIndex axis = 0; axis < kDim; ++axis) { TSimd::Store(dst[axis] + i, TSimd::Div(v[axis], length)); }
+    },
+    [&src, &dst](TIndex i)
+    {
+      std::array<TType, kDim> v;
+      for (TIndex axis = 0; axis < kDim; ++axis) { v[axis] = src[axis][i]; }
+
+      TType squared = v[0] * v[0];
+      for (TIndex axis = 1; axis < kDim; ++axis) { squared += v[axis] * v[axis]; }
+      const TType length = std::sqrt(squared);
+      for (TIndex axis = 0; axis < kDim; ++axis) { dst[axis][i] = v[axis] / length; }
+    });
+}
+
+template <typename TStream>
+void LerpOfStream(const TStream& lhs, const TStream& rhs, TReal factor, TStream& oResults)
+{
+  using TType = typename TStream::TValueType;
+  const TType lhsFactor = static_cast<TType>(1 - factor);
+  const TType rhsFactor = static_cast<TType>(factor);
+
+  TransformPlanesOf(lhs, rhs, oResults,
+    [lhsFactor, rhsFactor](auto simd, auto l, auto r) MATH_SIMD_INLINE
+    {
+      using TSimd = decltype(simd);
+      return TSimd::Add(TSimd::Mul(l, TSimd::Set1(lhsFactor)), TSimd::Mul(r, TSimd::Set1(rhsFactor)));
+    },
+    [lhsFactor, rhsFactor](TType l, TType r) { return l * lhsFactor + r * rhsFactor; });
+}
+
+template <typename TStream>
+void ExtractMinOfStream(const TStream& lhs, const TStream& rhs, TStream& oResults)
+{
+  using TType = typename TStream::TValueType;
+  // `std::min(l, r)` returns `r < l ? r : l`.
+  TransformPlanesOf(lhs, rhs, oResults,
+    [](auto simd, auto l, auto r) MATH_SIMD_INLINE { return decltype(simd)::Min(r, l); },
+    [](TType l, TType r) { return std::min(l, r); });
+}
+
+template <typename TStream>
+void ExtractMaxOfStream(const TStream& lhs, const TStream& rhs, TStream& oResults)
+{
+  using TType = typename TStream::TValueType;
+  // `std::max(l, r)` returns `l < r ? r : l`.
+  TransformPlanesOf(lhs, rhs, oResults,
+    [](auto simd, auto l, auto r) MATH_SIMD_INLINE { return decltype(simd)::Max(r, l); },
+    [](TType l, TType r) { return std::max(l, r); });
+}
+
+template <typename TStream>
+void AbsOfStream(const TStream& values, TStream& oResults)
+{
+  using TType = typename TStream::TValueType;
+  TransformPlanesOf(values, oResults,
+    [](auto simd, auto value) MATH_SIMD_INLINE { return decltype(simd)::Abs(value); },
+    [](TType value) { return std::abs(value); });
+}
+
+template <typename TStream>
+void SaturateOfStream(const TStream& values, TStream& oResults)
+{
+  using TType = typename TStream::TValueType;
+  // `Max(0, v)` and `Min(1, v)` return `v` when `v` is NaN, as `std::clamp` does.
+  TransformPlanesOf(values, oResults,
+    [](auto simd, auto value) MATH_SIMD_INLINE
+    {
+      using TSimd = decltype(simd);
+      return TSimd::Min(TSimd::Set1(TType(1)), TSimd::Max(TSimd::Set1(TType(0)), value));
+    },
+    [](TType value) { return std::clamp(value, TType(0), TType(1)); });
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+//!
+//! DVector3Stream
+//!
+
+template <typename TType>
+void Dot(const DVector3Stream<TType>& lhs, const DVector3Stream<TType>& rhs, TType* oResults) noexcept
+{
+  details::DotOfStream(lhs, rhs, oResults);
+}
+
+template <typename TType>
+void Cross(const DVector3Stream<TType>& lhs, const DVector3Stream<TType>& rhs, DVector3Stream<TType>& oResults)
+{
+  assert(lhs.size() == rhs.size());
+  const TIndex count = lhs.size();
+  oResults.resize(count);
+
+  const TType* lx = lhs.GetPlane(0); const TType* ly = lhs.GetPlane(1); const TType* lz = lhs.GetPlane(2);
+  const TType* rx = rhs.GetPlane(0); const TType* ry = rhs.GetPlane(1); const TType* rz = rhs.GetPlane(2);
+  TType* ox = oResults.GetPlane(0); TType* oy = oResults.GetPlane(1); TType* oz = oResults.GetPlane(2);
+
+  // (lY rZ - rY lZ, lZ rX - rZ lX, lX rY - rX lY), same to `Cross` of `DVector3`.
+  details::ForEachStreamChunk<TType>(count,
+    [=](auto simd, TIndex i) MATH_SIMD_INLINE
+    {
+      using TSimd = decltype(simd);
+      const auto vlx = TSimd::Load(lx + i); const auto vly = TSimd::Load(ly + i); const auto vlz = TSimd::Load(lz + i);
+      const auto vrx = TSimd::Load(rx + i); const auto vry = TSimd::Load(ry + i); const auto vrz = TSimd::Load(rz + i);
+      TSimd::Store(ox + i, TSimd::Sub(TSimd::Mul(vly, vrz), TSimd::Mul(vry, vlz)));
+      TSimd::Store(oy + i, TSimd::Sub(TSimd::Mul(vlz, vrx), TSimd::Mul(vrz, vlx)));
+      TSimd::Store(oz + i, TSimd::Sub(TSimd::Mul(vlx, vry), TSimd::Mul(vrx, vly)));
+    },
+    [=](TIndex i)
+    {
+      const TType x = ly[i] * rz[i] - ry[i] * lz[i];
+      const TType y = lz[i] * rx[i] - rz[i] * lx[i];
+      const TType z = lx[i] * ry[i] - rx[i] * ly[i];
+      ox[i] = x; oy[i] = y; oz[i] = z;
+    });
+}
+
+template <typename TType>
+void Lerp(const DVector3Stream<TType>& lhs, const DVector3Stream<TType>& rhs, TReal factor, DVector3Stream<TType>& oResults)
+{
+  details::LerpOfStream(lhs, rhs, factor, oResults);
+}
+
+template <typename TType>
+void Normalize(const DVector3Stream<TType>& values, DVector3Stream<TType>& oResults)
+{
+  details::NormalizeOfStream(values, oResults);
+}
+
+template <typename TType>
+void ExtractMin(const DVector3Stream<TType>& lhs, const DVector3Stream<TType>& rhs, DVector3Stream<TType>& oResults)
+{
+  details::ExtractMinOfStream(lhs, rhs, oResults);
+}
+
+template <typename TType>
+void ExtractMax(const DVector3Stream<TType>& lhs, const DVector3Stream<TType>& rhs, DVector3Stream<TType>& oResults)
+{
+  details::ExtractMaxOfStream(lhs, rhs, oResults);
+}
+
+template <typename TType>
+void Abs(const DVector3Stream<TType>& values, DVector3Stream<TType>& oResults)
+{
+  details::AbsOfStream(values, oResults);
+}
+
+template <typename TType>
+void Saturate(const DVector3Stream<TType>& values, DVector3Stream<TType>& oResults)
+{
+  details::SaturateOfStream(values, oResults);
+}
+
+//!
+//! DVector4Stream
+//!
+
+template <typename TType>
+void Dot(const DVector4Stream<TType>& lhs, const DVector4Stream<TType>& rhs, TType* oResults) noexcept
+{
+  details::DotOfStream(lhs, rhs, oResults);
+}
+
+template <typename TType>
+void Lerp(const DVector4Stream<TType>& lhs, const DVector4Stream<TType>& rhs, TReal factor, DVector4Stream<TType>& oResults)
+{
+  details::LerpOfStream(lhs, rhs, factor, oResults);
+}
+
+template <typename TType>
+void Normalize(const DVector4Stream<TType>& values, DVector4Stream<TType>& oResults)
+{
+  details::NormalizeOfStream(values, oResults);
+}
+
+template <typename TType>
+void ExtractMin(const DVector4Stream<TType>& lhs, const DVector4Stream<TType>& rhs, DVector4Stream<TType>& oResults)
+{
+  details::ExtractMinOfStream(lhs, rhs, oResults);
+}
+
+template <typename TType>
+void ExtractMax(const DVector4Stream<TType>& lhs, const DVector4Stream<TType>& rhs, DVector4Stream<TType>& oResults)
+{
+  details::ExtractMaxOfStream(lhs, rhs, oResults);
+}
+
+template <typename TType>
+void Abs(const DVector4Stream<TType>& values, DVector4Stream<TType>& oResults)
+{
+  details::AbsOfStream(values, oResults);
+}
+
+template <typename TType>
+void Saturate(const DVector4Stream<TType>& values, DVector4Stream<TType>& oResults)
+{
+  details::SaturateOfStream(values, oResults);
+}
+
+} /// ::dy::math namespace
+
+MATH_SIMD_KERNEL_REGION_END
@@ -0,0 +1,168 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <array>
+#include <cmath>
+#include <Math/Utility/XStreamMath.h>
+
+MATH_SIMD_KERNEL_REGION_BEGIN
+
+namespace dy::math::details
+{
+
+/// @brief Get mathematical columns of matrix, regardless of major.
+template <typename TType, EMatMajor TMajor>
+std::array<DVector4<TType>, 4> GetColumnsOf(const DMatrix4<TType, TMajor>& matrix) noexcept
+{
+  if constexpr (TMajor == EMatMajor::Column) { return matrix.__mValues; }
+  else                                       { return matrix.Transpose().__mValues; }
+}
+
+/// @brief Get mathematical rows of matrix, regardless of major.
+template <typename TType, EMatMajor TMajor>
+std::array<DVector4<TType>, 4> GetRowsOf(const DMatrix4<TType, TMajor>& matrix) noexcept
+{
+  if constexpr (TMajor == EMatMajor::Row) { return matrix.__mValues; }
+  else                                    { return matrix.Transpose().__mValues; }
+}
+
+/// @brief Transform stream `(x, y, z, w)` as `columns * v`, where `w` is 1 or 0 by `TIsPoint`.
+template <bool TIsPoint, typename TType>
+void TransformStreamOf(
+  const std::array<DVector4<TType>, 4>& columns,
+  const DVector3Stream<TType>& iValues, DVector3Stream<TType>& oValues)
+{
+  const TIndex count = iValues.size();
+  oValues.resize(count);
+
+  const TType* ix = iValues.GetPlane(0);
+  const TType* iy = iValues.GetPlane(1);
+  const TType* iz = iValues.GetPlane(2);
+  std::array<TType*, 3> o = {oValues.GetPlane(0), oValues.GetPlane(1), oValues.GetPlane(2)};
+
+  // Element (row, col) of matrix is `columns[col][row]`.
+  ForEachStreamChunk<TType>(count,
+    [&columns, ix, iy, iz, &o](auto simd, TIndex i) MATH_SIMD_INLINE
+    {
+      using TSimd = decltype(simd);
+      const auto x = TSimd::Load(ix + i);
+      const auto y = TSimd::Load(iy + i);
+      const auto z = TSimd::Load(iz + i);
+      for (TIndex row = 0; row < 3; ++row)
+      {
+        auto value = TSimd::Mul(TSimd::Set1(columns[0][row]), x);
+        value = TSimd::Add(value, TSimd::Mul(TSimd::Set1(columns[1][row]), y));
+        value = TSimd::Add(value, TSimd::Mul(TSimd::Set1(columns[2][row]), z));
+        if constexpr (TIsPoint == true) { value = TSimd::Add(value, TSimd::Set1(columns[3][row])); }
+        TSimd::Store(o[row] + i, value);
+      }
+    },
+    [&columns, ix, iy, iz, &o](TIndex i)
+    {
+      const TType x = ix[i];
+      const TType y = iy[i];
+      const TType z = iz[i];
+      for (TIndex row = 0; row < 3; ++row)
+      {
+        TType value = columns[0][row] * x + columns[1][row] * y + columns[2][row] * z;
+        if constexpr (TIsPoint == true) { value += columns[3][row]; }
+        o[row][i] = value;
+      }
+    });
+}
+
+} /// ::dy::math::details namespace
+
+namespace dy::math
+{
+
+template <typename TType, EMatMajor TMajor>
+void TransformPoints(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DVector3<TType>* iPoints, TIndex count, DVector3<TType>* oPoints) noexcept
+{
+  const auto c = details::GetColumnsOf(matrix);
+  for (TIndex i = 0; i < count; ++i)
+  {
+    const auto& p = iPoints[i];
+    const DVector4<TType> result = c[0] * p.X + c[1] * p.Y + c[2] * p.Z + c[3];
+    oPoints[i] = {result.X, result.Y, result.Z};
+  }
+}
+
+template <typename TType, EMatMajor TMajor>
+void TransformPoints(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DVector4<TType>* iPoints, TIndex count, DVector4<TType>* oPoints) noexcept
+{
+  const auto c = details::GetColumnsOf(matrix);
+  for (TIndex i = 0; i < count; ++i)
+  {
+    const auto& p = iPoints[i];
+    oPoints[i] = c[0] * p.X + c[1] * p.Y + c[2] * p.Z + c[3] * p.W;
+  }
+}
+
+template <typename TType, EMatMajor TMajor>
+void TransformPoints(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DVector3Stream<TType>& iPoints, DVector3Stream<TType>& oPoints)
+{
+  details::TransformStreamOf<true>(details::GetColumnsOf(matrix), iPoints, oPoints);
+}
+
+template <typename TType, EMatMajor TMajor>
+void TransformDirections(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DVector3<TType>* iDirections, TIndex count, DVector3<TType>* oDirections) noexcept
+{
+  const auto c = details::GetColumnsOf(matrix);
+  for (TIndex i = 0; i < count; ++i)
+  {
+    const auto& d = iDirections[i];
+    const DVector4<TType> result = c[0] * d.X + c[1] * d.Y + c[2] * d.Z;
+    oDirections[i] = {result.X, result.Y, result.Z};
+  }
+}
+
+template <typename TType, EMatMajor TMajor>
+void TransformDirections(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DVector3Stream<TType>& iDirections, DVector3Stream<TType>& oDirections)
+{
+  details::TransformStreamOf<false>(details::GetColumnsOf(matrix), iDirections, oDirections);
+}
+
+template <typename TType, EMatMajor TMajor>
+void TransformPlanes(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DPlane<TType>* iPlanes, TIndex count, DPlane<TType>* oPlanes)
+{
+  // Columns of inverse transpose are rows of inverse.
+  const auto c = details::GetRowsOf(matrix.Inverse());
+  for (TIndex i = 0; i < count; ++i)
+  {
+    const auto normal = iPlanes[i].GetNormal();
+    const DVector4<TType> result = c[0] * normal.X + c[1] * normal.Y + c[2] * normal.Z + c[3] * iPlanes[i].GetD();
+
+    const TType length = std::sqrt(result.X * result.X + result.Y * result.Y + result.Z * result.Z);
+    oPlanes[i] = DPlane<TType>{
+      DVector3<TType>{result.X / length, result.Y / length, result.Z / length},
+      result.W / length};
+  }
+}
+
+} /// ::dy::math namespace
+
+MATH_SIMD_KERNEL_REGION_END
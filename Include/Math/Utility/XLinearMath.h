@@ -23,27 +23,27 @@ namespace dy::math
 /// @brief Do dot product of (x, y) R^2 vector.
 /// @return Dot product float value.
 template <typename TLeft, typename TRight>
-TReal Dot(const DVector2<TLeft>& lhs, const DVector2<TRight>& rhs) noexcept;
+constexpr TReal Dot(const DVector2<TLeft>& lhs, const DVector2<TRight>& rhs) noexcept;
 
 /// @brief Do dot product of (x, y, z) R^3 vector.
 /// @return Dot product float value.
 template <typename TLeft, typename TRight>
-TReal Dot(const DVector3<TLeft>& lhs, const DVector3<TRight>& rhs) noexcept;
+constexpr TReal Dot(const DVector3<TLeft>& lhs, const DVector3<TRight>& rhs) noexcept;
 
 /// @brief Do dot product of (x, y, z, w) R^4 vector.
 /// @return Dot product float value.
 template <typename TLeft, typename TRight>
-TReal Dot(const DVector4<TLeft>& lhs, const DVector4<TRight>& rhs) noexcept;
+constexpr TReal Dot(const DVector4<TLeft>& lhs, const DVector4<TRight>& rhs) noexcept;
 
 /// @brief Do dot product of (w, ijk(x, y, z)) Quaternion.
 /// @return Dot product float value.
 template <typename TLeft, typename TRight>
-TReal Dot(const DQuaternion<TLeft>& lhs, const DQuaternion<TRight>& rhs) noexcept;
+constexpr TReal Dot(const DQuaternion<TLeft>& lhs, const DQuaternion<TRight>& rhs) noexcept;
 
 /// @brief Cross product of (x, y, z) R^3 vector.
 /// @return Cross product float value.
 template <typename TLeft, typename TRight>
-DVector3<GetBiggerType<TLeft, TRight>> 
+constexpr DVector3<GetBiggerType<TLeft, TRight>> 
 Cross(const DVector3<TLeft>& lhs, const DVector3<TRight>& rhs) noexcept;
 
 /// @brief Do linear interpolation with plain value type.
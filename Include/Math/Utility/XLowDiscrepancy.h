@@ -0,0 +1,93 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Type/Math/DVector2.h>
+#include <Math/Type/Math/DVector3.h>
+
+namespace dy::math
+{
+
+//!
+//! Low-discrepancy (quasi-random) sequences. Each function gets coordinate `dim` of `index`-th point directly,
+//! without state, so points can be made from any thread in any order.
+//! Values are in [0, 1). Vector functions get coordinates `dim`, `dim + 1` (and `dim + 2`).
+//! Owen scrambled Sobol functions get `seed` after them, as `(index, dim, seed)`.
+//! Tiled blue noise is `DBlueNoiseTile`.
+//!
+
+/// @brief The number of dimensions of `SobolSample`.
+constexpr TU32 kSobolDimensionCount = 21;
+/// @brief The number of dimensions of `HaltonSample`.
+constexpr TU32 kHaltonDimensionCount = 64;
+
+/// @brief Get coordinate of Sobol sequence. `dim` must be less than `kSobolDimensionCount`.
+/// Each power of 2 of points from 0 is stratified in each dimension. Direction numbers are from Joe and Kuo.
+/// @reference https://web.maths.unsw.edu.au/~fkuo/sobol/
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+TType SobolSample(TU32 index, TU32 dim) noexcept;
+
+/// @brief Get coordinate of Owen scrambled Sobol sequence. Points of different `seed` are independent
+/// randomization of Sobol sequence, but keep stratification of it. `index` is also scrambled by seed,
+/// so points of different seed are not correlated. `dim` must be less than `kSobolDimensionCount`.
+/// @reference https://jcgt.org/published/0009/04/01/ (Practical Hash-based Owen Scrambling)
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+TType OwenSobolSample(TU32 index, TU32 dim, TU32 seed) noexcept;
+
+/// @brief Get coordinate of Halton sequence, which is radical inverse of index with `dim`-th prime.
+/// `dim` must be less than `kHaltonDimensionCount`. Dimensions of large prime are correlated with short sequence.
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+TType HaltonSample(TU32 index, TU32 dim) noexcept;
+
+/// @brief Get coordinate of R_d sequence of `TDimensions` dimensions (R2 when 2), `frac(0.5 + index * alpha_dim)`
+/// with inverse powers of generalized golden ratio. `dim` must be less than `TDimensions`.
+/// Point is got in 64-bit fixed point, so large index does not lose precision.
+/// @reference http://extremelearning.com.au/unreasonable-effectiveness-of-quasirandom-sequences/
+template <typename TType = TReal, TU32 TDimensions = 2, typename = std::enable_if_t<kIsRealType<TType>>>
+TType RdSample(TU32 index, TU32 dim) noexcept;
+
+/// @brief Get 2D point of Sobol sequence.
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector2<TType> SobolVector2(TU32 index, TU32 dim = 0) noexcept;
+
+/// @brief Get 3D point of Sobol sequence.
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector3<TType> SobolVector3(TU32 index, TU32 dim = 0) noexcept;
+
+/// @brief Get 2D point of Owen scrambled Sobol sequence. Parameters are same to `OwenSobolSample`.
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector2<TType> OwenSobolVector2(TU32 index, TU32 dim, TU32 seed) noexcept;
+
+/// @brief Get 3D point of Owen scrambled Sobol sequence. Parameters are same to `OwenSobolSample`.
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector3<TType> OwenSobolVector3(TU32 index, TU32 dim, TU32 seed) noexcept;
+
+/// @brief Get 2D point of Halton sequence.
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector2<TType> HaltonVector2(TU32 index, TU32 dim = 0) noexcept;
+
+/// @brief Get 3D point of Halton sequence.
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector3<TType> HaltonVector3(TU32 index, TU32 dim = 0) noexcept;
+
+/// @brief Get 2D point of R2 sequence.
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector2<TType> RdVector2(TU32 index) noexcept;
+
+/// @brief Get 3D point of R3 sequence.
+template <typename TType = TReal, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector3<TType> RdVector3(TU32 index) noexcept;
+
+} /// ::dy::math namespace
+#include <Math/Utility/Inline/XLowDiscrepancy.inl>
@@ -19,6 +19,7 @@
 #include <Math/Type/Math/DVector2.h>
 #include <Math/Type/Math/DVector3.h>
 #include <Math/Type/Math/DVector4.h>
+#include <Math/Type/Micellanous/DRootSet.h>
 
 namespace dy::math
 {
@@ -47,6 +48,10 @@ constexpr TType kToDegree = TType(180) / kPi<TType>;
 template <typename TType>
 constexpr TType MapValue(TType value, TType start, TType end) noexcept;
 
+/// @brief Get 30-bit morton code (Z-order) of 3D coordinate. Only lower 10 bits of each element are used.
+/// Bits of `x` are placed at the highest of each 3 bits, and `z` at the lowest.
+constexpr TU32 GetMortonCodeOf(TU32 x, TU32 y, TU32 z) noexcept;
+
 /// @brief Check float lhs is nearly equal to rhs.
 /// floating-point number type like a float and double has a natural problem like
 /// a floating-error such as 0.1 but 0.10000007, so you have to use this function
@@ -232,8 +237,62 @@ std::vector<TReal> SolveCubic(TReal c3, TReal c2, TReal c1, TReal c0);
 /// @return Sorted root values.
 std::vector<TReal> SolveQuartic(TReal c4, TReal c3, TReal c2, TReal c1, TReal c0);
 
+/// @brief Solve quadric equation like `SolveQuadric`, but without heap allocation.
+/// @return Sorted root values.
+DRootSet<TReal, 2> SolveQuadricRoots(TReal c2, TReal c1, TReal c0) noexcept;
+
+/// @brief Solve cubic equation like `SolveCubic`, but without heap allocation.
+/// @return Sorted root values.
+DRootSet<TReal, 3> SolveCubicRoots(TReal c3, TReal c2, TReal c1, TReal c0) noexcept;
+
+/// @brief Solve quartic equation like `SolveQuartic`, but without heap allocation.
+/// @return Root values.
+DRootSet<TReal, 4> SolveQuarticRoots(TReal c4, TReal c3, TReal c2, TReal c1, TReal c0) noexcept;
+
+/// @brief Solve `count` quadric equations at once. Coefficients are given as structure of arrays.
+/// When `MATH_ENABLE_SIMD` or `MATH_ENABLE_SIMD_DISPATCH` is defined and TReal is `TF32`, 
+/// 4, 8 or 16 equations are solved at once without branch. Root counts follow `SolveQuadricRoots`.
+/// @param count The number of equations.
+/// @param c2 Coefficients of second-order term, `count` length.
+/// @param c1 Coefficients of first-order term, `count` length.
+/// @param c0 Constant values, `count` length.
+/// @param oRootCounts The number of real roots of each equation, `count` length.
+/// @param oRoots Sorted roots, `2 * count` length. k-th root of i-th equation is `oRoots[k * count + i]`.
+/// Unused root slots are set to infinity.
+void SolveQuadricBatch(
+  TIndex count, const TReal* c2, const TReal* c1, const TReal* c0, 
+  TU32* oRootCounts, TReal* oRoots) noexcept;
+
+/// @brief Solve `count` cubic equations at once. Coefficients are given as structure of arrays.
+/// When `MATH_ENABLE_SIMD` or `MATH_ENABLE_SIMD_DISPATCH` is defined and TReal is `TF32`, 
+/// 4, 8 or 16 equations are solved at once without branch. Root counts follow `SolveCubicRoots`.
+/// Lane roots are polished with one newton step, and are within 1e-4 relative error (to `max(1, |root|)`)
+/// of exact roots. Near repeated roots, `SolveCubicRoots` of `TF32` itself loses precision,
+/// so roots can differ from it by about 5e-3.
+/// @param oRootCounts The number of real roots of each equation, `count` length.
+/// @param oRoots Sorted roots, `3 * count` length. k-th root of i-th equation is `oRoots[k * count + i]`.
+/// Unused root slots are set to infinity.
+void SolveCubicBatch(
+  TIndex count, const TReal* c3, const TReal* c2, const TReal* c1, const TReal* c0, 
+  TU32* oRootCounts, TReal* oRoots) noexcept;
+
+/// @brief Solve `count` quartic equations at once. Coefficients are given as structure of arrays.
+/// When `MATH_ENABLE_SIMD` or `MATH_ENABLE_SIMD_DISPATCH` is defined and TReal is `TF32`, 
+/// 4, 8 or 16 equations are solved at once without branch. Root counts follow `SolveQuarticRoots`.
+/// Lane roots are polished with one newton step, and most of them are within 1e-5 relative error of exact roots,
+/// but near repeated roots both this and `SolveQuarticRoots` of `TF32` lose precision to about 1e-1.
+/// Root count can also differ from `SolveQuarticRoots` when roots are nearly repeated, because branches
+/// are selected by tolerance of `TF32` values computed with different rounding.
+/// @param oRootCounts The number of real roots of each equation, `count` length.
+/// @param oRoots Sorted roots, `4 * count` length. k-th root of i-th equation is `oRoots[k * count + i]`.
+/// Unused root slots are set to infinity.
+void SolveQuarticBatch(
+  TIndex count, const TReal* c4, const TReal* c3, const TReal* c2, const TReal* c1, const TReal* c0, 
+  TU32* oRootCounts, TReal* oRoots) noexcept;
+
 } /// ::dy::math namespace
 #include <Math/Utility/Inline/XMath/MapValue.inl>
+#include <Math/Utility/Inline/XMath/Morton.inl>
 #include <Math/Utility/Inline/XMath/IsNearlyEqual.inl>
 #include <Math/Utility/Inline/XMath/Lerp.inl>
 #include <Math/Utility/Inline/XMath/ToNormalized.inl>
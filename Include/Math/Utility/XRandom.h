@@ -16,39 +16,123 @@
 #include <Math/Common/TGlobalTypes.h>
 #include <Math/Type/Math/DVector2.h>
 #include <Math/Type/Math/DVector3.h>
+#include <Math/Type/Micellanous/DRandomEngine.h>
 #include <Math/Type/Micellanous/ERandomPolicy.h>
+#include <Math/Utility/XSampling.h>
 
 namespace dy::math
 {
 
+//!
+//! Functions without engine parameter use engine of calling thread (`GetThreadRandomEngine`),
+//! so they can be called from multiple threads without lock.
+//! Functions with engine parameter accept any engine of `DRandomEngine.h` or `std` engine.
+//! Engines which make full 32-bit or 64-bit range (all engines of `DRandomEngine.h`, `std::mt19937` and
+//! `std::mt19937_64`) use inlined conversion from bits, instead of `std` distribution.
+//!
+
 /// @brief Get uniform random Integer value.
 template <typename TType = TI32, typename = std::enable_if_t<kIsIntegerType<TType>>>
 TType RandomUniformInteger(TType start = kMinValueOf<TType>, TType inclusiveEnd = kMaxValueOf<TType>) noexcept;
 
+/// @brief Get uniform random Integer value with given engine.
+/// Uses nearly-divisionless bounded integer of Lemire, which needs one multiplication mostly.
+/// @reference https://arxiv.org/abs/1805.10941
+template <
+  typename TType = TI32, typename TEngine, 
+  typename = std::enable_if_t<kIsIntegerType<TType> && kIsRandomEngine<TEngine>>>
+TType RandomUniformInteger(
+  TEngine& engine, 
+  TType start = kMinValueOf<TType>, TType inclusiveEnd = kMaxValueOf<TType>) noexcept;
+
 /// @brief Get uniform random real value.
 template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
-TF32 RandomUniformReal(TType start = kMinValueOf<TType>, TType end = kMaxValueOf<TType>) noexcept;
+TType RandomUniformReal(TType start = kMinValueOf<TType>, TType end = kMaxValueOf<TType>) noexcept;
+
+/// @brief Get uniform random real value with given engine.
+/// Value in [0, 1) is made from the highest 24 (TF32) or 53 (TF64) bits, and scaled into range.
+template <
+  typename TType, typename TEngine, 
+  typename = std::enable_if_t<kIsRealType<TType> && kIsRandomEngine<TEngine>>>
+TType RandomUniformReal(TEngine& engine, TType start = kMinValueOf<TType>, TType end = kMaxValueOf<TType>) noexcept;
 
+/// @brief Append `iCount` uniform random integer values to `oContainer`. See `FillUniform`.
 template <typename TType, typename = std::enable_if_t<kIsIntegerType<TType>>>
 void RandomUniformIntegers(
-  std::size_t iCount, std::vector<TType> oContainer, 
-  TType iStart = kMinValueOf<TType>, TType iInclusiveEnd = kMaxValueOf<TType>) noexcept;
+  std::size_t iCount, std::vector<TType>& oContainer, 
+  TType iStart = kMinValueOf<TType>, TType iInclusiveEnd = kMaxValueOf<TType>);
 
+/// @brief Append `iCount` uniform random real values to `oContainer`. See `FillUniform`.
 template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
 void RandomUniformReals(
-  std::size_t iCount, std::vector<TType> oContainer, 
-  TType iStart = kMinValueOf<TType>, TType iEnd = kMaxValueOf<TType>) noexcept;
+  std::size_t iCount, std::vector<TType>& oContainer, 
+  TType iStart = kMinValueOf<TType>, TType iEnd = kMaxValueOf<TType>);
+
+//!
+//! Bulk functions write random values into `count` values of preallocated memory.
+//! Values are made from `DRandomLaneEngine` (of calling thread when engine is not given), 16 values at once,
+//! and loops over lanes are compiled with SIMD instruction set of `MATH_ENABLE_SIMD` or `MATH_ENABLE_SIMD_DISPATCH`.
+//! `TF32` uses polynomial `log`, `sin` and `cos` (error less than 1e-6) which can be vectorized,
+//! and other real types use `std` functions.
+//!
+
+/// @brief Write uniform random values. Real values are in [start, end), and integer values are in [start, end].
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType> || kIsIntegerType<TType>>>
+void FillUniform(TType* oValues, TIndex count, TType start, TType end) noexcept;
+
+/// @brief Write uniform random values with given engine.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType> || kIsIntegerType<TType>>>
+void FillUniform(DRandomLaneEngine& engine, TType* oValues, TIndex count, TType start, TType end) noexcept;
+
+/// @brief Write normal distributed random values, with Box-Muller transform.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void FillNormal(TType* oValues, TIndex count, TType mean = 0, TType deviation = 1) noexcept;
+
+/// @brief Write normal distributed random values with given engine.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void FillNormal(DRandomLaneEngine& engine, TType* oValues, TIndex count, TType mean = 0, TType deviation = 1) noexcept;
+
+/// @brief Write uniform random points on sphere of `radius` around origin.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void FillOnSphere(DVector3<TType>* oValues, TIndex count, TReal radius = 1) noexcept;
+
+/// @brief Write uniform random points on sphere with given engine.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void FillOnSphere(DRandomLaneEngine& engine, DVector3<TType>* oValues, TIndex count, TReal radius = 1) noexcept;
+
+/// @brief Write uniform random points in disk of `radius` around origin.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void FillInDisk(DVector2<TType>* oValues, TIndex count, TReal radius = 1) noexcept;
+
+/// @brief Write uniform random points in disk with given engine.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void FillInDisk(DRandomLaneEngine& engine, DVector2<TType>* oValues, TIndex count, TReal radius = 1) noexcept;
 
 /// @brief Get DVec2 (x, y) instance have length 'length'.
 /// @reference http://nbeloglazov.com/2017/04/09/random-vector-generation.html
 template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
 DVector2<TType> RandomVector2Length(TReal length) noexcept;
 
-/// @brief Get DVec3 (x, y, z) instance have length 'length'.
+/// @brief Get DVec2 (x, y) instance have length 'length' with given engine.
+template <
+  typename TType, typename TEngine, 
+  typename = std::enable_if_t<kIsRealType<TType> && kIsRandomEngine<TEngine>>>
+DVector2<TType> RandomVector2Length(TEngine& engine, TReal length) noexcept;
+
+/// @brief Get DVec3 (x, y, z) instance have length 'length', uniformly distributed on sphere.
+/// See `SampleUniformSphere`.
 template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
 DVector3<TType> RandomVector3Length(TReal length) noexcept;
 
+/// @brief Get DVec3 (x, y, z) instance have length 'length' with given engine.
+template <
+  typename TType, typename TEngine, 
+  typename = std::enable_if_t<kIsRealType<TType> && kIsRandomEngine<TEngine>>>
+DVector3<TType> RandomVector3Length(TEngine& engine, TReal length) noexcept;
+
 /// @brief Get DVec2 (x, y) which have length that in range from 'from' to 'priorTo'
+/// `ERandomPolicy::Discrete` makes length of normal distribution around center of range,
+/// of which deviation is 1/6 of range, clamped into range.
 /// @reference http://mathworld.wolfram.com/SpherePointPicking.html
 /// @reference https://en.wikipedia.org/wiki/Multivariate_normal_distribution
 template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
@@ -0,0 +1,112 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Type/Math/DVector2.h>
+#include <Math/Type/Math/DVector3.h>
+#include <Math/Type/Math/DVector3Stream.h>
+#include <Math/Type/Micellanous/DBounds3D.h>
+
+namespace dy::math
+{
+
+//!
+//! Sampling functions map uniform sample in [0, 1)^2 (or [0, 1)^3) into uniform points of shape,
+//! without rejection and branch, so stratification of low-discrepancy samples (`XLowDiscrepancy.h`) is kept.
+//! Samples can be also random values of `XRandom.h`. Directions are around +Z axis.
+//!
+//! `TF32` uses polynomial `sin` and `cos` (error less than 1e-6), and other real types use `std` functions.
+//! Batch functions process `count` samples of planes `samples0` and `samples1`, with SIMD instruction set of
+//! `MATH_ENABLE_SIMD` or `MATH_ENABLE_SIMD_DISPATCH` for `TF32`, and give same result of scalar functions
+//! up to rounding of FMA contraction. (GCC fuses multiply and add of AVX2 and AVX-512 kernels by default,
+//! but not of scalar functions. Bit-identical results need `-ffp-contract=off`)
+//! `oPoints` is resized to `count`.
+//!
+
+/// @brief Get uniform point on unit sphere. z is `1 - 2 sample.X` and angle around z is `2 pi sample.Y`.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector3<TType> SampleUniformSphere(const DVector2<TType>& sample) noexcept;
+
+/// @brief Get uniform point on unit hemisphere of +Z. Probability density is `1 / 2pi`.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector3<TType> SampleUniformHemisphere(const DVector2<TType>& sample) noexcept;
+
+/// @brief Get cosine-weighted point on unit hemisphere of +Z, which is point of `SampleUniformDisk` projected up.
+/// Probability density is `cos(theta) / pi`.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector3<TType> SampleCosineHemisphere(const DVector2<TType>& sample) noexcept;
+
+/// @brief Get uniform point in unit disk, with concentric mapping of Shirley and Chiu
+/// which keeps adjacency and area ratio of samples.
+/// @reference https://doi.org/10.1080/10867651.1997.10487479
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector2<TType> SampleUniformDisk(const DVector2<TType>& sample) noexcept;
+
+/// @brief Get uniform direction in cone of +Z, of which half angle has cosine `cosThetaMax`.
+/// Probability density is `1 / (2pi (1 - cosThetaMax))`.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector3<TType> SampleUniformCone(const DVector2<TType>& sample, TReal cosThetaMax) noexcept;
+
+/// @brief Get barycentric coordinate (b0, b1) of uniform point in triangle. b2 is `1 - b0 - b1`.
+/// Uses low-distortion mapping of Heitz, which does not fold square.
+/// @reference https://hal.archives-ouvertes.fr/hal-02073696
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector2<TType> SampleUniformTriangle(const DVector2<TType>& sample) noexcept;
+
+/// @brief Get uniform point in triangle (p0, p1, p2).
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector3<TType> SampleUniformTriangle(
+  const DVector2<TType>& sample, 
+  const DVector3<TType>& p0, const DVector3<TType>& p1, const DVector3<TType>& p2) noexcept;
+
+/// @brief Get uniform point in bounds.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+DVector3<TType> SampleUniformBounds(const DVector3<TType>& sample, const DBounds3D<TType>& bounds) noexcept;
+
+/// @brief Write points of `SampleUniformSphere`.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void SampleUniformSpheres(const TType* samples0, const TType* samples1, TIndex count, DVector3Stream<TType>& oPoints);
+
+/// @brief Write points of `SampleUniformHemisphere`.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void SampleUniformHemispheres(const TType* samples0, const TType* samples1, TIndex count, DVector3Stream<TType>& oPoints);
+
+/// @brief Write points of `SampleCosineHemisphere`.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void SampleCosineHemispheres(const TType* samples0, const TType* samples1, TIndex count, DVector3Stream<TType>& oPoints);
+
+/// @brief Write points of `SampleUniformDisk` into `oX` and `oY`, which must have `count` values.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void SampleUniformDisks(const TType* samples0, const TType* samples1, TIndex count, TType* oX, TType* oY) noexcept;
+
+/// @brief Write directions of `SampleUniformCone`.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void SampleUniformCones(
+  const TType* samples0, const TType* samples1, TIndex count, TReal cosThetaMax, 
+  DVector3Stream<TType>& oPoints);
+
+/// @brief Write points of `SampleUniformTriangle` in triangle (p0, p1, p2).
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void SampleUniformTriangles(
+  const TType* samples0, const TType* samples1, TIndex count,
+  const DVector3<TType>& p0, const DVector3<TType>& p1, const DVector3<TType>& p2,
+  DVector3Stream<TType>& oPoints);
+
+/// @brief Write points of `SampleUniformBounds` of each sample of `samples`.
+template <typename TType, typename = std::enable_if_t<kIsRealType<TType>>>
+void SampleUniformBounds(
+  const DVector3Stream<TType>& samples, const DBounds3D<TType>& bounds, DVector3Stream<TType>& oPoints);
+
+} /// ::dy::math namespace
+#include <Math/Utility/Inline/XSampling.inl>
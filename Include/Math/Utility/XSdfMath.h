@@ -0,0 +1,78 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <array>
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Type/Math/DVector3.h>
+#include <Math/Type/Math/DVector3Stream.h>
+#include <Math/Type/Shape/DRayPacket.h>
+
+namespace dy::math
+{
+
+/// @struct DSphereTraceOption
+/// @brief Option of `SphereTrace`.
+struct DSphereTraceOption final
+{
+  /// Maximum number of SDF evaluations of each ray.
+  TIndex mMaxSteps = 128;
+  /// 't' where each ray starts.
+  TReal mMinT = 0;
+  /// Ray which goes farther than this is missed.
+  TReal mMaxT = TReal(1000);
+  /// Ray hits surface when absolute SDF value is less than this.
+  TReal mHitEpsilon = TReal(1e-3);
+  /// Over-relaxation factor `w` in [1, 2). Each step goes `w` times of SDF value, and goes back to
+  /// normal step when unbounding spheres of two steps do not overlap. 1 is plain sphere tracing.
+  /// Relaxation reduces steps of rays grazing surfaces, but can add one step to rays hitting surfaces directly.
+  TReal mRelaxation = TReal(1);
+  /// Offset to get normal from SDF values around hit point.
+  TReal mNormalEpsilon = TReal(1e-3);
+};
+
+/// @struct DSphereTraceResult
+/// @brief Result of `SphereTrace` of each lane of ray packet.
+template <typename TType, TIndex TLanes>
+struct DSphereTraceResult final
+{
+  /// 't' of hit point. Lanes that are not hit are set to infinity.
+  std::array<TReal, TLanes> mTValues = {};
+  /// Normalized normal at hit point. Lanes that are not hit are set to zero vector.
+  std::array<DVector3<TType>, TLanes> mNormals = {};
+  /// The number of SDF evaluations of each lane, without evaluations for normal.
+  std::array<TU32, TLanes> mStepCounts = {};
+  /// Bit mask of hit lanes.
+  TU32 mHitMask = 0;
+};
+
+/// @brief March rays of packet with sphere tracing, and get hit 't', normal and step count of each lane.
+///
+/// `evaluator` is DSdfScene, DSdfBrickGrid or other type which has `GetSDFValuesOf(points, oValues)`,
+/// or callable as `evaluator(const DVector3Stream<TType>& points, TReal* oValues)`, which writes
+/// SDF value of each point. Each call has positions of rays which are not terminated yet,
+/// so finished rays do not cost evaluation and marching stops when all rays are terminated.
+/// Normals of hit lanes are got with one more call, from 4 points around hit point (tetrahedron technique).
+///
+/// Ray which starts inside (negative SDF value) marches to the surface of exiting.
+/// Direction of rays should be normalized, otherwise steps are scaled.
+/// @return Bit mask of hit lanes, same to `oResult.mHitMask`.
+template <typename TType, TIndex TLanes, typename TEvaluator>
+TU32 SphereTrace(
+  const DRayPacket<TType, TLanes>& rays,
+  TEvaluator&& evaluator,
+  const DSphereTraceOption& option,
+  DSphereTraceResult<TType, TLanes>& oResult);
+
+} /// ::dy::math namespace
+#include <Math/Utility/Inline/XSdfMath.inl>
@@ -13,10 +13,12 @@
 ///
 
 #include <optional>
+#include <vector>
 #include <Math/Common/TGlobalTypes.h>
 #include <Math/Type/Math/DVector3.h>
 #include <Math/Type/Math/DQuat.h>
 #include <Math/Type/Shape/DRay.h>
+#include <Math/Type/Shape/DRayPacket.h>
 #include <Math/Type/Shape/DSphere.h>
 #include <Math/Type/Shape/DBox.h>
 #include <Math/Type/Shape/DPlane.h>
@@ -24,6 +26,7 @@
 #include <Math/Type/Shape/DCone.h>
 #include <Math/Type/Shape/DCapsule.h>
 #include <Math/Type/Micellanous/DBounds3D.h>
+#include <Math/Type/Micellanous/DRootSet.h>
 
 namespace dy::math
 {
@@ -419,6 +422,73 @@ std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& c
 template <typename TType>
 std::vector<TReal> GetTValuesOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DQuaternion<TType>& rot);
 
+//!
+//! GetTValueSetOf
+//!
+//! Same to `GetTValuesOf`, but return fixed-capacity DRootSet without heap allocation.
+//! A ray can hit torus at most 4 times, and other shapes at most 3 times.
+//!
+
+/// @brief Get sorted positive 't' set to the point of given DBounds3D from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DBounds3D<TType>& bounds);
+
+/// @brief Get sorted positive 't' set to the point of given DSphere from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DSphere<TType>& sphere);
+
+/// @brief Get sorted positive 't' set to the point of given DBox from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DBox<TType>& box);
+
+/// @brief Get sorted positive 't' set to the point of given DBox with rotation matrix from given ray.
+template <typename TType, EMatMajor TMajor>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DBox<TType>& box, const DMatrix3<TType, TMajor>& rot);
+
+/// @brief Get sorted positive 't' set to the point of given DBox with rotation quaternion from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DBox<TType>& box, const DQuaternion<TType>& rot);
+
+/// @brief Get sorted positive 't' set to the point of given DPlane from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DPlane<TType>& plane);
+
+/// @brief Get sorted positive 't' set to the point of given DTorus from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DTorus<TType>& torus);
+
+/// @brief Get sorted positive 't' set to the point of given DTorus with rotation matrix from given ray.
+template <typename TType, EMatMajor TMajor>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DMatrix3<TType, TMajor>& rot);
+
+/// @brief Get sorted positive 't' set to the point of given DTorus with rotation quaternion from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DTorus<TType>& torus, const DQuaternion<TType>& rot);
+
+/// @brief Get sorted positive 't' set to the point of given DCone from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCone<TType>& cone);
+
+/// @brief Get sorted positive 't' set to the point of given DCone with rotation matrix from given ray.
+template <typename TType, EMatMajor TMajor>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCone<TType>& cone, const DMatrix3<TType, TMajor>& rot);
+
+/// @brief Get sorted positive 't' set to the point of given DCone with rotation quaternion from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCone<TType>& cone, const DQuaternion<TType>& rot);
+
+/// @brief Get sorted positive 't' set to the point of given DCapsule from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCapsule<TType>& capsule);
+
+/// @brief Get sorted positive 't' set to the point of given DCapsule with rotation matrix from given ray.
+template <typename TType, EMatMajor TMajor>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DMatrix3<TType, TMajor>& rot);
+
+/// @brief Get sorted positive 't' set to the point of given DCapsule with rotation quaternion from given ray.
+template <typename TType>
+DRootSet<TReal, 4> GetTValueSetOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DQuaternion<TType>& rot);
+
 //!
 //! GetClosestTValueOf
 //!
@@ -613,6 +683,62 @@ template <typename TType>
 std::optional<DVector3<TType>> 
 GetNormalOf(const DRay<TType>& ray, const DCapsule<TType>& capsule, const DQuaternion<TType>& rot);
 
+//!
+//! Ray packet functions
+//!
+//! Each function tests all rays of DRayPacket against one shape, and returns bit mask of hit lanes.
+//! (lane `i` is bit `i`) Results are same to scalar `IsRayIntersected` and `GetClosestTValueOf`
+//! of each ray. When `MATH_ENABLE_SIMD` is defined and TType and TReal are `TF32`, lanes are
+//! processed with SSE4.1 (and AVX when `__AVX__` is defined). With `MATH_ENABLE_SIMD_DISPATCH`,
+//! widest instruction set of CPU whose lane count divides TLanes is selected in run-time.
+//! Bit-identical results need scalar code not to be contracted into FMA. (`-ffp-contract=off`)
+//!
+
+/// @brief Check rays of packet are intersected with DBounds3D.
+/// If DBounds3D is infinite, all lanes are intersected.
+/// @return Bit mask of intersected lanes.
+template <typename TType, TIndex TLanes>
+[[nodiscard]] TU32 IsRayIntersected(const DRayPacket<TType, TLanes>& rays, const DBounds3D<TType>& bounds);
+
+/// @brief Check rays of packet are intersected with DSphere.
+/// @return Bit mask of intersected lanes.
+template <typename TType, TIndex TLanes>
+[[nodiscard]] TU32 IsRayIntersected(const DRayPacket<TType, TLanes>& rays, const DSphere<TType>& sphere);
+
+/// @brief Check rays of packet are intersected with DBox (AABB).
+/// @return Bit mask of intersected lanes.
+template <typename TType, TIndex TLanes>
+[[nodiscard]] TU32 IsRayIntersected(const DRayPacket<TType, TLanes>& rays, const DBox<TType>& box);
+
+/// @brief Get closest positive 't' of each ray of packet to DBounds3D.
+/// If DBounds3D is infinite, no lane is regarded as having closest 't' value, like scalar version.
+/// @param oTValues Closest 't' of each lane. Lanes that are not hit are set to infinity.
+/// @return Bit mask of lanes that have valid 't' value.
+template <typename TType, TIndex TLanes>
+TU32 GetClosestTValueOf(
+  const DRayPacket<TType, TLanes>& rays, 
+  const DBounds3D<TType>& bounds, 
+  std::array<TReal, TLanes>& oTValues);
+
+/// @brief Get closest positive 't' of each ray of packet to DSphere.
+/// @param oTValues Closest 't' of each lane. Lanes that are not hit are set to infinity.
+/// @return Bit mask of lanes that have valid 't' value.
+template <typename TType, TIndex TLanes>
+TU32 GetClosestTValueOf(
+  const DRayPacket<TType, TLanes>& rays, 
+  const DSphere<TType>& sphere, 
+  std::array<TReal, TLanes>& oTValues);
+
+/// @brief Get closest positive 't' of each ray of packet to DBox (AABB).
+/// @param oTValues Closest 't' of each lane. Lanes that are not hit are set to infinity.
+/// @return Bit mask of lanes that have valid 't' value.
+template <typename TType, TIndex TLanes>
+TU32 GetClosestTValueOf(
+  const DRayPacket<TType, TLanes>& rays, 
+  const DBox<TType>& box, 
+  std::array<TReal, TLanes>& oTValues);
+
 } /// ::dy::math namespace
 #include <Math/Utility/Inline/XShapeMath.inl>
+#include <Math/Utility/Inline/XShapeMathPacket.inl>
 #include <Math/Utility/Inline/XBounds3DMath.inl>
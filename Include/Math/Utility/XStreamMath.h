@@ -0,0 +1,105 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Type/Math/DVector3Stream.h>
+#include <Math/Type/Math/DVector4Stream.h>
+
+/// Bulk kernels of vector streams, which are element-wise version of
+/// functions in `XLinearMath.h` and `XMath.h`.
+///
+/// Input streams must have same size, and `oResults` is resized to that size.
+/// `oResults` can be same to one of inputs, to update stream in place.
+/// With `MATH_ENABLE_SIMD`, `TF32` streams are processed with SSE4.1 (AVX when `__AVX__` is defined,
+/// AVX-512 when `__AVX512F__` is defined) and remained tail with scalar code.
+/// With `MATH_ENABLE_SIMD_DISPATCH`, instruction set is selected in run-time. (See XSimdDispatch.h) Values are calculated with stream value type,
+/// not `TReal`, so result can be different from scalar function when `TReal` is another type.
+
+namespace dy::math
+{
+
+//!
+//! DVector3Stream
+//!
+
+/// @brief Do dot product of each (x, y, z) vector pair, and write to `oResults`.
+/// `oResults` must have `lhs.size()` values.
+template <typename TType>
+void Dot(const DVector3Stream<TType>& lhs, const DVector3Stream<TType>& rhs, TType* oResults) noexcept;
+
+/// @brief Cross product of each (x, y, z) vector pair.
+template <typename TType>
+void Cross(const DVector3Stream<TType>& lhs, const DVector3Stream<TType>& rhs, DVector3Stream<TType>& oResults);
+
+/// @brief Do linear interpolation of each vector pair.
+/// result = lhs ( 1 - factor ) + rhs factor
+template <typename TType>
+void Lerp(const DVector3Stream<TType>& lhs, const DVector3Stream<TType>& rhs, TReal factor, DVector3Stream<TType>& oResults);
+
+/// @brief Normalize each vector. Vector of which length is 0 becomes NaN vector, as `DVector3::Normalize`.
+template <typename TType>
+void Normalize(const DVector3Stream<TType>& values, DVector3Stream<TType>& oResults);
+
+/// @brief Get minimum value vector of each vector pair.
+template <typename TType>
+void ExtractMin(const DVector3Stream<TType>& lhs, const DVector3Stream<TType>& rhs, DVector3Stream<TType>& oResults);
+
+/// @brief Get maximum value vector of each vector pair.
+template <typename TType>
+void ExtractMax(const DVector3Stream<TType>& lhs, const DVector3Stream<TType>& rhs, DVector3Stream<TType>& oResults);
+
+/// @brief Absolutize each vector.
+template <typename TType>
+void Abs(const DVector3Stream<TType>& values, DVector3Stream<TType>& oResults);
+
+/// @brief Clamp all elements of each vector to [0, 1].
+template <typename TType>
+void Saturate(const DVector3Stream<TType>& values, DVector3Stream<TType>& oResults);
+
+//!
+//! DVector4Stream
+//!
+
+/// @brief Do dot product of each (x, y, z, w) vector pair, and write to `oResults`.
+/// `oResults` must have `lhs.size()` values.
+template <typename TType>
+void Dot(const DVector4Stream<TType>& lhs, const DVector4Stream<TType>& rhs, TType* oResults) noexcept;
+
+/// @brief Do linear interpolation of each vector pair.
+/// result = lhs ( 1 - factor ) + rhs factor
+template <typename TType>
+void Lerp(const DVector4Stream<TType>& lhs, const DVector4Stream<TType>& rhs, TReal factor, DVector4Stream<TType>& oResults);
+
+/// @brief Normalize each vector. Vector of which length is 0 becomes NaN vector, as `DVector4::Normalize`.
+template <typename TType>
+void Normalize(const DVector4Stream<TType>& values, DVector4Stream<TType>& oResults);
+
+/// @brief Get minimum value vector of each vector pair.
+template <typename TType>
+void ExtractMin(const DVector4Stream<TType>& lhs, const DVector4Stream<TType>& rhs, DVector4Stream<TType>& oResults);
+
+/// @brief Get maximum value vector of each vector pair.
+template <typename TType>
+void ExtractMax(const DVector4Stream<TType>& lhs, const DVector4Stream<TType>& rhs, DVector4Stream<TType>& oResults);
+
+/// @brief Absolutize each vector.
+template <typename TType>
+void Abs(const DVector4Stream<TType>& values, DVector4Stream<TType>& oResults);
+
+/// @brief Clamp all elements of each vector to [0, 1].
+template <typename TType>
+void Saturate(const DVector4Stream<TType>& values, DVector4Stream<TType>& oResults);
+
+} /// ::dy::math namespace
+#include <Math/Utility/Inline/XStreamMath.inl>
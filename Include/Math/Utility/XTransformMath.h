@@ -0,0 +1,74 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <Math/Common/TGlobalTypes.h>
+#include <Math/Type/Math/DMatrix4.h>
+#include <Math/Type/Math/DVector3Stream.h>
+#include <Math/Type/Shape/DPlane.h>
+
+/// Bulk transform kernels, which transform contiguous values by one matrix.
+/// Matrix is converted to columns once and kept during the loop,
+/// and values of same matrix and vector type are multiplied without `GetBiggerType` conversion.
+/// Results are same to `matrix * vector` of each value. Both `EMatMajor` are supported.
+///
+/// `iValues` and `oValues` can point same buffer to transform values in place.
+/// With `MATH_ENABLE_SIMD`, `TF32` values are calculated with SIMD `DVector4<TF32>` operations,
+/// and `TF32` streams with TSimdF32 (SSE4.1, or AVX when `__AVX__` is defined).
+/// With `MATH_ENABLE_SIMD_DISPATCH`, instruction set of streams is selected in run-time.
+
+namespace dy::math
+{
+
+/// @brief Transform positions as `(matrix * (p, 1)).xyz`. Result `w` is discarded without division.
+template <typename TType, EMatMajor TMajor>
+void TransformPoints(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DVector3<TType>* iPoints, TIndex count, DVector3<TType>* oPoints) noexcept;
+
+/// @brief Transform homogeneous vectors as `matrix * v`.
+template <typename TType, EMatMajor TMajor>
+void TransformPoints(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DVector4<TType>* iPoints, TIndex count, DVector4<TType>* oPoints) noexcept;
+
+/// @brief Transform positions of stream as `(matrix * (p, 1)).xyz`. Result `w` is discarded without division.
+/// `oPoints` is resized to the size of `iPoints`.
+template <typename TType, EMatMajor TMajor>
+void TransformPoints(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DVector3Stream<TType>& iPoints, DVector3Stream<TType>& oPoints);
+
+/// @brief Transform directions as `(matrix * (d, 0)).xyz`. Translation is not applied.
+template <typename TType, EMatMajor TMajor>
+void TransformDirections(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DVector3<TType>* iDirections, TIndex count, DVector3<TType>* oDirections) noexcept;
+
+/// @brief Transform directions of stream as `(matrix * (d, 0)).xyz`. Translation is not applied.
+/// `oDirections` is resized to the size of `iDirections`.
+template <typename TType, EMatMajor TMajor>
+void TransformDirections(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DVector3Stream<TType>& iDirections, DVector3Stream<TType>& oDirections);
+
+/// @brief Transform planes by matrix which transforms positions.
+/// Plane `(n, d)` is transformed by inverse transpose of `matrix`, and normal is normalized again.
+/// `matrix` must be invertible. Inverse is calculated once for all planes.
+template <typename TType, EMatMajor TMajor>
+void TransformPlanes(
+  const DMatrix4<TType, TMajor>& matrix,
+  const DPlane<TType>* iPlanes, TIndex count, DPlane<TType>* oPlanes);
+
+} /// ::dy::math namespace
+#include <Math/Utility/Inline/XTransformMath.inl>
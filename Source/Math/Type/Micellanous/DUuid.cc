@@ -14,12 +14,12 @@
 
 #include <Math/Type/Micellanous/DUuid.h>
 
+#include <cstring>
+
 #define BOOST_UUID_NO_TYPE_TRAITS 
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
-#include <boost/lexical_cast.hpp>
 #include <boost/uuid/uuid_io.hpp>
-#include <boost/container_hash/hash.hpp>
 
 #include <Math/Common/XGlobalMacroes.h>
 
@@ -28,12 +28,12 @@ namespace dy::math
 
 DUuid::DUuid(bool iCreateValue)
 {
-  this->mUuid = new (std::nothrow) boost::uuids::uuid();
-
   if (iCreateValue == true)
   {
-    // Make new value.
-    *this->mUuid = boost::uuids::random_generator()();
+    // Make new value. Generator is made once for each thread, because it is seeded from system entropy.
+    thread_local boost::uuids::random_generator generator;
+    const boost::uuids::uuid value = generator();
+    std::memcpy(this->mValue, value.data, sizeof(this->mValue));
   }
 }
 
@@ -41,89 +41,19 @@ DUuid::DUuid(const std::string& iUuidString, [[maybe_unused]] bool iIsStrict)
 {
   const boost::uuids::string_generator gen;
 
-   this->mUuid = new (std::nothrow) boost::uuids::uuid();
-  *this->mUuid = gen(iUuidString);
-}
-
-DUuid::DUuid(const DUuid& uuid)
-{
-  this->mUuid = new (std::nothrow) boost::uuids::uuid();
-  *this->mUuid = *uuid.mUuid;
-}
-
-DUuid& DUuid::operator=(const DUuid& uuid)
-{
-  if (this == &uuid) { return *this; }
-
-  (*this->mUuid) = *uuid.mUuid;
-  return *this;
-}
-
-DUuid::DUuid(DUuid&& uuid) noexcept
-{
-  this->mUuid = new (std::nothrow) boost::uuids::uuid();
-  *this->mUuid = *uuid.mUuid;
-}
-
-DUuid& DUuid::operator=(DUuid&& uuid) noexcept
-{
-  if (this == &uuid) { return *this; }
-
-  (*this->mUuid) = *uuid.mUuid;
-  return *this;
-}
-
-DUuid::~DUuid()
-{
-  delete this->mUuid;
-  this->mUuid = nullptr;
-}
-
-bool DUuid::HasValue() const
-{
-  return this->mUuid->is_nil() == false;
+  const boost::uuids::uuid value = gen(iUuidString);
+  std::memcpy(this->mValue, value.data, sizeof(this->mValue));
 }
 
 std::string DUuid::ToString() const
 {
-  return boost::lexical_cast<std::string>(this->mUuid);
-}
-
-DUuid::iterator DUuid::begin() noexcept
-{
-  return this->mUuid->begin();
-}
-
-DUuid::iterator DUuid::end() noexcept
-{
-  return this->mUuid->end();
-}
-
-DUuid::const_iterator DUuid::begin() const noexcept
-{
-  return this->mUuid->begin();
-}
-
-DUuid::const_iterator DUuid::end() const noexcept
-{
-  return this->mUuid->end();
-}
-
-bool operator==(const DUuid& lhs, const DUuid& rhs) noexcept
-{
-  return *lhs.mUuid == *rhs.mUuid;
+  boost::uuids::uuid value;
+  std::memcpy(value.data, this->mValue, sizeof(this->mValue));
+  return boost::uuids::to_string(value);
 }
 
 } /// ::dy::math namespace
 
-std::hash<dy::math::DUuid>::result_type 
-std::hash<dy::math::DUuid>::operator()(const argument_type& s) const noexcept
-{
-  {
-    return boost::hash<boost::uuids::uuid>()(*s.mUuid);
-  }
-}
-
 namespace dy::math
 {
 
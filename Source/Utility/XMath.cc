@@ -38,8 +38,11 @@
  */
 
 #include <Math/Utility/XMath.h>
+#include <Math/Common/XSimdDispatch.h>
 #include <Expr/XMacroes.h>
 #include <math.h>
+#include <array>
+#include <limits>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -55,16 +58,18 @@
                 ((x) < 0.0 ? -pow((double)-(x), 1.0/3.0) : 0.0))
 #endif
 
+MATH_SIMD_KERNEL_REGION_BEGIN
+
 namespace dy::math
 {
   
-std::vector<TReal> SolveQuadric(TReal c2, TReal c1, TReal c0)
+DRootSet<TReal, 2> SolveQuadricRoots(TReal c2, TReal c1, TReal c0) noexcept
 {
   /* normal form: x^2 + px + q = 0 */
   const TReal p = c1 / (2 * c2);
   const TReal q = c0 / c2;
   const TReal D = p * p - q;
-  std::vector<TReal> result;
+  DRootSet<TReal, 2> result;
 
   if (IsNearlyZero(D, TReal(1e-5)) == true)
   {
@@ -77,16 +82,14 @@ std::vector<TReal> SolveQuadric(TReal c2, TReal c1, TReal c0)
 
     result.emplace_back(sqrt_D - p);
     result.emplace_back(-sqrt_D - p);
-    std::sort(result.begin(), result.end());
+    result.Sort();
   }
 
   return result;
 }
 
-std::vector<TReal> SolveCubic(TReal c3, TReal c2, TReal c1, TReal c0)
+DRootSet<TReal, 3> SolveCubicRoots(TReal c3, TReal c2, TReal c1, TReal c0) noexcept
 {
-  TU32 num;
-
   /* normal form: x^3 + Ax^2 + Bx + C = 0 */
   const TReal A = c2 / c3;
   const TReal B = c1 / c3;
@@ -101,20 +104,18 @@ std::vector<TReal> SolveCubic(TReal c3, TReal c2, TReal c1, TReal c0)
   const TReal cb_p = p * p * p;
   const TReal D = q * q + cb_p;
 
-  std::vector<TReal> result;
+  DRootSet<TReal, 3> result;
   if (IsZero(D))
   {
     if (IsZero(q)) /* one triple solution */
     {
       result.emplace_back(TReal(0));
-      num = 1;
     }
     else /* one single and one TReal solution */
     {
       const TReal u = cbrt(-q);
       result.emplace_back(2 * u);
       result.emplace_back(-u);
-      num = 2;
     }
   }
   else if (D < 0) /* Casus irreducibilis: three real solutions */
@@ -125,7 +126,6 @@ std::vector<TReal> SolveCubic(TReal c3, TReal c2, TReal c1, TReal c0)
     result.emplace_back(t * std::cos(phi));
     result.emplace_back(-t * std::cos(phi + TReal(M_PI) / 3));
     result.emplace_back(-t * std::cos(phi - TReal(M_PI) / 3));
-    num = 3;
   }
   else /* one real solution */
   {
@@ -134,18 +134,17 @@ std::vector<TReal> SolveCubic(TReal c3, TReal c2, TReal c1, TReal c0)
     const TReal v = -cbrt(sqrt_D + q);
 
     result.emplace_back(u + v);
-    num = 1;
   }
 
   // Resubstitution & Sorting
   const TReal sub = TReal(1) / 3 * A;
   for (auto& value : result) { value -= sub; }
-  std::sort(result.begin(), result.end());
+  result.Sort();
 
   return result;
 }
 
-std::vector<TReal> SolveQuartic(TReal c4, TReal c3, TReal c2, TReal c1, TReal c0)
+DRootSet<TReal, 4> SolveQuarticRoots(TReal c4, TReal c3, TReal c2, TReal c1, TReal c0) noexcept
 {
   // normal form: x^4 + Ax^3 + Bx^2 + Cx + D = 0 
   const TReal A = c3 / c4;
@@ -159,7 +158,7 @@ std::vector<TReal> SolveQuartic(TReal c4, TReal c3, TReal c2, TReal c1, TReal c0
   const TReal q = TReal(1) / 8 * sq_A * A - TReal(1) / 2 * A * B + C;
   const TReal r = TReal(-3) / 256 * sq_A * sq_A + TReal(1) / 16 * sq_A * B - TReal(1) / 4 * A * C + D;
 
-  std::vector<TReal> result;
+  DRootSet<TReal, 4> result;
 
   if (IsNearlyZero(r, TReal(1e-5)))
   {
@@ -169,21 +168,21 @@ std::vector<TReal> SolveQuartic(TReal c4, TReal c3, TReal c2, TReal c1, TReal c0
       else
       {
         // y^2(y^2 + p) = 0
-        result = SolveQuadric(1, 0, p);
+        result = DRootSet<TReal, 4>{SolveQuadricRoots(1, 0, p)};
         result.emplace_back(TReal(0));
       }
     }
     else
     {
       // y(y^3 + py + q) = 0 
-      result = SolveCubic(1, 0, p, q);
+      result = DRootSet<TReal, 4>{SolveCubicRoots(1, 0, p, q)};
       result.emplace_back(TReal(0));
     }
   }
   else
   {
     // solve the resolvent cubic and take the one real solution ...
-    const TReal z = SolveCubic(1, TReal(-1) / 2 * p, -r, TReal(1) / 2 * r * p - TReal(1) / 8 * q * q).front();
+    const TReal z = SolveCubicRoots(1, TReal(-1) / 2 * p, -r, TReal(1) / 2 * r * p - TReal(1) / 8 * q * q).front();
 
     // to build two quadric equations
     TReal u = z * z - r;
@@ -197,8 +196,8 @@ std::vector<TReal> SolveQuartic(TReal c4, TReal c3, TReal c2, TReal c1, TReal c0
     else if (v > 0)       { v = sqrt(v); }
     else { return {}; } // Can not find real root values.
 
-    const auto result1 = SolveQuadric(1, q < 0 ? -v : v, z - u);
-    const auto result2 = SolveQuadric(1, q < 0 ? v : -v, z + u);
+    const auto result1 = SolveQuadricRoots(1, q < 0 ? -v : v, z - u);
+    const auto result2 = SolveQuadricRoots(1, q < 0 ? v : -v, z + u);
     std::merge(EXPR_BIND_BEGIN_END(result1), EXPR_BIND_BEGIN_END(result2), std::back_inserter(result));
   }
 
@@ -209,4 +208,457 @@ std::vector<TReal> SolveQuartic(TReal c4, TReal c3, TReal c2, TReal c1, TReal c0
   return result;
 }
 
-} /// ::dy::math namespace
\ No newline at end of file
+std::vector<TReal> SolveQuadric(TReal c2, TReal c1, TReal c0)
+{
+  const auto result = SolveQuadricRoots(c2, c1, c0);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+std::vector<TReal> SolveCubic(TReal c3, TReal c2, TReal c1, TReal c0)
+{
+  const auto result = SolveCubicRoots(c3, c2, c1, c0);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+std::vector<TReal> SolveQuartic(TReal c4, TReal c3, TReal c2, TReal c1, TReal c0)
+{
+  const auto result = SolveQuarticRoots(c4, c3, c2, c1, c0);
+  return std::vector<TReal>(result.cbegin(), result.cend());
+}
+
+//!
+//! Batch solvers
+//!
+
+namespace
+{
+
+/// @brief Write sorted root set into i-th slot of structure-of-arrays output.
+template <TIndex TCapacity>
+void StoreRootSet(
+  DRootSet<TReal, TCapacity> roots, TIndex index, TIndex count, 
+  TU32* oRootCounts, TReal* oRoots) noexcept
+{
+  roots.Sort();
+  oRootCounts[index] = static_cast<TU32>(roots.size());
+  for (TIndex k = 0; k < TCapacity; ++k)
+  {
+    oRoots[k * count + index] = k < roots.size() ? roots[k] : std::numeric_limits<TReal>::infinity();
+  }
+}
+
+#if defined(MATH_SIMD_KERNELS) && !defined(MATH_USE_REAL_AS_DOUBLE)
+//! Lane kernels below compute every branch of scalar solvers and select results with masks.
+//! Invalid root lanes are infinity, so sorting network pushes them to the back of roots.
+
+template <typename TSimd>
+using TRootReg = typename TSimd::TReg;
+
+/// @brief Fixed array of SIMD registers. (`std::array` drops alignment attribute of register types)
+template <typename TSimd, TIndex TSize>
+struct DRootRegs final
+{
+  TRootReg<TSimd> mRegs[TSize];
+
+  TRootReg<TSimd>& operator[](TIndex index) noexcept { return this->mRegs[index]; }
+  const TRootReg<TSimd>& operator[](TIndex index) const noexcept { return this->mRegs[index]; }
+  TRootReg<TSimd>* begin() noexcept { return this->mRegs; }
+  TRootReg<TSimd>* end() noexcept { return this->mRegs + TSize; }
+  const TRootReg<TSimd>* begin() const noexcept { return this->mRegs; }
+  const TRootReg<TSimd>* end() const noexcept { return this->mRegs + TSize; }
+};
+
+template <typename TSimd>
+MATH_SIMD_INLINE inline void CompareSwap(TRootReg<TSimd>& lhs, TRootReg<TSimd>& rhs) noexcept
+{
+  const auto min = TSimd::Min(lhs, rhs);
+  rhs = TSimd::Max(lhs, rhs);
+  lhs = min;
+}
+
+/// @brief Get cube root of each lane. Initial guess from exponent bits + 3 newton iterations.
+template <typename TSimd>
+MATH_SIMD_INLINE inline TRootReg<TSimd> CbrtLanes(TRootReg<TSimd> value) noexcept
+{
+  using S = TSimd;
+  const auto absValue = S::Abs(value);
+  auto y = S::ConvertF32ToBits(
+    S::Add(S::Mul(S::ConvertBitsToF32(absValue), S::Set1(1.0f / 3.0f)), S::Set1(709921077.0f)));
+  const auto thirdValue = S::Mul(S::Set1(1.0f / 3.0f), absValue);
+  for (TIndex i = 0; i < 3; ++i)
+  {
+    y = S::Add(S::Mul(S::Set1(2.0f / 3.0f), y), S::Div(thirdValue, S::Mul(y, y)));
+  }
+
+  y = S::Select(S::CmpGt(absValue, S::Set1(0.0f)), y, S::Set1(0.0f));
+  return S::Or(y, S::And(value, S::Set1(-0.0f)));
+}
+
+/// @brief Get arc cosine of each lane in [-1, 1]. (Abramowitz and Stegun 4.4.46, |error| <= 2e-8)
+template <typename TSimd>
+MATH_SIMD_INLINE inline TRootReg<TSimd> AcosLanes(TRootReg<TSimd> value) noexcept
+{
+  using S = TSimd;
+  const auto x = S::Abs(value);
+  auto poly = S::Set1(-0.0012624911f);
+  poly = S::Add(S::Mul(poly, x), S::Set1(+0.0066700901f));
+  poly = S::Add(S::Mul(poly, x), S::Set1(-0.0170881256f));
+  poly = S::Add(S::Mul(poly, x), S::Set1(+0.0308918810f));
+  poly = S::Add(S::Mul(poly, x), S::Set1(-0.0501743046f));
+  poly = S::Add(S::Mul(poly, x), S::Set1(+0.0889789874f));
+  poly = S::Add(S::Mul(poly, x), S::Set1(-0.2145988016f));
+  poly = S::Add(S::Mul(poly, x), S::Set1(+1.5707963050f));
+
+  const auto result = S::Mul(S::Sqrt(S::Sub(S::Set1(1.0f), x)), poly);
+  return S::Select(S::CmpLt(value, S::Set1(0.0f)), S::Sub(S::Set1(kPi<TF32>), result), result);
+}
+
+/// @brief Get cosine of each lane in [-pi, pi]. Taylor series to 12th order on [0, pi/2].
+template <typename TSimd>
+MATH_SIMD_INLINE inline TRootReg<TSimd> CosLanes(TRootReg<TSimd> value) noexcept
+{
+  using S = TSimd;
+  const auto x = S::Abs(value);
+  const auto isFar = S::CmpGt(x, S::Set1(kPi<TF32> / 2));
+  const auto y = S::Select(isFar, S::Sub(S::Set1(kPi<TF32>), x), x);
+  const auto y2 = S::Mul(y, y);
+
+  auto poly = S::Set1(1.0f / 479001600.0f);
+  poly = S::Add(S::Mul(poly, y2), S::Set1(-1.0f / 3628800.0f));
+  poly = S::Add(S::Mul(poly, y2), S::Set1(+1.0f / 40320.0f));
+  poly = S::Add(S::Mul(poly, y2), S::Set1(-1.0f / 720.0f));
+  poly = S::Add(S::Mul(poly, y2), S::Set1(+1.0f / 24.0f));
+  poly = S::Add(S::Mul(poly, y2), S::Set1(-1.0f / 2.0f));
+  poly = S::Add(S::Mul(poly, y2), S::Set1(1.0f));
+  return S::Select(isFar, S::Neg(poly), poly);
+}
+
+/// @brief Lane version of `SolveQuadricRoots`.
+template <typename TSimd>
+MATH_SIMD_INLINE inline DRootRegs<TSimd, 2> SolveQuadricLanes(
+  TRootReg<TSimd> c2, TRootReg<TSimd> c1, TRootReg<TSimd> c0) noexcept
+{
+  using S = TSimd;
+  const auto zero = S::Set1(0.0f);
+  const auto inf  = S::Set1(std::numeric_limits<TF32>::infinity());
+
+  const auto p = S::Div(c1, S::Mul(S::Set1(2.0f), c2));
+  const auto q = S::Div(c0, c2);
+  const auto D = S::Sub(S::Mul(p, p), q);
+
+  const auto isSingle = S::CmpLt(S::Abs(D), S::Set1(1e-5f));
+  const auto isDouble = S::AndNot(isSingle, S::CmpGt(D, zero));
+  const auto sqrtD = S::Sqrt(S::Max(D, zero));
+
+  return 
+  {
+    S::Select(isSingle, S::Neg(p), S::Select(isDouble, S::Sub(S::Neg(sqrtD), p), inf)),
+    S::Select(isDouble, S::Sub(sqrtD, p), inf)
+  };
+}
+
+/// @brief Lane version of `SolveCubicRoots`. Roots are sorted.
+template <typename TSimd>
+MATH_SIMD_INLINE inline DRootRegs<TSimd, 3> SolveCubicLanes(
+  TRootReg<TSimd> c3, TRootReg<TSimd> c2, TRootReg<TSimd> c1, TRootReg<TSimd> c0) noexcept
+{
+  using S = TSimd;
+  const auto zero = S::Set1(0.0f);
+  const auto inf  = S::Set1(std::numeric_limits<TF32>::infinity());
+  const auto eps  = S::Set1(TF32(EQN_EPS));
+
+  // normal form: x^3 + Ax^2 + Bx + C = 0
+  const auto A = S::Div(c2, c3);
+  const auto B = S::Div(c1, c3);
+  const auto C = S::Div(c0, c3);
+
+  // substitute x = y - A/3 to eliminate quadric term: x^3 +px + q = 0
+  const auto sqA = S::Mul(A, A);
+  const auto p = S::Mul(S::Set1(1.0f / 3), S::Add(S::Mul(S::Set1(-1.0f / 3), sqA), B));
+  const auto q = S::Mul(
+    S::Set1(1.0f / 2), 
+    S::Add(
+      S::Sub(S::Mul(S::Mul(S::Set1(2.0f / 27), A), sqA), S::Mul(S::Mul(S::Set1(1.0f / 3), A), B)), 
+      C));
+
+  // use Cardano's formula
+  const auto cbP = S::Mul(S::Mul(p, p), p);
+  const auto D = S::Add(S::Mul(q, q), cbP);
+
+  const auto isDZero = S::CmpLt(S::Abs(D), eps);
+  const auto isQZero = S::CmpLt(S::Abs(q), eps);
+  const auto isNegative = S::AndNot(isDZero, S::CmpLt(D, zero));
+
+  // D == 0 : one triple solution, or one single and one double solution.
+  const auto u0 = CbrtLanes<S>(S::Neg(q));
+  // D < 0 : Casus irreducibilis, three real solutions.
+  const auto cosArg = S::Div(S::Neg(q), S::Sqrt(S::Max(S::Neg(cbP), zero)));
+  const auto phi = S::Mul(S::Set1(1.0f / 3), AcosLanes<S>(S::Min(S::Max(cosArg, S::Set1(-1.0f)), S::Set1(1.0f))));
+  const auto t = S::Mul(S::Set1(2.0f), S::Sqrt(S::Max(S::Neg(p), zero)));
+  const auto negT = S::Neg(t);
+  const auto piThird = S::Set1(kPi<TF32> / 3);
+  // D > 0 : one real solution.
+  const auto sqrtD = S::Sqrt(S::Max(D, zero));
+  const auto u1 = CbrtLanes<S>(S::Sub(sqrtD, q));
+  const auto v1 = S::Neg(CbrtLanes<S>(S::Add(sqrtD, q)));
+
+  auto root0 = S::Select(
+    isDZero, 
+    S::Select(isQZero, zero, S::Mul(S::Set1(2.0f), u0)),
+    S::Select(isNegative, S::Mul(t, CosLanes<S>(phi)), S::Add(u1, v1)));
+  auto root1 = S::Select(
+    isDZero, 
+    S::Select(isQZero, inf, S::Neg(u0)),
+    S::Select(isNegative, S::Mul(negT, CosLanes<S>(S::Add(phi, piThird))), inf));
+  auto root2 = S::Select(isNegative, S::Mul(negT, CosLanes<S>(S::Sub(phi, piThird))), inf);
+
+  // Resubstitution & Sorting
+  const auto sub = S::Mul(S::Set1(1.0f / 3), A);
+  root0 = S::Sub(root0, sub);
+  root1 = S::Sub(root1, sub);
+  root2 = S::Sub(root2, sub);
+  CompareSwap<S>(root0, root1);
+  CompareSwap<S>(root1, root2);
+  CompareSwap<S>(root0, root1);
+  return {root0, root1, root2};
+}
+
+/// @brief Lane version of `SolveQuarticRoots`. Roots are sorted.
+template <typename TSimd>
+MATH_SIMD_INLINE inline DRootRegs<TSimd, 4> SolveQuarticLanes(
+  TRootReg<TSimd> c4, TRootReg<TSimd> c3, TRootReg<TSimd> c2, TRootReg<TSimd> c1, TRootReg<TSimd> c0) noexcept
+{
+  using S = TSimd;
+  const auto zero = S::Set1(0.0f);
+  const auto one  = S::Set1(1.0f);
+  const auto inf  = S::Set1(std::numeric_limits<TF32>::infinity());
+  const auto tolerance = S::Set1(1e-5f);
+
+  // normal form: x^4 + Ax^3 + Bx^2 + Cx + D = 0 
+  const auto A = S::Div(c3, c4);
+  const auto B = S::Div(c2, c4);
+  const auto C = S::Div(c1, c4);
+  const auto D = S::Div(c0, c4);
+
+  // substitute x = y - A/4 to eliminate cubic term: x^4 + px^2 + qx + r = 0
+  const auto sqA = S::Mul(A, A);
+  const auto p = S::Add(S::Mul(S::Set1(-3.0f / 8), sqA), B);
+  const auto q = S::Add(
+    S::Sub(S::Mul(S::Mul(S::Set1(1.0f / 8), sqA), A), S::Mul(S::Mul(S::Set1(1.0f / 2), A), B)), 
+    C);
+  const auto r = S::Add(
+    S::Sub(
+      S::Add(S::Mul(S::Mul(S::Set1(-3.0f / 256), sqA), sqA), S::Mul(S::Mul(S::Set1(1.0f / 16), sqA), B)),
+      S::Mul(S::Mul(S::Set1(1.0f / 4), A), C)),
+    D);
+
+  const auto isRZero = S::CmpLt(S::Abs(r), tolerance);
+  const auto isQZero = S::CmpLt(S::Abs(q), tolerance);
+  const auto isPZero = S::CmpLt(S::Abs(p), tolerance);
+
+  // r == 0 : y(y^3 + py + q) = 0, or y^2(y^2 + p) = 0.
+  const auto cubicY = SolveCubicLanes<S>(one, zero, p, q);
+  const auto quadricY = SolveQuadricLanes<S>(one, zero, p);
+  const auto useCubic = S::AndNot(isQZero, isRZero);
+  const auto useQuadric = S::And(isRZero, S::AndNot(isPZero, isQZero));
+  DRootRegs<S, 4> zeroRoots = 
+  {
+    S::Select(useCubic, cubicY[0], S::Select(useQuadric, quadricY[0], inf)),
+    S::Select(useCubic, cubicY[1], S::Select(useQuadric, quadricY[1], inf)),
+    S::Select(useCubic, cubicY[2], inf),
+    zero
+  };
+
+  // r != 0 : solve the resolvent cubic and take the one real solution,
+  // to build two quadric equations.
+  const auto z = SolveCubicLanes<S>(
+    one, 
+    S::Mul(S::Set1(-1.0f / 2), p), 
+    S::Neg(r), 
+    S::Sub(S::Mul(S::Mul(S::Set1(1.0f / 2), r), p), S::Mul(S::Mul(S::Set1(1.0f / 8), q), q)))[0];
+  auto u = S::Sub(S::Mul(z, z), r);
+  auto v = S::Sub(S::Mul(S::Set1(2.0f), z), p);
+  const auto isUZero = S::CmpLt(S::Abs(u), S::Set1(0.001f));
+  const auto isVZero = S::CmpLt(S::Abs(v), S::Set1(0.001f));
+  const auto hasRealRoot = S::And(S::Or(isUZero, S::CmpGt(u, zero)), S::Or(isVZero, S::CmpGt(v, zero)));
+  u = S::Select(isUZero, zero, S::Sqrt(S::Max(u, zero)));
+  v = S::Select(isVZero, zero, S::Sqrt(S::Max(v, zero)));
+
+  const auto isQNegative = S::CmpLt(q, zero);
+  const auto quadric1 = SolveQuadricLanes<S>(one, S::Select(isQNegative, S::Neg(v), v), S::Sub(z, u));
+  const auto quadric2 = SolveQuadricLanes<S>(one, S::Select(isQNegative, v, S::Neg(v)), S::Add(z, u));
+  const auto isValid = S::AndNot(isRZero, hasRealRoot);
+
+  // Select branch, resubstitute and sort.
+  const auto sub = S::Mul(S::Set1(1.0f / 4), A);
+  DRootRegs<S, 4> roots = 
+  {
+    S::Select(isValid, quadric1[0], zeroRoots[0]),
+    S::Select(isValid, quadric1[1], zeroRoots[1]),
+    S::Select(isValid, quadric2[0], zeroRoots[2]),
+    S::Select(isValid, quadric2[1], S::Select(isRZero, zeroRoots[3], inf)),
+  };
+  for (auto& root : roots) { root = S::Sub(root, sub); }
+
+  CompareSwap<S>(roots[0], roots[1]);
+  CompareSwap<S>(roots[2], roots[3]);
+  CompareSwap<S>(roots[0], roots[2]);
+  CompareSwap<S>(roots[1], roots[3]);
+  CompareSwap<S>(roots[1], roots[2]);
+  return roots;
+}
+
+/// @brief Polish finite roots of polynomial `c` (`c[0]` is highest-order term) with one newton step.
+/// Step is taken only when it decreases residual, so roots near repeated root (where derivative is
+/// nearly zero and newton step is unstable) keep value of kernel.
+template <typename TSimd, TIndex TCoeffs, TIndex TRoots>
+MATH_SIMD_INLINE inline void PolishRoots(const DRootRegs<TSimd, TCoeffs>& c, DRootRegs<TSimd, TRoots>& ioRoots) noexcept
+{
+  using S = TSimd;
+  const auto inf = S::Set1(std::numeric_limits<TF32>::infinity());
+  const auto GetResidual = [&c](auto x, auto& oValue, auto& oDerivative) MATH_SIMD_INLINE
+  {
+    oValue = c[0];
+    oDerivative = S::Set1(0.0f);
+    for (TIndex k = 1; k < TCoeffs; ++k)
+    {
+      oDerivative = S::Add(S::Mul(oDerivative, x), oValue);
+      oValue = S::Add(S::Mul(oValue, x), c[k]);
+    }
+  };
+
+  for (auto& root : ioRoots)
+  {
+    auto value = root;
+    auto derivative = root;
+    GetResidual(root, value, derivative);
+    const auto polished = S::Sub(root, S::Div(value, derivative));
+
+    auto polishedValue = root;
+    auto unused = root;
+    GetResidual(polished, polishedValue, unused);
+    // NaN of zero derivative fails comparison, so root is kept.
+    const auto isBetter = S::And(S::CmpNeq(root, inf), S::CmpLt(S::Abs(polishedValue), S::Abs(value)));
+    root = S::Select(isBetter, polished, root);
+  }
+}
+
+/// @brief Run lane kernel for each `TSimd::kLanes` equations, and write counts and roots.
+/// Tail equations are copied into padded buffer, so every equation uses same kernel.
+template <typename TSimd, TIndex TCoeffs, TIndex TRoots, typename TKernel>
+MATH_SIMD_INLINE inline void SolveBatchOf(
+  TIndex count, const std::array<const TF32*, TCoeffs>& coeffs, 
+  TU32* oRootCounts, TF32* oRoots, TKernel&& kernel) noexcept
+{
+  using S = TSimd;
+  constexpr TIndex kLanes = S::kLanes;
+  const auto inf = S::Set1(std::numeric_limits<TF32>::infinity());
+
+  alignas(32) std::array<TF32, kLanes> buffer;
+  for (TIndex i = 0; i < count; i += kLanes)
+  {
+    const TIndex laneCount = std::min(kLanes, count - i);
+    DRootRegs<S, TCoeffs> c;
+    for (TIndex k = 0; k < TCoeffs; ++k)
+    {
+      if (laneCount == kLanes) { c[k] = S::LoadU(coeffs[k] + i); continue; }
+
+      // Padded lanes solve `x^n = 0`.
+      for (TIndex j = 0; j < kLanes; ++j) { buffer[j] = j < laneCount ? coeffs[k][i + j] : TF32(k == 0 ? 1 : 0); }
+      c[k] = S::Load(buffer.data());
+    }
+
+    const DRootRegs<S, TRoots> roots = kernel(c);
+
+    auto rootCount = S::Set1(0.0f);
+    for (const auto& root : roots) { rootCount = S::Add(rootCount, S::And(S::CmpNeq(root, inf), S::Set1(1.0f))); }
+    S::Store(buffer.data(), rootCount);
+    for (TIndex j = 0; j < laneCount; ++j) { oRootCounts[i + j] = static_cast<TU32>(buffer[j]); }
+
+    for (TIndex k = 0; k < TRoots; ++k)
+    {
+      if (laneCount == kLanes) { S::StoreU(oRoots + k * count + i, roots[k]); continue; }
+
+      S::Store(buffer.data(), roots[k]);
+      for (TIndex j = 0; j < laneCount; ++j) { oRoots[k * count + i + j] = buffer[j]; }
+    }
+  }
+}
+#endif /// defined(MATH_SIMD_KERNELS) && !defined(MATH_USE_REAL_AS_DOUBLE)
+
+} /// unnamed namespace
+
+void SolveQuadricBatch(
+  TIndex count, const TReal* c2, const TReal* c1, const TReal* c0, 
+  TU32* oRootCounts, TReal* oRoots) noexcept
+{
+#if defined(MATH_SIMD_KERNELS) && !defined(MATH_USE_REAL_AS_DOUBLE)
+  const bool isDispatched = details::DispatchSimdF32([&](auto simd) MATH_SIMD_INLINE
+  {
+    using S = decltype(simd);
+    SolveBatchOf<S, 3, 2>(count, {c2, c1, c0}, oRootCounts, oRoots, [](const auto& c) MATH_SIMD_INLINE
+    {
+      return SolveQuadricLanes<S>(c[0], c[1], c[2]);
+    });
+  });
+  if (isDispatched == true) { return; }
+#endif
+
+  for (TIndex i = 0; i < count; ++i)
+  {
+    StoreRootSet(SolveQuadricRoots(c2[i], c1[i], c0[i]), i, count, oRootCounts, oRoots);
+  }
+}
+
+void SolveCubicBatch(
+  TIndex count, const TReal* c3, const TReal* c2, const TReal* c1, const TReal* c0, 
+  TU32* oRootCounts, TReal* oRoots) noexcept
+{
+#if defined(MATH_SIMD_KERNELS) && !defined(MATH_USE_REAL_AS_DOUBLE)
+  const bool isDispatched = details::DispatchSimdF32([&](auto simd) MATH_SIMD_INLINE
+  {
+    using S = decltype(simd);
+    SolveBatchOf<S, 4, 3>(count, {c3, c2, c1, c0}, oRootCounts, oRoots, [](const auto& c) MATH_SIMD_INLINE
+    {
+      auto roots = SolveCubicLanes<S>(c[0], c[1], c[2], c[3]);
+      PolishRoots<S>(c, roots);
+      return roots;
+    });
+  });
+  if (isDispatched == true) { return; }
+#endif
+
+  for (TIndex i = 0; i < count; ++i)
+  {
+    StoreRootSet(SolveCubicRoots(c3[i], c2[i], c1[i], c0[i]), i, count, oRootCounts, oRoots);
+  }
+}
+
+void SolveQuarticBatch(
+  TIndex count, const TReal* c4, const TReal* c3, const TReal* c2, const TReal* c1, const TReal* c0, 
+  TU32* oRootCounts, TReal* oRoots) noexcept
+{
+#if defined(MATH_SIMD_KERNELS) && !defined(MATH_USE_REAL_AS_DOUBLE)
+  const bool isDispatched = details::DispatchSimdF32([&](auto simd) MATH_SIMD_INLINE
+  {
+    using S = decltype(simd);
+    SolveBatchOf<S, 5, 4>(count, {c4, c3, c2, c1, c0}, oRootCounts, oRoots, [](const auto& c) MATH_SIMD_INLINE
+    {
+      auto roots = SolveQuarticLanes<S>(c[0], c[1], c[2], c[3], c[4]);
+      PolishRoots<S>(c, roots);
+      return roots;
+    });
+  });
+  if (isDispatched == true) { return; }
+#endif
+
+  for (TIndex i = 0; i < count; ++i)
+  {
+    StoreRootSet(SolveQuarticRoots(c4[i], c3[i], c2[i], c1[i], c0[i]), i, count, oRootCounts, oRoots);
+  }
+}
+
+
+} /// ::dy::math namespace
+
+MATH_SIMD_KERNEL_REGION_END